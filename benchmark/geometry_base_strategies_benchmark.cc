@@ -0,0 +1,240 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2023, Woven by Toyota. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Benchmarks the geometry_base::StrategyBase implementations.
+//
+// Every benchmark builds a straight highway from test_utilities/procedural_road_network.h along the x-axis, whose
+// Junctions hold kLanesPerJunction lanes connected to the next Junction. Arguments are:
+// - `lanes`: the total number of lanes.
+// - `param_dm`: the strategy parameter, in decimeters. It is the sampling step for KDTreeStrategy, the chunk
+//   length for BVHStrategy and the cell size for SpatialHashStrategy. BruteForceStrategy ignores it.
+// - `hint`: whether queries provide the RoadPosition of the lane holding the query point as hint.
+// - `radius_dm`: the FindRoadPositions() radius, in decimeters.
+//
+// Run with `--benchmark_out=<file> --benchmark_out_format=json` to store the results.
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <random>
+#include <vector>
+
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
+#include <benchmark/benchmark.h>
+
+#include "maliput/api/lane_data.h"
+#include "maliput/api/road_geometry.h"
+#include "maliput/geometry_base/brute_force_strategy.h"
+#include "maliput/geometry_base/bvh_strategy.h"
+#include "maliput/geometry_base/kd_tree_strategy.h"
+#include "maliput/geometry_base/road_geometry.h"
+#include "maliput/geometry_base/spatial_hash_strategy.h"
+#include "maliput/geometry_base/strategy_base.h"
+#include "maliput/test_utilities/procedural_road_network.h"
+
+namespace maliput {
+namespace benchmarks {
+namespace {
+
+using geometry_base::BruteForceStrategy;
+using geometry_base::BVHStrategy;
+using geometry_base::KDTreeStrategy;
+using geometry_base::SpatialHashStrategy;
+using geometry_base::StrategyBase;
+
+constexpr int kLanesPerDirection{2};
+constexpr int kLanesPerJunction{2 * kLanesPerDirection};
+constexpr double kLaneLength{50.};
+constexpr double kLaneWidth{3.5};
+constexpr std::size_t kNumQueries{1024};
+
+// @returns The number of Junctions needed to hold, at least, @p num_lanes lanes.
+int NumJunctions(std::int64_t num_lanes) {
+  return static_cast<int>((num_lanes + kLanesPerJunction - 1) / kLanesPerJunction);
+}
+
+// Builds the synthetic RoadGeometry with, at least, @p num_lanes lanes.
+std::unique_ptr<geometry_base::RoadGeometry> MakeRoadGeometry(std::int64_t num_lanes) {
+  api::test::ProceduralRoadNetworkConfig config;
+  config.layout = api::test::ProceduralRoadNetworkConfig::Layout::kHighway;
+  config.lanes_per_direction = kLanesPerDirection;
+  config.lane_width = kLaneWidth;
+  config.num_segments = NumJunctions(num_lanes);
+  config.segment_length = kLaneLength;
+  config.interchange_spacing = 0;
+  return api::test::CreateProceduralRoadGeometry(config);
+}
+
+// Obtains kNumQueries random positions over the road surface of MakeRoadGeometry(@p num_lanes), and slightly
+// beyond it. The sequence is the same for every run.
+std::vector<api::InertialPosition> MakeQueries(std::int64_t num_lanes) {
+  const double road_length = kLaneLength * NumJunctions(num_lanes);
+  const double half_road_width = kLanesPerDirection * kLaneWidth;
+  std::mt19937 generator(1234);
+  std::uniform_real_distribution<double> x(-2., road_length + 2.);
+  std::uniform_real_distribution<double> y(-half_road_width - kLaneWidth, half_road_width + kLaneWidth);
+  std::uniform_real_distribution<double> z(-1., 3.);
+  std::vector<api::InertialPosition> queries;
+  queries.reserve(kNumQueries);
+  for (std::size_t i = 0; i < kNumQueries; ++i) {
+    queries.emplace_back(x(generator), y(generator), z(generator));
+  }
+  return queries;
+}
+
+template <typename StrategyT>
+std::unique_ptr<StrategyBase> MakeStrategy(const api::RoadGeometry* rg, double param) {
+  return std::make_unique<StrategyT>(rg, param);
+}
+
+template <>
+std::unique_ptr<StrategyBase> MakeStrategy<BruteForceStrategy>(const api::RoadGeometry* rg, double) {
+  return std::make_unique<BruteForceStrategy>(rg);
+}
+
+// @returns The number of bytes allocated from the heap, when the C library can tell it.
+std::size_t AllocatedBytes() {
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+  // Large blocks are served by mmap() and accounted separately.
+  const struct mallinfo2 info = mallinfo2();
+  return info.uordblks + info.hblkhd;
+#else
+  return 0;
+#endif
+}
+
+// Measures the index build time, and reports the heap the index takes as the `bytes` counter.
+template <typename StrategyT>
+void BM_Build(benchmark::State& state) {
+  const std::unique_ptr<geometry_base::RoadGeometry> rg = MakeRoadGeometry(state.range(0));
+  const double param = state.range(1) / 10.;
+  std::size_t bytes{0};
+  for (auto _ : state) {
+    const std::size_t allocated_before = AllocatedBytes();
+    std::unique_ptr<StrategyBase> strategy = MakeStrategy<StrategyT>(rg.get(), param);
+    bytes = AllocatedBytes() - allocated_before;
+    benchmark::DoNotOptimize(strategy.get());
+    state.PauseTiming();
+    strategy.reset();
+    state.ResumeTiming();
+  }
+  state.counters["lanes"] = static_cast<double>(rg->num_junctions() * kLanesPerJunction);
+  state.counters["bytes"] = static_cast<double>(bytes);
+}
+
+// Measures the latency of ToRoadPosition(), reports the throughput as items per second.
+template <typename StrategyT>
+void BM_ToRoadPosition(benchmark::State& state) {
+  const std::unique_ptr<geometry_base::RoadGeometry> rg = MakeRoadGeometry(state.range(0));
+  const std::unique_ptr<StrategyBase> strategy = MakeStrategy<StrategyT>(rg.get(), state.range(1) / 10.);
+  const std::vector<api::InertialPosition> queries = MakeQueries(state.range(0));
+  std::vector<std::optional<api::RoadPosition>> hints(queries.size());
+  if (state.range(2) != 0) {
+    for (std::size_t i = 0; i < queries.size(); ++i) {
+      hints[i] = strategy->ToRoadPosition(queries[i], std::nullopt).road_position;
+    }
+  }
+  std::size_t i{0};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(strategy->ToRoadPosition(queries[i], hints[i]));
+    i = (i + 1) % queries.size();
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+// Measures the latency of FindRoadPositions(), reports the throughput as items per second.
+template <typename StrategyT>
+void BM_FindRoadPositions(benchmark::State& state) {
+  const std::unique_ptr<geometry_base::RoadGeometry> rg = MakeRoadGeometry(state.range(0));
+  const std::unique_ptr<StrategyBase> strategy = MakeStrategy<StrategyT>(rg.get(), state.range(1) / 10.);
+  const std::vector<api::InertialPosition> queries = MakeQueries(state.range(0));
+  const double radius = state.range(2) / 10.;
+  std::size_t i{0};
+  std::size_t num_results{0};
+  for (auto _ : state) {
+    const std::vector<api::RoadPositionResult> results = strategy->FindRoadPositions(queries[i], radius);
+    num_results += results.size();
+    benchmark::DoNotOptimize(results.data());
+    i = (i + 1) % queries.size();
+  }
+  state.SetItemsProcessed(state.iterations());
+  state.counters["results"] =
+      benchmark::Counter(static_cast<double>(num_results), benchmark::Counter::kAvgIterations);
+}
+
+const std::vector<std::int64_t> kNumLanes{16, 256, 4096};
+const std::vector<std::int64_t> kHints{0, 1};
+const std::vector<std::int64_t> kRadiiDm{5, 50, 200};
+
+BENCHMARK_TEMPLATE(BM_Build, KDTreeStrategy)
+    ->ArgNames({"lanes", "param_dm"})
+    ->ArgsProduct({kNumLanes, {5, 20}})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_Build, BVHStrategy)
+    ->ArgNames({"lanes", "param_dm"})
+    ->ArgsProduct({kNumLanes, {20, 70}})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_Build, SpatialHashStrategy)
+    ->ArgNames({"lanes", "param_dm"})
+    ->ArgsProduct({kNumLanes, {20, 50}})
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_TEMPLATE(BM_ToRoadPosition, BruteForceStrategy)
+    ->ArgNames({"lanes", "param_dm", "hint"})
+    ->ArgsProduct({kNumLanes, {0}, kHints});
+BENCHMARK_TEMPLATE(BM_ToRoadPosition, KDTreeStrategy)
+    ->ArgNames({"lanes", "param_dm", "hint"})
+    ->ArgsProduct({kNumLanes, {5, 20}, kHints});
+BENCHMARK_TEMPLATE(BM_ToRoadPosition, BVHStrategy)
+    ->ArgNames({"lanes", "param_dm", "hint"})
+    ->ArgsProduct({kNumLanes, {20, 70}, kHints});
+BENCHMARK_TEMPLATE(BM_ToRoadPosition, SpatialHashStrategy)
+    ->ArgNames({"lanes", "param_dm", "hint"})
+    ->ArgsProduct({kNumLanes, {20, 50}, kHints});
+
+BENCHMARK_TEMPLATE(BM_FindRoadPositions, BruteForceStrategy)
+    ->ArgNames({"lanes", "param_dm", "radius_dm"})
+    ->ArgsProduct({kNumLanes, {0}, kRadiiDm});
+BENCHMARK_TEMPLATE(BM_FindRoadPositions, KDTreeStrategy)
+    ->ArgNames({"lanes", "param_dm", "radius_dm"})
+    ->ArgsProduct({kNumLanes, {5}, kRadiiDm});
+BENCHMARK_TEMPLATE(BM_FindRoadPositions, BVHStrategy)
+    ->ArgNames({"lanes", "param_dm", "radius_dm"})
+    ->ArgsProduct({kNumLanes, {70}, kRadiiDm});
+BENCHMARK_TEMPLATE(BM_FindRoadPositions, SpatialHashStrategy)
+    ->ArgNames({"lanes", "param_dm", "radius_dm"})
+    ->ArgsProduct({kNumLanes, {20}, kRadiiDm});
+
+}  // namespace
+}  // namespace benchmarks
+}  // namespace maliput
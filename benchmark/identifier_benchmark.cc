@@ -0,0 +1,115 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2023, Woven by Toyota. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Benchmarks the workloads dominated by identifier copies, hashing and comparisons.
+//
+// Every benchmark uses a grid city from test_utilities/procedural_road_network.h whose side, in intersections, is
+// the `grid` argument.
+
+#include <memory>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "maliput/api/lane.h"
+#include "maliput/api/regions.h"
+#include "maliput/api/road_geometry.h"
+#include "maliput/api/road_network.h"
+#include "maliput/api/rules/road_rulebook.h"
+#include "maliput/test_utilities/procedural_road_network.h"
+
+namespace maliput {
+namespace benchmarks {
+namespace {
+
+// Builds a grid city of @p grid x @p grid intersections, with four speed limit zones per lane.
+std::unique_ptr<api::RoadNetwork> MakeGridCity(int grid) {
+  api::test::ProceduralRoadNetworkConfig config;
+  config.num_rows = grid;
+  config.num_columns = grid;
+  config.speed_limit_zones_per_lane = 4;
+  return api::test::CreateProceduralRoadNetwork(config);
+}
+
+// @returns The ids of all the lanes in @p road_network.
+std::vector<api::LaneId> LaneIds(const api::RoadNetwork& road_network) {
+  std::vector<api::LaneId> lane_ids;
+  for (const auto& [lane_id, lane] : road_network.road_geometry()->ById().GetLanes()) {
+    lane_ids.push_back(lane_id);
+  }
+  return lane_ids;
+}
+
+// Copies the ids of all the lanes.
+void BM_CopyLaneIds(benchmark::State& state) {
+  const std::unique_ptr<api::RoadNetwork> road_network = MakeGridCity(static_cast<int>(state.range(0)));
+  const std::vector<api::LaneId> lane_ids = LaneIds(*road_network);
+  for (auto _ : state) {
+    std::vector<api::LaneId> copy(lane_ids);
+    benchmark::DoNotOptimize(copy.data());
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(lane_ids.size()));
+}
+
+// Looks up every lane by id.
+void BM_GetLaneById(benchmark::State& state) {
+  const std::unique_ptr<api::RoadNetwork> road_network = MakeGridCity(static_cast<int>(state.range(0)));
+  const std::vector<api::LaneId> lane_ids = LaneIds(*road_network);
+  const api::RoadGeometry::IdIndex& id_index = road_network->road_geometry()->ById();
+  for (auto _ : state) {
+    for (const api::LaneId& lane_id : lane_ids) {
+      benchmark::DoNotOptimize(id_index.GetLane(lane_id));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(lane_ids.size()));
+}
+
+// Finds the rules of every lane, one lane at a time.
+void BM_FindRules(benchmark::State& state) {
+  const std::unique_ptr<api::RoadNetwork> road_network = MakeGridCity(static_cast<int>(state.range(0)));
+  std::vector<std::vector<api::LaneSRange>> queries;
+  for (const auto& [lane_id, lane] : road_network->road_geometry()->ById().GetLanes()) {
+    queries.push_back({api::LaneSRange(lane_id, {0., lane->length()})});
+  }
+  const api::rules::RoadRulebook* rulebook = road_network->rulebook();
+  for (auto _ : state) {
+    for (const std::vector<api::LaneSRange>& query : queries) {
+      benchmark::DoNotOptimize(rulebook->FindRules(query, 0.));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(queries.size()));
+}
+
+BENCHMARK(BM_CopyLaneIds)->ArgName("grid")->Arg(4)->Arg(16);
+BENCHMARK(BM_GetLaneById)->ArgName("grid")->Arg(4)->Arg(16);
+BENCHMARK(BM_FindRules)->ArgName("grid")->Arg(4)->Arg(16)->Unit(benchmark::kMicrosecond);
+
+}  // namespace
+}  // namespace benchmarks
+}  // namespace maliput
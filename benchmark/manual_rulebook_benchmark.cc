@@ -0,0 +1,100 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2023, Woven by Toyota. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// Benchmarks ManualRulebook::FindRules() and ManualRulebook::FindRuleViews() on a highway from
+// test_utilities/procedural_road_network.h whose lanes are split into `rules_per_lane` speed limit zones each.
+
+#include <memory>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "maliput/api/lane.h"
+#include "maliput/api/road_geometry.h"
+#include "maliput/api/road_network.h"
+#include "maliput/api/rules/road_rulebook.h"
+#include "maliput/base/manual_rulebook.h"
+#include "maliput/test_utilities/procedural_road_network.h"
+
+namespace maliput {
+namespace benchmarks {
+namespace {
+
+// Builds a single Junction highway whose lanes are split into `rules_per_lane` speed limit zones.
+std::unique_ptr<api::RoadNetwork> MakeRoadNetwork(int rules_per_lane) {
+  api::test::ProceduralRoadNetworkConfig config;
+  config.layout = api::test::ProceduralRoadNetworkConfig::Layout::kHighway;
+  config.num_segments = 1;
+  config.speed_limit_zones_per_lane = rules_per_lane;
+  return api::test::CreateProceduralRoadNetwork(config);
+}
+
+// Returns a 1m long range in the middle of a lane of `road_network`.
+std::vector<api::LaneSRange> MakeQuery(const api::RoadNetwork& road_network) {
+  const api::Lane* lane = road_network.road_geometry()->junction(0)->segment(0)->lane(0);
+  const double s = lane->length() / 2.;
+  return {api::LaneSRange(lane->id(), {s, s + 1.})};
+}
+
+void BM_FindRulesInLane(benchmark::State& state) {
+  const std::unique_ptr<api::RoadNetwork> road_network = MakeRoadNetwork(static_cast<int>(state.range(0)));
+  const std::vector<api::LaneSRange> ranges = MakeQuery(*road_network);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(road_network->rulebook()->FindRules(ranges, 0.));
+  }
+}
+
+// Same query as BM_FindRulesInLane, reusing the views.
+void BM_FindRuleViewsInLane(benchmark::State& state) {
+  const std::unique_ptr<api::RoadNetwork> road_network = MakeRoadNetwork(static_cast<int>(state.range(0)));
+  const std::vector<api::LaneSRange> ranges = MakeQuery(*road_network);
+  const auto* rulebook = dynamic_cast<const ManualRulebook*>(road_network->rulebook());
+  ManualRulebook::QueryResultViews views;
+  for (auto _ : state) {
+    rulebook->FindRuleViews(ranges, 0., &views);
+    benchmark::DoNotOptimize(views.range_value_rules.data());
+  }
+}
+
+BENCHMARK(BM_FindRulesInLane)
+    ->ArgNames({"rules_per_lane"})
+    ->Arg(16)
+    ->Arg(256)
+    ->Arg(4096)
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(BM_FindRuleViewsInLane)
+    ->ArgNames({"rules_per_lane"})
+    ->Arg(16)
+    ->Arg(256)
+    ->Arg(4096)
+    ->Unit(benchmark::kMicrosecond);
+
+}  // namespace
+}  // namespace benchmarks
+}  // namespace maliput
@@ -0,0 +1,55 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2023, Woven by Toyota. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// Benchmarks the overhead of the built-in profiler, see maliput/common/builtin_profiler.h.
+
+#include <benchmark/benchmark.h>
+
+#include "maliput/common/builtin_profiler.h"
+
+namespace maliput {
+namespace benchmarks {
+namespace {
+
+// Records an empty scope, with recording enabled when the `enabled` argument is not zero.
+void BM_ProfileScope(benchmark::State& state) {
+  common::profiler::SetEnabled(state.range(0) != 0);
+  for (auto _ : state) {
+    common::profiler::ScopedProfile scope("BM_ProfileScope");
+    benchmark::ClobberMemory();
+  }
+  common::profiler::SetEnabled(false);
+  common::profiler::Reset();
+  state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_ProfileScope)->ArgName("enabled")->Arg(0)->Arg(1);
+
+}  // namespace
+}  // namespace benchmarks
+}  // namespace maliput
@@ -0,0 +1,66 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2023, Woven by Toyota. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// Benchmarks the validation of a grid city from test_utilities/procedural_road_network.h whose side, in
+// intersections, is the `grid` argument.
+
+#include <memory>
+
+#include <benchmark/benchmark.h>
+
+#include "maliput/api/road_network.h"
+#include "maliput/api/road_network_validator.h"
+#include "maliput/test_utilities/procedural_road_network.h"
+
+namespace maliput {
+namespace benchmarks {
+namespace {
+
+// Runs all the checks with `threads` threads.
+void BM_CheckRoadNetwork(benchmark::State& state) {
+  api::test::ProceduralRoadNetworkConfig config;
+  config.num_rows = static_cast<int>(state.range(0));
+  config.num_columns = static_cast<int>(state.range(0));
+  const std::unique_ptr<api::RoadNetwork> road_network = api::test::CreateProceduralRoadNetwork(config);
+  api::RoadNetworkValidatorOptions options;
+  options.num_threads = static_cast<std::size_t>(state.range(1));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(api::CheckRoadNetwork(*road_network, options));
+  }
+}
+
+BENCHMARK(BM_CheckRoadNetwork)
+    ->ArgNames({"grid", "threads"})
+    ->Args({16, 1})
+    ->Args({16, 4})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+}  // namespace
+}  // namespace benchmarks
+}  // namespace maliput
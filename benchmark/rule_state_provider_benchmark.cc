@@ -0,0 +1,147 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2023, Woven by Toyota. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// Benchmarks the rule state providers of a grid city from test_utilities/procedural_road_network.h whose side, in
+// intersections, is the `grid` argument.
+
+#include <memory>
+#include <optional>
+
+#include <benchmark/benchmark.h>
+
+#include "maliput/api/lane.h"
+#include "maliput/api/lane_data.h"
+#include "maliput/api/road_geometry.h"
+#include "maliput/api/road_network.h"
+#include "maliput/api/rules/phase_ring.h"
+#include "maliput/api/rules/phase_ring_book.h"
+#include "maliput/base/phased_discrete_rule_state_provider.h"
+#include "maliput/base/rule_registry.h"
+#include "maliput/test_utilities/procedural_road_network.h"
+
+namespace maliput {
+namespace benchmarks {
+namespace {
+
+std::unique_ptr<api::RoadNetwork> MakeRoadNetwork(int grid) {
+  api::test::ProceduralRoadNetworkConfig config;
+  config.num_rows = grid;
+  config.num_columns = grid;
+  return api::test::CreateProceduralRoadNetwork(config);
+}
+
+// Returns the middle of a lane of `road_network`.
+api::RoadPosition MakeRoadPosition(const api::RoadNetwork& road_network) {
+  const api::Lane* lane = road_network.road_geometry()->junction(0)->segment(0)->lane(0);
+  return api::RoadPosition(lane, api::LanePosition(lane->length() / 2., 0., 0.));
+}
+
+// Queries the DirectionUsage rule state at a position.
+void BM_DiscreteValueRuleStateAtPosition(benchmark::State& state) {
+  const std::unique_ptr<api::RoadNetwork> road_network = MakeRoadNetwork(static_cast<int>(state.range(0)));
+  const api::RoadPosition road_position = MakeRoadPosition(*road_network);
+  const auto* state_provider = road_network->discrete_value_rule_state_provider();
+  const api::rules::Rule::TypeId rule_type = DirectionUsageRuleTypeId();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(state_provider->GetState(road_position, rule_type, 0.));
+  }
+}
+
+// Queries the speed limit rule state at a position.
+void BM_RangeValueRuleStateAtPosition(benchmark::State& state) {
+  const std::unique_ptr<api::RoadNetwork> road_network = MakeRoadNetwork(static_cast<int>(state.range(0)));
+  const api::RoadPosition road_position = MakeRoadPosition(*road_network);
+  const auto* state_provider = road_network->range_value_rule_state_provider();
+  const api::rules::Rule::TypeId rule_type = SpeedLimitRuleTypeId();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(state_provider->GetState(road_position, rule_type, 0.));
+  }
+}
+
+// Queries the state of a right of way rule, which is driven by the phase ring of an intersection.
+void BM_PhasedDiscreteValueRuleState(benchmark::State& state) {
+  const std::unique_ptr<api::RoadNetwork> road_network = MakeRoadNetwork(static_cast<int>(state.range(0)));
+  const api::rules::PhaseRingBook* phase_ring_book = road_network->phase_ring_book();
+  const std::optional<api::rules::PhaseRing> ring = phase_ring_book->GetPhaseRing(phase_ring_book->GetPhaseRings()[0]);
+  const api::rules::Rule::Id rule_id = ring->phases().begin()->second.discrete_value_rule_states().begin()->first;
+  const auto* state_provider = road_network->discrete_value_rule_state_provider();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(state_provider->GetState(rule_id));
+  }
+}
+
+// Returns the state provider of `road_network`, which is a PhasedDiscreteRuleStateProvider.
+const PhasedDiscreteRuleStateProvider* GetPhasedStateProvider(api::RoadNetwork* road_network) {
+  return dynamic_cast<const PhasedDiscreteRuleStateProvider*>(road_network->discrete_value_rule_state_provider());
+}
+
+// Queries the state of every discrete value rule, one rule at a time.
+void BM_AllDiscreteValueRuleStatesById(benchmark::State& state) {
+  const std::unique_ptr<api::RoadNetwork> road_network = MakeRoadNetwork(static_cast<int>(state.range(0)));
+  const PhasedDiscreteRuleStateProvider* state_provider = GetPhasedStateProvider(road_network.get());
+  for (auto _ : state) {
+    for (const api::rules::Rule::Id& rule_id : state_provider->rule_ids()) {
+      benchmark::DoNotOptimize(state_provider->GetState(rule_id));
+    }
+  }
+  state.counters["rules"] = static_cast<double>(state_provider->rule_ids().size());
+}
+
+// Queries the state of every discrete value rule at once.
+void BM_AllDiscreteValueRuleStates(benchmark::State& state) {
+  const std::unique_ptr<api::RoadNetwork> road_network = MakeRoadNetwork(static_cast<int>(state.range(0)));
+  const PhasedDiscreteRuleStateProvider* state_provider = GetPhasedStateProvider(road_network.get());
+  PhasedDiscreteRuleStateProvider::StatesSnapshot snapshot;
+  for (auto _ : state) {
+    state_provider->GetAllStates(&snapshot);
+    benchmark::DoNotOptimize(snapshot.states.data());
+  }
+  state.counters["rules"] = static_cast<double>(state_provider->rule_ids().size());
+}
+
+// Queries the discrete value rules whose state changed since the previous query, while no state changes.
+void BM_DiscreteValueRuleStateChanges(benchmark::State& state) {
+  const std::unique_ptr<api::RoadNetwork> road_network = MakeRoadNetwork(static_cast<int>(state.range(0)));
+  const PhasedDiscreteRuleStateProvider* state_provider = GetPhasedStateProvider(road_network.get());
+  PhasedDiscreteRuleStateProvider::StateChanges changes;
+  for (auto _ : state) {
+    state_provider->GetStatesChangedSince(changes.version, &changes);
+    benchmark::DoNotOptimize(changes.indices.data());
+  }
+}
+
+BENCHMARK(BM_PhasedDiscreteValueRuleState)->ArgName("grid")->Arg(4)->Arg(16)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_DiscreteValueRuleStateAtPosition)->ArgName("grid")->Arg(4)->Arg(16)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_RangeValueRuleStateAtPosition)->ArgName("grid")->Arg(4)->Arg(16)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_AllDiscreteValueRuleStatesById)->ArgName("grid")->Arg(4)->Arg(16)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_AllDiscreteValueRuleStates)->ArgName("grid")->Arg(4)->Arg(16)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_DiscreteValueRuleStateChanges)->ArgName("grid")->Arg(4)->Arg(16)->Unit(benchmark::kMicrosecond);
+
+}  // namespace
+}  // namespace benchmarks
+}  // namespace maliput
@@ -29,7 +29,11 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #pragma once
 
+#include <cstdint>
+#include <mutex>
+#include <optional>
 #include <unordered_map>
+#include <vector>
 
 #include "maliput/api/branch_point.h"
 #include "maliput/api/junction.h"
@@ -43,6 +47,11 @@ namespace api {
 
 /// Basic general-purpose concrete implementation of the
 /// RoadGeometry::IdIndex interface.
+///
+/// Elements are assigned dense indices in the order they are added, so
+/// WalkAndAddAll() numbers Junctions, Segments and Lanes in the order of the
+/// RoadGeometry's object graph and BranchPoints in RoadGeometry::branch_point()
+/// order.
 class BasicIdIndex : public RoadGeometry::IdIndex {
  public:
   MALIPUT_NO_COPY_NO_MOVE_NO_ASSIGN(BasicIdIndex);
@@ -50,25 +59,25 @@ class BasicIdIndex : public RoadGeometry::IdIndex {
   BasicIdIndex() = default;
   ~BasicIdIndex() override = default;
 
-  /// Adds @p lane to the index.
+  /// Adds @p lane to the index, with the next dense index.
   ///
   /// @throws std::exception if @p lane's id() already exists in the index.
   /// @pre @p lane is not nullptr.
   void AddLane(const Lane* lane);
 
-  /// Adds @p segment to the index.
+  /// Adds @p segment to the index, with the next dense index.
   ///
   /// @throws std::exception if @p segment's id() already exists in the index.
   /// @pre @p segment is not nullptr.
   void AddSegment(const Segment* segment);
 
-  /// Adds @p junction to the index.
+  /// Adds @p junction to the index, with the next dense index.
   ///
   /// @throws std::exception if @p junction's id() already exists in the index.
   /// @pre @p junction is not nullptr.
   void AddJunction(const Junction* junction);
 
-  /// Adds @p branch_point to the index.
+  /// Adds @p branch_point to the index, with the next dense index.
   ///
   /// @throws std::exception if @p branch_point's id() already exists in the
   /// index.
@@ -89,11 +98,41 @@ class BasicIdIndex : public RoadGeometry::IdIndex {
   const Segment* DoGetSegment(const SegmentId& id) const final;
   const Junction* DoGetJunction(const JunctionId& id) const final;
   const BranchPoint* DoGetBranchPoint(const BranchPointId& id) const final;
+  std::optional<uint32_t> DoGetLaneIndex(const LaneId& id) const final;
+  const Lane* DoGetLaneByIndex(uint32_t index) const final;
+  uint32_t do_num_lane_indices() const final;
+  std::optional<uint32_t> DoGetSegmentIndex(const SegmentId& id) const final;
+  const Segment* DoGetSegmentByIndex(uint32_t index) const final;
+  uint32_t do_num_segment_indices() const final;
+  std::optional<uint32_t> DoGetJunctionIndex(const JunctionId& id) const final;
+  const Junction* DoGetJunctionByIndex(uint32_t index) const final;
+  uint32_t do_num_junction_indices() const final;
+  std::optional<uint32_t> DoGetBranchPointIndex(const BranchPointId& id) const final;
+  const BranchPoint* DoGetBranchPointByIndex(uint32_t index) const final;
+  uint32_t do_num_branch_point_indices() const final;
 
-  std::unordered_map<JunctionId, const Junction*> junction_map_;
-  std::unordered_map<SegmentId, const Segment*> segment_map_;
-  std::unordered_map<LaneId, const Lane*> lane_map_;
-  std::unordered_map<BranchPointId, const BranchPoint*> branch_point_map_;
+  // Holds the elements of type T in the order they were added, which is their
+  // dense index, and the dense index of each id.
+  template <typename T>
+  struct DenseIndex {
+    // @throws std::exception if @p element's id() already exists.
+    void Add(const T* element);
+    std::optional<uint32_t> GetIndex(const TypeSpecificIdentifier<T>& id) const;
+    const T* Get(const TypeSpecificIdentifier<T>& id) const;
+    const T* GetByIndex(uint32_t index) const;
+
+    std::unordered_map<TypeSpecificIdentifier<T>, uint32_t> indices;
+    std::vector<const T*> elements;
+  };
+
+  DenseIndex<Junction> junctions_;
+  DenseIndex<Segment> segments_;
+  DenseIndex<Lane> lanes_;
+  DenseIndex<BranchPoint> branch_points_;
+  // Backs DoGetLanes(), which returns the Lanes keyed by id. Lookups are served by `lanes_`, so the map is only
+  // built, from `lanes_.elements`, the first time DoGetLanes() is called after Lanes are added.
+  mutable std::mutex lane_map_mutex_;
+  mutable std::unordered_map<LaneId, const Lane*> lane_map_;
 };
 
 }  // namespace api
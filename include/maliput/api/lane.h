@@ -32,6 +32,7 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <vector>
 
 #include "maliput/api/lane_data.h"
 #include "maliput/api/type_specific_identifier.h"
@@ -158,6 +159,31 @@ class Lane {
   /// `Inertial`-frame basis.
   Rotation GetOrientation(const LanePosition& lane_pos) const;
 
+  /// @name Batch conversions
+  ///
+  /// Batched versions of ToInertialPosition(), GetOrientation() and
+  /// ToLanePosition(): the i-th element of the returned vector is equivalent
+  /// to calling the single-point method with the i-th input, and the
+  /// preconditions of the single-point method apply to every input.
+  ///
+  /// They dispatch once per batch, so backends can amortize the evaluation of
+  /// their reference curves across the points (e.g. with vectorized code).
+  /// By default, they loop over the single-point implementations.
+  ///@{
+
+  /// Returns the InertialPosition corresponding to each LanePosition in
+  /// @p lane_positions. @see ToInertialPosition().
+  std::vector<InertialPosition> ToInertialPositions(const std::vector<LanePosition>& lane_positions) const;
+
+  /// Returns the orientation of the `Lane`-frame basis at each LanePosition
+  /// in @p lane_positions. @see GetOrientation().
+  std::vector<Rotation> GetOrientations(const std::vector<LanePosition>& lane_positions) const;
+
+  /// Determines the LanePosition corresponding to each InertialPosition in
+  /// @p inertial_positions. @see ToLanePosition().
+  std::vector<LanePositionResult> ToLanePositions(const std::vector<InertialPosition>& inertial_positions) const;
+  ///@}
+
   /// Computes derivatives of LanePosition given a velocity vector @p velocity.
   /// @p velocity is a isometric velocity vector oriented in the `Lane`-frame
   /// at @p position.
@@ -230,6 +256,15 @@ class Lane {
   virtual const LaneEndSet* DoGetOngoingBranches(const LaneEnd::Which which_end) const = 0;
 
   virtual std::optional<LaneEnd> DoGetDefaultBranch(const LaneEnd::Which which_end) const = 0;
+
+  // The batch conversions default to a loop over the single-point
+  // implementations.
+  virtual std::vector<InertialPosition> DoToInertialPositions(const std::vector<LanePosition>& lane_positions) const;
+
+  virtual std::vector<Rotation> DoGetOrientations(const std::vector<LanePosition>& lane_positions) const;
+
+  virtual std::vector<LanePositionResult> DoToLanePositions(
+      const std::vector<InertialPosition>& inertial_positions) const;
   ///@}
 };
 
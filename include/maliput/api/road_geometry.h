@@ -29,6 +29,8 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
 #include <optional>
 #include <string>
 #include <unordered_map>
@@ -54,6 +56,50 @@ class Junction;
 /// Persistent identifier for a RoadGeometry element.
 using RoadGeometryId = TypeSpecificIdentifier<class RoadGeometry>;
 
+/// A violation of the invariants verified by RoadGeometry::FindInvariantViolations().
+struct InvariantViolation {
+  /// Kinds of violations.
+  enum class Type {
+    /// A BranchPoint claims to be owned by another RoadGeometry.
+    kBranchPointOwnership,
+    /// A Junction claims to be owned by another RoadGeometry.
+    kJunctionOwnership,
+    /// A Segment claims to be owned by another Junction.
+    kSegmentOwnership,
+    /// A Lane claims to be owned by another Segment.
+    kLaneOwnership,
+    /// A Lane claims an index other than its index in its Segment.
+    kLaneIndex,
+    /// A BranchPoint has no LaneEnds.
+    kEmptyBranchPoint,
+    /// A LaneEnd is farther than the linear tolerance from the reference LaneEnd of its BranchPoint.
+    kLaneEndPosition,
+    /// A LaneEnd is farther than the angular tolerance from the orientation of the reference LaneEnd of its
+    /// BranchPoint.
+    kLaneEndOrientation,
+  };
+
+  /// The kind of violation.
+  Type type{};
+  /// Id of the offending element: the BranchPoint, Junction, Segment or Lane the type refers to. For
+  /// Type::kLaneEndPosition and Type::kLaneEndOrientation, it is the id of the Lane of the offending LaneEnd.
+  std::string id;
+  /// Id of the element @ref id is compared with: the owner for ownership violations, the BranchPoint for
+  /// Type::kEmptyBranchPoint and the Lane of the reference LaneEnd for Type::kLaneEndPosition and
+  /// Type::kLaneEndOrientation. It is empty for Type::kLaneIndex.
+  std::string reference_id;
+  /// Ends of the offending and reference LaneEnds for Type::kLaneEndPosition and Type::kLaneEndOrientation.
+  std::optional<LaneEnd::Which> end;
+  std::optional<LaneEnd::Which> reference_end;
+  /// Measured error: the distance, in meters, for Type::kLaneEndPosition and the angle between the orientations, in
+  /// radians, for Type::kLaneEndOrientation. Zero otherwise.
+  double error{0.};
+  /// Index the Lane claims to have, for Type::kLaneIndex.
+  std::optional<int> claimed_index;
+  /// Description of the violation, as returned by RoadGeometry::CheckInvariants().
+  std::string message;
+};
+
 // TODO(maddog@tri.global)  This entire API should be templated on a
 //                          scalar type T.
 /// Abstract API for the geometry of a road network, including both
@@ -140,6 +186,29 @@ class RoadGeometry {
   RoadPositionResult ToRoadPosition(const InertialPosition& inertial_position,
                                     const std::optional<RoadPosition>& hint = std::nullopt) const;
 
+  /// Determines the RoadPositions corresponding to each InertialPosition in @p inertial_positions.
+  ///
+  /// This is the batched version of ToRoadPosition(): the i-th element of the
+  /// returned vector is equivalent to `ToRoadPosition(inertial_positions[i], hints[i])`.
+  /// Implementations may resolve the queries concurrently, so the
+  /// per-query overhead is amortized across the batch.
+  ///
+  /// @param inertial_positions The InertialPositions to be converted.
+  /// @param hints One optional RoadPosition hint per element in @p inertial_positions.
+  ///        When empty, no hint is used for any query.
+  /// @param num_threads The maximum number of threads the implementation may
+  ///        use to resolve the batch. It must be positive. The default
+  ///        implementation resolves the queries sequentially and ignores it.
+  /// @return A vector of RoadPositionResults, one per element in @p inertial_positions
+  ///         and in the same order.
+  ///
+  /// @throws maliput::common::assertion_error When @p hints is not empty and its
+  ///         size differs from @p inertial_positions' size.
+  /// @throws maliput::common::assertion_error When @p num_threads is zero.
+  std::vector<RoadPositionResult> ToRoadPositions(const std::vector<InertialPosition>& inertial_positions,
+                                                  const std::vector<std::optional<RoadPosition>>& hints = {},
+                                                  std::size_t num_threads = 1) const;
+
   /// Obtains all RoadPositions within @p radius of @p inertial_position. Only Lanes
   /// whose segment regions include points that are within @p radius of
   /// @p inertial_position are included in the search. For each of these Lanes,
@@ -179,6 +248,18 @@ class RoadGeometry {
   /// Return value with size() == 0 indicates success.
   std::vector<std::string> CheckInvariants() const;
 
+  /// Verifies the invariants of CheckInvariants() using up to @p num_threads threads.
+  ///
+  /// BranchPoints and Junctions are partitioned across the threads, and the position and orientation of each
+  /// LaneEnd are evaluated once. Violations are reported in the same order as in CheckInvariants(), regardless of
+  /// @p num_threads.
+  ///
+  /// @param num_threads Number of threads. When it is greater than one, the const queries of the elements of this
+  /// RoadGeometry must be thread-safe.
+  /// @returns The violations of the invariants. An empty vector indicates success.
+  /// @throws maliput::common::assertion_error When @p num_threads is zero.
+  std::vector<InvariantViolation> FindInvariantViolations(std::size_t num_threads = 1) const;
+
   /// Samples `lane_s_route` at `path_length_sampling_rate` and converts those
   /// LanePositions into InertialPositions.
   ///
@@ -234,6 +315,13 @@ class RoadGeometry {
   virtual RoadPositionResult DoToRoadPosition(const InertialPosition& inertial_position,
                                               const std::optional<RoadPosition>& hint) const = 0;
 
+  // The default implementation calls DoToRoadPosition() for each query sequentially.
+  // @pre `hints` is either empty or it has the same size as `inertial_positions`.
+  // @pre `num_threads` is positive.
+  virtual std::vector<RoadPositionResult> DoToRoadPositions(
+      const std::vector<InertialPosition>& inertial_positions,
+      const std::vector<std::optional<RoadPosition>>& hints, std::size_t num_threads) const;
+
   virtual std::vector<RoadPositionResult> DoFindRoadPositions(const InertialPosition& inertial_position,
                                                               double radius) const = 0;
 
@@ -276,6 +364,63 @@ class RoadGeometry::IdIndex {
   /// unknown.
   const BranchPoint* GetBranchPoint(const BranchPointId& id) const;
 
+  /// @name Dense indices
+  ///
+  /// Implementations may assign each Lane, Segment, Junction and BranchPoint
+  /// a dense index: a consecutive integer, starting at zero, that is unique
+  /// among the elements of its kind and stable for the lifetime of the
+  /// IdIndex. Resolving an id to its index once lets clients keep per-element
+  /// data in vectors instead of maps keyed by the (string) id.
+  ///
+  /// Implementations that do not assign dense indices report zero elements,
+  /// return std::nullopt for every id and `nullptr` for every index.
+  ///@{
+
+  /// Returns the dense index of the Lane identified by @p id, or std::nullopt
+  /// if @p id is unknown.
+  std::optional<uint32_t> GetLaneIndex(const LaneId& id) const;
+
+  /// Returns the Lane whose dense index is @p index, or `nullptr` if @p index
+  /// is not smaller than num_lane_indices().
+  const Lane* GetLaneByIndex(uint32_t index) const;
+
+  /// Returns the number of Lanes with a dense index.
+  uint32_t num_lane_indices() const;
+
+  /// Returns the dense index of the Segment identified by @p id, or
+  /// std::nullopt if @p id is unknown.
+  std::optional<uint32_t> GetSegmentIndex(const SegmentId& id) const;
+
+  /// Returns the Segment whose dense index is @p index, or `nullptr` if
+  /// @p index is not smaller than num_segment_indices().
+  const Segment* GetSegmentByIndex(uint32_t index) const;
+
+  /// Returns the number of Segments with a dense index.
+  uint32_t num_segment_indices() const;
+
+  /// Returns the dense index of the Junction identified by @p id, or
+  /// std::nullopt if @p id is unknown.
+  std::optional<uint32_t> GetJunctionIndex(const JunctionId& id) const;
+
+  /// Returns the Junction whose dense index is @p index, or `nullptr` if
+  /// @p index is not smaller than num_junction_indices().
+  const Junction* GetJunctionByIndex(uint32_t index) const;
+
+  /// Returns the number of Junctions with a dense index.
+  uint32_t num_junction_indices() const;
+
+  /// Returns the dense index of the BranchPoint identified by @p id, or
+  /// std::nullopt if @p id is unknown.
+  std::optional<uint32_t> GetBranchPointIndex(const BranchPointId& id) const;
+
+  /// Returns the BranchPoint whose dense index is @p index, or `nullptr` if
+  /// @p index is not smaller than num_branch_point_indices().
+  const BranchPoint* GetBranchPointByIndex(uint32_t index) const;
+
+  /// Returns the number of BranchPoints with a dense index.
+  uint32_t num_branch_point_indices() const;
+  ///@}
+
  protected:
   IdIndex() = default;
 
@@ -285,6 +430,21 @@ class RoadGeometry::IdIndex {
   virtual const Segment* DoGetSegment(const SegmentId& id) const = 0;
   virtual const Junction* DoGetJunction(const JunctionId& id) const = 0;
   virtual const BranchPoint* DoGetBranchPoint(const BranchPointId& id) const = 0;
+
+  // Dense index support is optional. The default implementations do not
+  // assign any index.
+  virtual std::optional<uint32_t> DoGetLaneIndex(const LaneId&) const { return std::nullopt; }
+  virtual const Lane* DoGetLaneByIndex(uint32_t) const { return nullptr; }
+  virtual uint32_t do_num_lane_indices() const { return 0; }
+  virtual std::optional<uint32_t> DoGetSegmentIndex(const SegmentId&) const { return std::nullopt; }
+  virtual const Segment* DoGetSegmentByIndex(uint32_t) const { return nullptr; }
+  virtual uint32_t do_num_segment_indices() const { return 0; }
+  virtual std::optional<uint32_t> DoGetJunctionIndex(const JunctionId&) const { return std::nullopt; }
+  virtual const Junction* DoGetJunctionByIndex(uint32_t) const { return nullptr; }
+  virtual uint32_t do_num_junction_indices() const { return 0; }
+  virtual std::optional<uint32_t> DoGetBranchPointIndex(const BranchPointId&) const { return std::nullopt; }
+  virtual const BranchPoint* DoGetBranchPointByIndex(uint32_t) const { return nullptr; }
+  virtual uint32_t do_num_branch_point_indices() const { return 0; }
 };
 
 }  // namespace api
@@ -29,6 +29,11 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #pragma once
 
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <vector>
+
 #include "maliput/api/road_network.h"
 
 namespace maliput {
@@ -74,13 +79,52 @@ struct RoadNetworkValidatorOptions {
   /// Whether to check  rules::DiscreteValueRule::Rule::State::related_rules
   /// exist in RoadRulebook.
   bool check_related_rules{true};
+  /// Number of threads used to run the checks. Independent checks run concurrently and the per-Lane and per-rule
+  /// loops are partitioned across the threads. When it is greater than one, the const queries of the RoadNetwork
+  /// must be thread-safe.
+  std::size_t num_threads{1};
+};
+
+/// Outcome of a single check of CheckRoadNetwork().
+struct RoadNetworkCheckResult {
+  /// Name of the check, which is the name of its flag in RoadNetworkValidatorOptions, e.g.
+  /// "check_road_geometry_hierarchy".
+  std::string name;
+  /// Descriptions of the violations found by the check.
+  std::vector<std::string> violations;
+  /// Time spent running the check, summed across the threads that ran it.
+  std::chrono::duration<double> duration{};
+};
+
+/// Outcome of CheckRoadNetwork().
+struct RoadNetworkValidationReport {
+  /// @returns Whether none of the checks found violations.
+  bool is_valid() const;
+
+  /// @returns The violations of all the checks, prefixed by the name of the check that found them.
+  std::vector<std::string> violations() const;
+
+  /// Results of the enabled checks, in the order of their flags in RoadNetworkValidatorOptions.
+  std::vector<RoadNetworkCheckResult> checks;
+  /// Wall-clock time of the validation.
+  std::chrono::duration<double> duration{};
 };
 
+/// Runs the checks enabled in @p options on @p road_network and reports every violation found.
+///
+/// @param road_network The RoadNetwork to check.
+/// @param options Options for selecting what aspects of RoadNetwork to check.
+/// @returns The violations found and the time spent by each check.
+/// @throws maliput::common::assertion_error When `options.num_threads` is zero.
+RoadNetworkValidationReport CheckRoadNetwork(const RoadNetwork& road_network,
+                                             const RoadNetworkValidatorOptions& options);
+
 /// Validates a RoadNetwork.
 ///
 /// @param road_network The RoadNetwork to validate.
 /// @param options Options for selecting what aspects of RoadNetwork to check.
-/// @throws maliput::common::assertion_error When @p road_network is not valid.
+/// @throws maliput::common::assertion_error When @p road_network is not valid. The message lists all the violations,
+/// see CheckRoadNetwork().
 void ValidateRoadNetwork(const RoadNetwork& road_network, const RoadNetworkValidatorOptions& options);
 
 }  // namespace api
@@ -37,6 +37,7 @@
 #include "maliput/api/rules/rule.h"
 #include "maliput/common/maliput_copyable.h"
 #include "maliput/common/maliput_deprecated.h"
+#include "maliput/common/maliput_throw.h"
 
 namespace maliput {
 namespace api {
@@ -66,6 +67,36 @@ class PhaseRingBook {
   /// Rule. Returns std::nullopt if @p rule_id is unrecognized.
   std::optional<PhaseRing> FindPhaseRing(const Rule::Id& rule_id) const { return DoFindPhaseRing(rule_id); }
 
+  /// Gets the specified PhaseRing without copying it when the implementation
+  /// stores it. Otherwise, the PhaseRing is copied into @p storage.
+  ///
+  /// @param ring_id The ID of the PhaseRing to get.
+  /// @param storage Holds the PhaseRing when the implementation needs to copy
+  ///        it. It must not be nullptr.
+  /// @returns A pointer to the PhaseRing, or nullptr if @p ring_id is
+  ///          unrecognized. It is valid as long as both this PhaseRingBook and
+  ///          @p storage are alive and unmodified.
+  /// @throws common::assertion_error When @p storage is nullptr.
+  const PhaseRing* GetPhaseRingView(const PhaseRing::Id& ring_id, std::optional<PhaseRing>* storage) const {
+    MALIPUT_THROW_UNLESS(storage != nullptr);
+    return DoGetPhaseRingView(ring_id, storage);
+  }
+
+  /// Same as GetPhaseRingView(), for the PhaseRing containing the specified
+  /// RightOfWayRule.
+  MALIPUT_DEPRECATED("RightOfWayRule class will be deprecated.")
+  const PhaseRing* FindPhaseRingView(const RightOfWayRule::Id& rule_id, std::optional<PhaseRing>* storage) const {
+    MALIPUT_THROW_UNLESS(storage != nullptr);
+    return DoFindPhaseRingView(rule_id, storage);
+  }
+
+  /// Same as GetPhaseRingView(), for the PhaseRing containing the specified
+  /// Rule.
+  const PhaseRing* FindPhaseRingView(const Rule::Id& rule_id, std::optional<PhaseRing>* storage) const {
+    MALIPUT_THROW_UNLESS(storage != nullptr);
+    return DoFindPhaseRingView(rule_id, storage);
+  }
+
  protected:
   PhaseRingBook() = default;
 
@@ -80,6 +111,27 @@ class PhaseRingBook {
 #pragma GCC diagnostic pop
 
   virtual std::optional<PhaseRing> DoFindPhaseRing(const Rule::Id& rule_id) const = 0;
+
+  // Default implementations copy the PhaseRing into `storage`. Implementations
+  // that store their rings should override them to return the stored ones.
+  virtual const PhaseRing* DoGetPhaseRingView(const PhaseRing::Id& ring_id, std::optional<PhaseRing>* storage) const {
+    *storage = DoGetPhaseRing(ring_id);
+    return storage->has_value() ? &storage->value() : nullptr;
+  }
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+  virtual const PhaseRing* DoFindPhaseRingView(const RightOfWayRule::Id& rule_id,
+                                               std::optional<PhaseRing>* storage) const {
+    *storage = DoFindPhaseRing(rule_id);
+    return storage->has_value() ? &storage->value() : nullptr;
+  }
+#pragma GCC diagnostic pop
+
+  virtual const PhaseRing* DoFindPhaseRingView(const Rule::Id& rule_id, std::optional<PhaseRing>* storage) const {
+    *storage = DoFindPhaseRing(rule_id);
+    return storage->has_value() ? &storage->value() : nullptr;
+  }
 };
 
 }  // namespace rules
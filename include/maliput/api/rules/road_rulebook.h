@@ -29,7 +29,9 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #pragma once
 
+#include <cstddef>
 #include <map>
+#include <optional>
 #include <vector>
 
 #include "maliput/api/regions.h"
@@ -121,6 +123,12 @@ class RoadRulebook {
   /// @throws std::out_of_range if `id` is unknown.
   RangeValueRule GetRangeValueRule(const Rule::Id& id) const { return DoGetRangeValueRule(id); }
 
+  /// Returns a number that changes every time the rules change, so clients
+  /// caching data derived from the rules know when to refresh it, or
+  /// std::nullopt when the implementation does not track its changes. In the
+  /// latter case the rules may change at any time.
+  std::optional<std::size_t> revision() const { return do_revision(); }
+
  protected:
   RoadRulebook() = default;
 
@@ -140,6 +148,9 @@ class RoadRulebook {
   virtual DiscreteValueRule DoGetDiscreteValueRule(const Rule::Id& id) const = 0;
   virtual RangeValueRule DoGetRangeValueRule(const Rule::Id& id) const = 0;
   //@}
+
+  // Changes are not tracked by default.
+  virtual std::optional<std::size_t> do_revision() const { return std::nullopt; }
 };
 
 }  // namespace rules
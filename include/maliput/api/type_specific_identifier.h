@@ -36,6 +36,7 @@
 #include "maliput/common/maliput_copyable.h"
 #include "maliput/common/maliput_hash.h"
 #include "maliput/common/maliput_throw.h"
+#include "maliput/common/shared_string.h"
 
 namespace maliput {
 namespace api {
@@ -63,6 +64,13 @@ namespace api {
 ///
 /// %TypeSpecificIdentifier also provides a specialization of std::hash to make
 /// it easy to use with std::unordered_set and std::unordered_map.
+///
+/// The string is held in a common::SharedString, so %TypeSpecificIdentifiers
+/// are pointer-sized, copying one increments a reference count instead of
+/// allocating and the hash is computed once, on construction. Identifiers
+/// created with Interned() share the instance of equal interned identifiers,
+/// which makes equality between them a pointer comparison; other identifiers
+/// compare their cached hashes before their strings.
 template <typename T>
 class TypeSpecificIdentifier {
  public:
@@ -74,12 +82,23 @@ class TypeSpecificIdentifier {
   /// Constructs a %TypeSpecificIdentifier from the given `string`.
   ///
   /// @throws maliput::common::assertion_error if `string` is empty.
-  explicit TypeSpecificIdentifier(std::string string) : string_(std::move(string)) {
-    MALIPUT_THROW_UNLESS(!string_.empty());
+  explicit TypeSpecificIdentifier(std::string string) {
+    MALIPUT_THROW_UNLESS(!string.empty());
+    string_ = common::SharedString(std::move(string));
+  }
+
+  /// Constructs a %TypeSpecificIdentifier from the given `string`, interning
+  /// it with common::SharedString::Intern(). Prefer it for identifiers that are
+  /// long-lived and compared often, e.g. those of a RoadGeometry.
+  ///
+  /// @throws maliput::common::assertion_error if `string` is empty.
+  static TypeSpecificIdentifier Interned(std::string string) {
+    MALIPUT_THROW_UNLESS(!string.empty());
+    return TypeSpecificIdentifier(common::SharedString::Intern(std::move(string)));
   }
 
   /// Returns the string representation of the %TypeSpecificIdentifier.
-  const std::string& string() const { return string_; }
+  const std::string& string() const { return string_.string(); }
 
   /// Tests for equality with another %TypeSpecificIdentifier.
   bool operator==(const TypeSpecificIdentifier<T>& rhs) const { return string_ == rhs.string_; }
@@ -92,11 +111,15 @@ class TypeSpecificIdentifier {
   template <class HashAlgorithm>
   friend void hash_append(HashAlgorithm& hasher, const TypeSpecificIdentifier& item) noexcept {
     using maliput::common::hash_append;
-    hash_append(hasher, item.string_);
+    hash_append(hasher, item.string());
   }
 
  private:
-  std::string string_;
+  friend struct std::hash<TypeSpecificIdentifier<T>>;
+
+  explicit TypeSpecificIdentifier(common::SharedString string) : string_(std::move(string)) {}
+
+  common::SharedString string_;
 };
 
 }  // namespace api
@@ -105,8 +128,14 @@ class TypeSpecificIdentifier {
 namespace std {
 
 /// Specialization of std::hash for maliput::api::TypeSpecificIdentifier<T>.
+/// It returns the same value as maliput::common::DefaultHash, cached when the
+/// identifier was constructed.
 template <typename T>
-struct hash<maliput::api::TypeSpecificIdentifier<T>> : public maliput::common::DefaultHash {};
+struct hash<maliput::api::TypeSpecificIdentifier<T>> {
+  size_t operator()(const maliput::api::TypeSpecificIdentifier<T>& id) const noexcept {
+    return id.string_.hash();
+  }
+};
 
 /// Specialization of std::less for maliput::api::TypeSpecificIdentifier<T>
 /// providing a strict ordering over maliput::api::TypeSpecificIdentifier<T>
@@ -115,7 +144,7 @@ template <typename T>
 struct less<maliput::api::TypeSpecificIdentifier<T>> {
   bool operator()(const maliput::api::TypeSpecificIdentifier<T>& lhs,
                   const maliput::api::TypeSpecificIdentifier<T>& rhs) const {
-    return lhs.string() < rhs.string();
+    return lhs != rhs && lhs.string() < rhs.string();
   }
 };
 
@@ -29,15 +29,18 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #pragma once
 
+#include <cstddef>
 #include <map>
 #include <optional>
-#include <unordered_map>
+#include <vector>
 
 #include "maliput/api/lane_data.h"
 #include "maliput/api/rules/discrete_value_rule.h"
 #include "maliput/api/rules/discrete_value_rule_state_provider.h"
 #include "maliput/api/rules/road_rulebook.h"
 #include "maliput/api/rules/rule.h"
+#include "maliput/base/rule_state_tracker.h"
+#include "maliput/base/rule_zone_index.h"
 #include "maliput/common/maliput_copyable.h"
 #include "maliput/common/maliput_throw.h"
 
@@ -50,6 +53,12 @@ class ManualDiscreteValueRuleStateProvider : public api::rules::DiscreteValueRul
  public:
   MALIPUT_NO_COPY_NO_MOVE_NO_ASSIGN(ManualDiscreteValueRuleStateProvider)
 
+  /// The states of all the rules, see GetAllStates().
+  using StatesSnapshot = RuleStatesSnapshot<api::rules::DiscreteValueRuleStateProvider::StateResult>;
+
+  /// The states that changed since a version, see GetStatesChangedSince().
+  using StateChanges = RuleStateChanges<api::rules::DiscreteValueRuleStateProvider::StateResult>;
+
   /// Constructs a ManualDiscreteValueRuleStateProvider.
   ///
   /// @param rulebook A rulebook pointer to validate Rule::Id and their states.
@@ -57,7 +66,7 @@ class ManualDiscreteValueRuleStateProvider : public api::rules::DiscreteValueRul
   ///
   /// @throws common::assertion_error When `rulebook` is nullptr.
   explicit ManualDiscreteValueRuleStateProvider(const api::rules::RoadRulebook* rulebook)
-      : api::rules::DiscreteValueRuleStateProvider(), rulebook_(rulebook) {
+      : api::rules::DiscreteValueRuleStateProvider(), rulebook_(rulebook), rule_zone_index_(rulebook) {
     MALIPUT_THROW_UNLESS(rulebook_ != nullptr);
   }
 
@@ -94,6 +103,33 @@ class ManualDiscreteValueRuleStateProvider : public api::rules::DiscreteValueRul
                 const std::optional<api::rules::DiscreteValueRule::DiscreteValue>& next_state,
                 const std::optional<double>& duration_until);
 
+  /// Returns the IDs of the rules in the bulk state queries: the rules given
+  /// a state with SetState(), in the order they were first given one.
+  /// Subclasses may add more rules. The index of a rule never changes.
+  const std::vector<api::rules::Rule::Id>& rule_ids() const { return states_.rule_ids(); }
+
+  /// Fills `snapshot` with the current state of every rule in rule_ids(), in
+  /// one pass. Reusing `snapshot` across calls saves allocations.
+  ///
+  /// @throws common::assertion_error When `snapshot` is nullptr.
+  void GetAllStates(StatesSnapshot* snapshot) const;
+
+  /// Convenience overload of GetAllStates() that returns the snapshot.
+  StatesSnapshot GetAllStates() const;
+
+  /// Fills `changes` with the current state of the rules in rule_ids() whose
+  /// state changed after `version`.
+  ///
+  /// States are sampled by this method and GetAllStates(). A rule counts as
+  /// changed when its state, next state or duration until the next state
+  /// differs from the previous sample, so changes reverted between two calls
+  /// are not reported. Passing the version returned by the previous call
+  /// yields the changes since that call, while passing zero yields every rule
+  /// with a state.
+  ///
+  /// @throws common::assertion_error When `changes` is nullptr.
+  void GetStatesChangedSince(std::size_t version, StateChanges* changes) const;
+
  protected:
   // This function has been marked as virtual because other providers might
   // benefit from injecting their own getter and then forwarding calls to this
@@ -112,15 +148,37 @@ class ManualDiscreteValueRuleStateProvider : public api::rules::DiscreteValueRul
   std::map<api::rules::DiscreteValueRule::Id, api::rules::DiscreteValueRule> GetFilteredDiscreteValueRules(
       const api::RoadPosition& road_position, const api::rules::Rule::TypeId& rule_type, double tolerance) const;
 
+  // Adds `id` to rule_ids(), if it is not there yet.
+  // @returns The index of `id` in rule_ids().
+  std::size_t RegisterRule(const api::rules::Rule::Id& id) { return states_.Register(id); }
+
+  // @returns The index of `id` in rule_ids(), or std::nullopt if it is not there.
+  std::optional<std::size_t> RuleIndex(const api::rules::Rule::Id& id) const { return states_.IndexOf(id); }
+
+  // Writes the current state of every rule in rule_ids() to `states`, which is as large as rule_ids() and may hold
+  // earlier states to overwrite. Subclasses that derive states from other sources should override it.
+  virtual void DoGetAllStates(std::vector<std::optional<api::rules::DiscreteValueRuleStateProvider::StateResult>>*
+                                  states) const;
+
+  // Writes to `state` the state set with SetState() for the rule at `index` in rule_ids(), or std::nullopt when
+  // there is none.
+  void GetManualState(std::size_t index,
+                      std::optional<api::rules::DiscreteValueRuleStateProvider::StateResult>* state) const {
+    states_.GetSetState(index, state);
+  }
+
   const api::rules::RoadRulebook* rulebook_{nullptr};
 
+  // Finds the rules that apply to a position without going through every rule in `rulebook_`.
+  const RuleZoneIndex<api::rules::DiscreteValueRule> rule_zone_index_;
+
  private:
   // @throws common::assertion_error When @p state is unrecognized in
   //         @p discrete_value_rule's values.
   void ValidateRuleState(const api::rules::DiscreteValueRule& discrete_value_rule,
                          const api::rules::DiscreteValueRule::DiscreteValue& state) const;
 
-  std::unordered_map<api::rules::Rule::Id, api::rules::DiscreteValueRuleStateProvider::StateResult> states_;
+  ManualRuleStates<api::rules::DiscreteValueRuleStateProvider::StateResult> states_;
 };
 
 }  // namespace maliput
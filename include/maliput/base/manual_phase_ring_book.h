@@ -66,6 +66,28 @@ class ManualPhaseRingBook : public api::rules::PhaseRingBook {
   /// exist.
   void RemovePhaseRing(const api::rules::PhaseRing::Id& ring_id);
 
+  using api::rules::PhaseRingBook::FindPhaseRingView;
+  using api::rules::PhaseRingBook::GetPhaseRingView;
+
+  /// Returns the api::rules::PhaseRing with an ID of @p ring_id, or nullptr
+  /// if it does not exist. Unlike GetPhaseRing(), the ring is not copied. The
+  /// pointer is invalidated when the ring is removed.
+  const api::rules::PhaseRing* GetPhaseRingView(const api::rules::PhaseRing::Id& ring_id) const;
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+  /// Returns the api::rules::PhaseRing that contains the RightOfWayRule with
+  /// an ID of @p rule_id, or nullptr if there is none. Unlike FindPhaseRing(),
+  /// the ring is not copied. The pointer is invalidated when the ring is
+  /// removed.
+  const api::rules::PhaseRing* FindPhaseRingView(const api::rules::RightOfWayRule::Id& rule_id) const;
+#pragma GCC diagnostic pop
+
+  /// Returns the api::rules::PhaseRing that contains the Rule with an ID of
+  /// @p rule_id, or nullptr if there is none. Unlike FindPhaseRing(), the ring
+  /// is not copied. The pointer is invalidated when the ring is removed.
+  const api::rules::PhaseRing* FindPhaseRingView(const api::rules::Rule::Id& rule_id) const;
+
  private:
   std::vector<api::rules::PhaseRing::Id> DoGetPhaseRings() const override;
 
@@ -78,6 +100,18 @@ class ManualPhaseRingBook : public api::rules::PhaseRingBook {
 
   std::optional<api::rules::PhaseRing> DoFindPhaseRing(const api::rules::Rule::Id& rule_id) const override;
 
+  const api::rules::PhaseRing* DoGetPhaseRingView(const api::rules::PhaseRing::Id& ring_id,
+                                                  std::optional<api::rules::PhaseRing>*) const override;
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+  const api::rules::PhaseRing* DoFindPhaseRingView(const api::rules::RightOfWayRule::Id& rule_id,
+                                                   std::optional<api::rules::PhaseRing>*) const override;
+#pragma GCC diagnostic pop
+
+  const api::rules::PhaseRing* DoFindPhaseRingView(const api::rules::Rule::Id& rule_id,
+                                                   std::optional<api::rules::PhaseRing>*) const override;
+
   class Impl;
   std::unique_ptr<Impl> impl_;
 };
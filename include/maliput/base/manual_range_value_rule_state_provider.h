@@ -29,13 +29,16 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #pragma once
 
+#include <cstddef>
 #include <optional>
-#include <unordered_map>
+#include <vector>
 
 #include "maliput/api/rules/range_value_rule.h"
 #include "maliput/api/rules/range_value_rule_state_provider.h"
 #include "maliput/api/rules/road_rulebook.h"
 #include "maliput/api/rules/rule.h"
+#include "maliput/base/rule_state_tracker.h"
+#include "maliput/base/rule_zone_index.h"
 #include "maliput/common/maliput_copyable.h"
 #include "maliput/common/maliput_throw.h"
 
@@ -48,6 +51,12 @@ class ManualRangeValueRuleStateProvider : public api::rules::RangeValueRuleState
  public:
   MALIPUT_NO_COPY_NO_MOVE_NO_ASSIGN(ManualRangeValueRuleStateProvider)
 
+  /// The states of all the rules, see GetAllStates().
+  using StatesSnapshot = RuleStatesSnapshot<api::rules::RangeValueRuleStateProvider::StateResult>;
+
+  /// The states that changed since a version, see GetStatesChangedSince().
+  using StateChanges = RuleStateChanges<api::rules::RangeValueRuleStateProvider::StateResult>;
+
   /// Constructs a ManualRangeValueRuleStateProvider with the default states populated.
   ///
   /// @param rulebook The RoadRulebook to use.
@@ -61,7 +70,7 @@ class ManualRangeValueRuleStateProvider : public api::rules::RangeValueRuleState
   ///
   /// @throws common::assertion_error When `rulebook` is nullptr.
   explicit ManualRangeValueRuleStateProvider(const api::rules::RoadRulebook* rulebook)
-      : api::rules::RangeValueRuleStateProvider(), rulebook_(rulebook) {
+      : api::rules::RangeValueRuleStateProvider(), rulebook_(rulebook), rule_zone_index_(rulebook) {
     MALIPUT_THROW_UNLESS(rulebook_ != nullptr);
   }
 
@@ -98,6 +107,29 @@ class ManualRangeValueRuleStateProvider : public api::rules::RangeValueRuleState
                 const std::optional<api::rules::RangeValueRule::Range>& next_state,
                 const std::optional<double>& duration_until);
 
+  /// Returns the IDs of the rules in the bulk state queries: the rules given
+  /// a state with SetState(), in the order they were first given one. The
+  /// index of a rule never changes.
+  const std::vector<api::rules::Rule::Id>& rule_ids() const { return states_.rule_ids(); }
+
+  /// Fills `snapshot` with the current state of every rule in rule_ids(), in
+  /// one pass. Reusing `snapshot` across calls saves allocations.
+  ///
+  /// @throws common::assertion_error When `snapshot` is nullptr.
+  void GetAllStates(StatesSnapshot* snapshot) const;
+
+  /// Convenience overload of GetAllStates() that returns the snapshot.
+  StatesSnapshot GetAllStates() const;
+
+  /// Fills `changes` with the current state of the rules in rule_ids() whose
+  /// state changed after `version`.
+  ///
+  /// See ManualDiscreteValueRuleStateProvider::GetStatesChangedSince() for
+  /// how changes are detected.
+  ///
+  /// @throws common::assertion_error When `changes` is nullptr.
+  void GetStatesChangedSince(std::size_t version, StateChanges* changes) const;
+
  private:
   // This function has been marked as virtual because other providers might
   // benefit from injecting their own getter and then forwarding calls to this
@@ -117,8 +149,13 @@ class ManualRangeValueRuleStateProvider : public api::rules::RangeValueRuleState
   void ValidateRuleState(const api::rules::RangeValueRule& range_value_rule,
                          const api::rules::RangeValueRule::Range& state) const;
 
-  std::unordered_map<api::rules::Rule::Id, api::rules::RangeValueRuleStateProvider::StateResult> states_;
+  // Writes the state set on every rule in rule_ids() to `states`, which is as large as rule_ids().
+  void GetSetStates(std::vector<std::optional<api::rules::RangeValueRuleStateProvider::StateResult>>* states) const;
+
+  ManualRuleStates<api::rules::RangeValueRuleStateProvider::StateResult> states_;
   const api::rules::RoadRulebook* rulebook_{nullptr};
+  // Finds the rules that apply to a position without going through every rule in `rulebook_`.
+  const RuleZoneIndex<api::rules::RangeValueRule> rule_zone_index_;
 };
 
 }  // namespace maliput
@@ -29,7 +29,9 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #pragma once
 
+#include <cstddef>
 #include <memory>
+#include <optional>
 #include <vector>
 
 #include "maliput/api/regions.h"
@@ -49,6 +51,21 @@ class ManualRulebook : public api::rules::RoadRulebook {
  public:
   MALIPUT_NO_COPY_NO_MOVE_NO_ASSIGN(ManualRulebook);
 
+  /// Non-owning counterpart of api::rules::RoadRulebook::QueryResults.
+  ///
+  /// Every vector is sorted by rule ID and holds no duplicates, like the maps in QueryResults. Pointers refer to the
+  /// rules stored in the ManualRulebook; they are invalidated when those rules are removed.
+  struct QueryResultViews {
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+    std::vector<const api::rules::RightOfWayRule*> right_of_way;
+    std::vector<const api::rules::SpeedLimitRule*> speed_limit;
+    std::vector<const api::rules::DirectionUsageRule*> direction_usage;
+#pragma GCC diagnostic pop
+    std::vector<const api::rules::DiscreteValueRule*> discrete_value_rules;
+    std::vector<const api::rules::RangeValueRule*> range_value_rules;
+  };
+
   /// Constructs an empty ManualRulebook (i.e., containing no rules).
   ManualRulebook();
 
@@ -110,6 +127,30 @@ class ManualRulebook : public api::rules::RoadRulebook {
   /// @throws maliput::common::assertion_error if no such rule exists.
   void RemoveRule(const api::rules::Rule::Id& id);
 
+  /// Finds the same rules as FindRules() without copying them.
+  ///
+  /// `views` is cleared before the rules are added to it. Reusing it across
+  /// queries avoids any allocation once its vectors are large enough.
+  ///
+  /// @throws maliput::common::assertion_error if `tolerance` is negative or
+  ///         `views` is nullptr.
+  void FindRuleViews(const std::vector<api::LaneSRange>& ranges, double tolerance, QueryResultViews* views) const;
+
+  /// Convenience overload of FindRuleViews() that returns the views.
+  QueryResultViews FindRuleViews(const std::vector<api::LaneSRange>& ranges, double tolerance) const;
+
+  /// Returns views of all the rules in this ManualRulebook, like Rules()
+  /// without copying them.
+  QueryResultViews RuleViews() const;
+
+  /// Returns the DiscreteValueRule with the specified `id`, or nullptr if `id`
+  /// is unknown. The pointer is invalidated when the rule is removed.
+  const api::rules::DiscreteValueRule* GetDiscreteValueRuleView(const api::rules::Rule::Id& id) const;
+
+  /// Returns the RangeValueRule with the specified `id`, or nullptr if `id` is
+  /// unknown. The pointer is invalidated when the rule is removed.
+  const api::rules::RangeValueRule* GetRangeValueRuleView(const api::rules::Rule::Id& id) const;
+
  private:
   api::rules::RoadRulebook::QueryResults DoFindRules(const std::vector<api::LaneSRange>& ranges,
                                                      double tolerance) const override;
@@ -122,6 +163,8 @@ class ManualRulebook : public api::rules::RoadRulebook {
 #pragma GCC diagnostic pop
   api::rules::DiscreteValueRule DoGetDiscreteValueRule(const api::rules::Rule::Id& id) const override;
   api::rules::RangeValueRule DoGetRangeValueRule(const api::rules::Rule::Id& id) const override;
+  // Counts the times rules were added or removed.
+  std::optional<std::size_t> do_revision() const override;
 
   class Impl;
   std::unique_ptr<Impl> impl_;
@@ -29,10 +29,14 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #pragma once
 
+#include <cstddef>
 #include <optional>
+#include <utility>
+#include <vector>
 
 #include "maliput/api/rules/discrete_value_rule_state_provider.h"
 #include "maliput/api/rules/phase_provider.h"
+#include "maliput/api/rules/phase_ring.h"
 #include "maliput/api/rules/phase_ring_book.h"
 #include "maliput/api/rules/road_rulebook.h"
 #include "maliput/api/rules/rule.h"
@@ -61,6 +65,10 @@ namespace maliput {
 /// one. At build time, it is expected that the loader calls
 /// ManualDiscreteValueRuleStateProvider::SetState() for those non Right-Of-Way
 /// rules that are part of the RoadRulebook.
+///
+/// The bulk state queries, GetAllStates() and GetStatesChangedSince(), cover
+/// the rules given a state with SetState() and the rules of the phase rings
+/// known at construction time. They query the PhaseProvider once per ring.
 class PhasedDiscreteRuleStateProvider final : public ManualDiscreteValueRuleStateProvider {
  public:
   MALIPUT_NO_COPY_NO_MOVE_NO_ASSIGN(PhasedDiscreteRuleStateProvider)
@@ -111,8 +119,18 @@ class PhasedDiscreteRuleStateProvider final : public ManualDiscreteValueRuleStat
   std::optional<api::rules::DiscreteValueRuleStateProvider::StateResult> DoGetState(
       const api::RoadPosition& road_position, const api::rules::Rule::TypeId& rule_type, double tolerance) const final;
 
+  // Gets the state of every rule in rule_ids(): the rules of each phase ring
+  // from its current phase, and the rest as
+  // ManualDiscreteValueRuleStateProvider::DoGetAllStates() does.
+  void DoGetAllStates(
+      std::vector<std::optional<api::rules::DiscreteValueRuleStateProvider::StateResult>>* states) const final;
+
   const api::rules::PhaseRingBook* phase_ring_book_{};
   const api::rules::PhaseProvider* phase_provider_{};
+  // The rules of the phase rings are the first `num_phase_ring_rules_` in rule_ids().
+  std::size_t num_phase_ring_rules_{};
+  // The indices in rule_ids() of the rules of each phase ring, sorted by rule ID.
+  std::vector<std::pair<api::rules::PhaseRing::Id, std::vector<std::size_t>>> phase_ring_rule_indices_;
 };
 
 }  // namespace maliput
@@ -0,0 +1,142 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2023, Woven by Toyota. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+#include "maliput/api/road_geometry.h"
+#include "maliput/api/road_network.h"
+#include "maliput/common/maliput_copyable.h"
+
+namespace maliput {
+
+/// @file
+/// Binary snapshots of a whole api::RoadNetwork.
+///
+/// Loading a RoadNetwork from its YAML documents parses and validates every
+/// rule, traffic light, phase ring and intersection. A snapshot stores the
+/// already built entities in a compact binary file instead, so restoring the
+/// RoadNetwork only memory-maps the file and instantiates them.
+///
+/// A snapshot holds:
+/// - the api::rules::RuleRegistry;
+/// - the api::rules::RoadRulebook, including the deprecated rule types;
+/// - the api::rules::TrafficLightBook;
+/// - the api::rules::PhaseRingBook;
+/// - the current phase of every PhaseRing in the api::rules::PhaseProvider;
+/// - the api::IntersectionBook;
+/// - optionally, a backend specific representation of the api::RoadGeometry
+///   (and of any spatial index it prebuilt), see RoadGeometrySerializer.
+///
+/// Restored RoadNetworks are made of the implementations in this directory:
+/// ManualRulebook, TrafficLightBook, ManualPhaseRingBook, ManualPhaseProvider
+/// and IntersectionBook. The state providers are rebuilt with their defaults,
+/// as the loaders do: PhasedDiscreteRuleStateProvider,
+/// ManualRangeValueRuleStateProvider and
+/// PhaseBasedRightOfWayRuleStateProvider.
+///
+/// The file starts with a header identifying the format, its version and the
+/// byte order of the machine that wrote it, followed by a table of sections.
+/// Every section is aligned to 8 bytes and all strings are deduplicated into a
+/// single string table. Snapshots written by a different version of the format
+/// or in a machine with a different byte order are rejected.
+
+/// Interface for backends to store their api::RoadGeometry in road network
+/// snapshots.
+///
+/// Without it, snapshots don't hold the RoadGeometry and it must be provided
+/// when loading them.
+class RoadGeometrySerializer {
+ public:
+  MALIPUT_NO_COPY_NO_MOVE_NO_ASSIGN(RoadGeometrySerializer);
+
+  virtual ~RoadGeometrySerializer() = default;
+
+  /// Serializes @p road_geometry.
+  ///
+  /// @param road_geometry The RoadGeometry to serialize.
+  /// @returns The bytes Deserialize() restores @p road_geometry from.
+  std::string Serialize(const api::RoadGeometry& road_geometry) const { return DoSerialize(road_geometry); }
+
+  /// Restores a RoadGeometry out of the bytes produced by Serialize().
+  ///
+  /// @param data Pointer to the bytes. They are only valid during the call, as they are usually memory-mapped.
+  /// @param size Number of bytes.
+  /// @returns The restored RoadGeometry.
+  /// @throws maliput::common::assertion_error When the RoadGeometry can't be restored.
+  std::unique_ptr<const api::RoadGeometry> Deserialize(const char* data, std::size_t size) const {
+    return DoDeserialize(data, size);
+  }
+
+ protected:
+  RoadGeometrySerializer() = default;
+
+ private:
+  virtual std::string DoSerialize(const api::RoadGeometry& road_geometry) const = 0;
+  virtual std::unique_ptr<const api::RoadGeometry> DoDeserialize(const char* data, std::size_t size) const = 0;
+};
+
+/// Saves a snapshot of @p road_network in @p filename.
+///
+/// The file is written next to @p filename and then renamed, so concurrent readers never see a partially written
+/// snapshot.
+///
+/// @param road_network The RoadNetwork to save. It must not be nullptr. It is not modified, the pointer is only
+///        needed to access its IntersectionBook and PhaseProvider.
+/// @param filename Path to the snapshot file.
+/// @param road_geometry_serializer When provided, it is used to store the RoadGeometry in the snapshot.
+/// @throws maliput::common::assertion_error When @p road_network is nullptr.
+/// @throws maliput::common::assertion_error When the file can't be written.
+void SaveRoadNetworkSnapshot(api::RoadNetwork* road_network, const std::string& filename,
+                             const RoadGeometrySerializer* road_geometry_serializer = nullptr);
+
+/// Restores the RoadNetwork saved in @p filename on top of @p road_geometry.
+///
+/// @param filename Path to the snapshot file.
+/// @param road_geometry The RoadGeometry of the RoadNetwork. It must not be nullptr and its id must match the one of
+///        the saved RoadGeometry.
+/// @returns The restored RoadNetwork.
+/// @throws maliput::common::assertion_error When @p road_geometry is nullptr or its id doesn't match.
+/// @throws maliput::common::assertion_error When @p filename can't be read or is not a valid snapshot.
+std::unique_ptr<api::RoadNetwork> LoadRoadNetworkSnapshot(const std::string& filename,
+                                                          std::unique_ptr<const api::RoadGeometry> road_geometry);
+
+/// Restores the RoadNetwork saved in @p filename, including its RoadGeometry.
+///
+/// @param filename Path to the snapshot file.
+/// @param road_geometry_serializer Restores the RoadGeometry stored in the snapshot.
+/// @returns The restored RoadNetwork.
+/// @throws maliput::common::assertion_error When @p filename can't be read or is not a valid snapshot.
+/// @throws maliput::common::assertion_error When the snapshot doesn't hold a RoadGeometry or its id doesn't match.
+std::unique_ptr<api::RoadNetwork> LoadRoadNetworkSnapshot(const std::string& filename,
+                                                          const RoadGeometrySerializer& road_geometry_serializer);
+
+}  // namespace maliput
@@ -0,0 +1,302 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2023, Woven by Toyota. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <cstddef>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "maliput/api/rules/rule.h"
+#include "maliput/common/maliput_throw.h"
+
+namespace maliput {
+
+/// The states of all the rules of a state provider at some point in time.
+///
+/// @tparam StateResultT The StateResult type of the state provider.
+template <typename StateResultT>
+struct RuleStatesSnapshot {
+  /// Version of the states, see RuleStateTracker.
+  std::size_t version{0};
+  /// `states[i]` is the state of the i-th rule ID of the provider, or
+  /// std::nullopt when the rule has no state.
+  std::vector<std::optional<StateResultT>> states;
+};
+
+/// The states of the rules of a state provider that changed since a version.
+///
+/// @tparam StateResultT The StateResult type of the state provider.
+template <typename StateResultT>
+struct RuleStateChanges {
+  /// Version of the states, to be passed to the next query for changes.
+  std::size_t version{0};
+  /// Indices, into the rule IDs of the provider, of the rules whose state
+  /// changed. They are sorted.
+  std::vector<std::size_t> indices;
+  /// `states[j]` is the new state of the rule at `indices[j]`.
+  std::vector<std::optional<StateResultT>> states;
+};
+
+/// @returns True when `state` has `value` as state, and either `next_value`
+///          as next state with `duration_until` as duration until it, or no
+///          next state when `next_value` is nullptr.
+template <typename StateResultT, typename ValueT>
+bool IsSameRuleState(const StateResultT& state, const ValueT& value, const ValueT* next_value,
+                     const std::optional<double>& duration_until) {
+  if (!(state.state == value) || state.next.has_value() != (next_value != nullptr)) return false;
+  return next_value == nullptr || (state.next->state == *next_value && state.next->duration_until == duration_until);
+}
+
+/// @returns True when `lhs` and `rhs` have the same state, next state and
+///          duration until the next state.
+template <typename StateResultT>
+bool IsSameRuleState(const StateResultT& lhs, const StateResultT& rhs) {
+  const auto* next_value = rhs.next.has_value() ? &rhs.next->state : nullptr;
+  return IsSameRuleState(lhs, rhs.state, next_value, rhs.next.has_value() ? rhs.next->duration_until : std::nullopt);
+}
+
+/// @returns True when both `lhs` and `rhs` are std::nullopt, or when they
+///          have the same state, next state and duration until the next state.
+template <typename StateResultT>
+bool IsSameRuleState(const std::optional<StateResultT>& lhs, const std::optional<StateResultT>& rhs) {
+  if (lhs.has_value() != rhs.has_value()) return false;
+  return !lhs.has_value() || IsSameRuleState(*lhs, *rhs);
+}
+
+/// Copies `state` into `dst` unless they are the same already, which spares
+/// copying the values of the rules when states are sampled repeatedly.
+template <typename StateResultT>
+void UpdateRuleState(const StateResultT& state, std::optional<StateResultT>* dst) {
+  if (!dst->has_value() || !IsSameRuleState(state, **dst)) {
+    *dst = state;
+  }
+}
+
+/// Same as UpdateRuleState(), for the state made of `value`, and of
+/// `next_value` and `duration_until` when `next_value` is not nullptr. The
+/// state is only built when `dst` holds a different one.
+template <typename StateResultT, typename ValueT>
+void UpdateRuleState(const ValueT& value, const ValueT* next_value, const std::optional<double>& duration_until,
+                     std::optional<StateResultT>* dst) {
+  if (dst->has_value() && IsSameRuleState(**dst, value, next_value, duration_until)) {
+    return;
+  }
+  std::optional<typename StateResultT::Next> next;
+  if (next_value != nullptr) {
+    next = typename StateResultT::Next{*next_value, duration_until};
+  }
+  *dst = StateResultT{value, std::move(next)};
+}
+
+/// Lays out the rules of a state provider densely and keeps track of when
+/// their states change, for the bulk state queries of the providers.
+///
+/// Rules are given consecutive indices as they are registered, and keep them.
+/// States are sampled by Record(): each call that finds a different state,
+/// next state or duration until the next state for any rule increases the
+/// version. Changes reverted between two calls are not seen.
+///
+/// This class is not thread safe.
+///
+/// @tparam StateResultT The StateResult type of the state provider.
+template <typename StateResultT>
+class RuleStateTracker {
+ public:
+  /// Registers `id`, if it is new.
+  /// @returns The index of `id`.
+  std::size_t Register(const api::rules::Rule::Id& id) {
+    const auto it = indices_.emplace(id, rule_ids_.size());
+    if (it.second) {
+      rule_ids_.push_back(id);
+      recorded_.emplace_back();
+      changed_at_.push_back(0);
+    }
+    return it.first->second;
+  }
+
+  /// @returns The index of `id`, or std::nullopt when it is not registered.
+  std::optional<std::size_t> IndexOf(const api::rules::Rule::Id& id) const {
+    const auto it = indices_.find(id);
+    return it != indices_.end() ? std::make_optional(it->second) : std::nullopt;
+  }
+
+  /// @returns The registered rule IDs, in index order.
+  const std::vector<api::rules::Rule::Id>& rule_ids() const { return rule_ids_; }
+
+  /// Records `states`, the current state of every registered rule in index
+  /// order.
+  ///
+  /// @returns The version of `states`.
+  /// @throws common::assertion_error When the size of `states` is not the
+  ///         number of registered rules.
+  std::size_t Record(const std::vector<std::optional<StateResultT>>& states) {
+    MALIPUT_THROW_UNLESS(states.size() == rule_ids_.size());
+    bool has_changed{false};
+    for (std::size_t i = 0; i < states.size(); ++i) {
+      if (!IsSameRuleState(states[i], recorded_[i])) {
+        if (!has_changed) {
+          has_changed = true;
+          ++version_;
+        }
+        recorded_[i] = states[i];
+        changed_at_[i] = version_;
+      }
+    }
+    return version_;
+  }
+
+  /// Fills `changes` with the recorded states that changed after `version`.
+  /// @throws common::assertion_error When `changes` is nullptr.
+  void GetChangesSince(std::size_t version, RuleStateChanges<StateResultT>* changes) const {
+    MALIPUT_THROW_UNLESS(changes != nullptr);
+    changes->version = version_;
+    changes->indices.clear();
+    changes->states.clear();
+    for (std::size_t i = 0; i < changed_at_.size(); ++i) {
+      if (changed_at_[i] > version) {
+        changes->indices.push_back(i);
+        changes->states.push_back(recorded_[i]);
+      }
+    }
+  }
+
+ private:
+  std::vector<api::rules::Rule::Id> rule_ids_;
+  std::unordered_map<api::rules::Rule::Id, std::size_t> indices_;
+  std::vector<std::optional<StateResultT>> recorded_;
+  // Version at which each state was last seen changing.
+  std::vector<std::size_t> changed_at_;
+  std::size_t version_{0};
+};
+
+/// Holds the states set on the rules of a manual state provider, and serves
+/// its bulk state queries with a RuleStateTracker.
+///
+/// Set(), Register() and the bulk queries are serialized by an internal
+/// mutex. Find(), IndexOf() and rule_ids() are not, like the single state
+/// queries of the providers.
+///
+/// @tparam StateResultT The StateResult type of the state provider.
+template <typename StateResultT>
+class ManualRuleStates {
+ public:
+  /// Sets `state` as the state of `id`, and registers `id` if it is new.
+  void Set(const api::rules::Rule::Id& id, const StateResultT& state) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    // Nodes of `states_` are stable, so `set_states_` may point to them.
+    const StateResultT& stored_state = states_[id] = state;
+    set_states_[RegisterLocked(id)] = &stored_state;
+  }
+
+  /// Registers `id` in the bulk queries, if it is new. It has no state until
+  /// Set() is called for it.
+  /// @returns The index of `id`.
+  std::size_t Register(const api::rules::Rule::Id& id) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return RegisterLocked(id);
+  }
+
+  /// @returns The state set on `id`, or nullptr when there is none.
+  const StateResultT* Find(const api::rules::Rule::Id& id) const {
+    const auto it = states_.find(id);
+    return it != states_.end() ? &it->second : nullptr;
+  }
+
+  /// @returns The index of `id`, or std::nullopt when it is not registered.
+  std::optional<std::size_t> IndexOf(const api::rules::Rule::Id& id) const { return tracker_.IndexOf(id); }
+
+  /// @returns The registered rule IDs, in index order.
+  const std::vector<api::rules::Rule::Id>& rule_ids() const { return tracker_.rule_ids(); }
+
+  /// Writes to `state` the state set on the rule at `index`, or std::nullopt
+  /// when there is none. Meant to be called from the `get_states` functions
+  /// of the bulk queries.
+  void GetSetState(std::size_t index, std::optional<StateResultT>* state) const {
+    if (set_states_[index] != nullptr) {
+      UpdateRuleState(*set_states_[index], state);
+    } else {
+      state->reset();
+    }
+  }
+
+  /// Fills `snapshot` with the current states, as given by `get_states`, and
+  /// records them.
+  ///
+  /// @param get_states Called as `get_states(&states)` to write the current
+  ///        state of every registered rule to `states`, which is as large as
+  ///        rule_ids() and may hold earlier states to overwrite.
+  /// @param snapshot The snapshot to fill.
+  /// @throws common::assertion_error When `snapshot` is nullptr.
+  template <typename GetStatesT>
+  void GetAllStates(const GetStatesT& get_states, RuleStatesSnapshot<StateResultT>* snapshot) const {
+    MALIPUT_THROW_UNLESS(snapshot != nullptr);
+    std::lock_guard<std::mutex> lock(mutex_);
+    snapshot->states.resize(tracker_.rule_ids().size());
+    get_states(&snapshot->states);
+    snapshot->version = tracker_.Record(snapshot->states);
+  }
+
+  /// Records the current states, as given by `get_states`, and fills
+  /// `changes` with the ones that changed after `version`.
+  ///
+  /// @param version The version to look for changes after.
+  /// @param get_states See GetAllStates().
+  /// @param changes The changes to fill.
+  /// @throws common::assertion_error When `changes` is nullptr.
+  template <typename GetStatesT>
+  void GetStatesChangedSince(std::size_t version, const GetStatesT& get_states,
+                             RuleStateChanges<StateResultT>* changes) const {
+    MALIPUT_THROW_UNLESS(changes != nullptr);
+    std::lock_guard<std::mutex> lock(mutex_);
+    current_states_.resize(tracker_.rule_ids().size());
+    get_states(&current_states_);
+    tracker_.Record(current_states_);
+    tracker_.GetChangesSince(version, changes);
+  }
+
+ private:
+  std::size_t RegisterLocked(const api::rules::Rule::Id& id) {
+    const std::size_t index = tracker_.Register(id);
+    set_states_.resize(tracker_.rule_ids().size(), nullptr);
+    return index;
+  }
+
+  std::unordered_map<api::rules::Rule::Id, StateResultT> states_;
+  // `set_states_[i]` points to the entry of `states_` of the i-th registered rule, or is nullptr.
+  std::vector<const StateResultT*> set_states_;
+  // Samples of the states for the bulk queries.
+  mutable RuleStateTracker<StateResultT> tracker_;
+  mutable std::vector<std::optional<StateResultT>> current_states_;
+  mutable std::mutex mutex_;
+};
+
+}  // namespace maliput
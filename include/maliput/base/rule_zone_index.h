@@ -0,0 +1,123 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2023, Woven by Toyota. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include "maliput/api/lane_data.h"
+#include "maliput/api/regions.h"
+#include "maliput/api/rules/road_rulebook.h"
+#include "maliput/api/rules/rule.h"
+#include "maliput/common/interval_tree.h"
+#include "maliput/common/maliput_copyable.h"
+
+namespace maliput {
+
+/// Indexes the zones of the `RuleT` rules of an api::rules::RoadRulebook by
+/// lane and api::rules::Rule::TypeId, so the rules of a type that apply to a
+/// position are found in O(log(n) + k) time, without copying any rule.
+///
+/// The index is built at construction and rebuilt by the first query after
+/// the rules change, as told by api::rules::RoadRulebook::revision(). When
+/// the rulebook does not track its revision, the rules may change at any time,
+/// so every query scans api::rules::RoadRulebook::Rules() instead.
+///
+/// Queries may run concurrently, but not while the rules of the rulebook are
+/// being changed.
+///
+/// @tparam RuleT Either api::rules::DiscreteValueRule or
+///         api::rules::RangeValueRule.
+template <typename RuleT>
+class RuleZoneIndex {
+ public:
+  MALIPUT_NO_COPY_NO_MOVE_NO_ASSIGN(RuleZoneIndex);
+
+  /// Constructs the index of the rules in `rulebook`.
+  ///
+  /// @param rulebook The rulebook to index. It must not be nullptr and must
+  ///        outlive this index.
+  ///
+  /// @throws common::assertion_error When `rulebook` is nullptr.
+  explicit RuleZoneIndex(const api::rules::RoadRulebook* rulebook);
+
+  /// Finds the rule of `rule_type` type that applies to `road_position` under
+  /// `tolerance`, i.e. whose zone intersects it.
+  ///
+  /// When more than one rule applies, a warning listing all of them is logged
+  /// and the one with the smallest ID is returned, like the first entry of the
+  /// maps in api::rules::RoadRulebook::QueryResults.
+  ///
+  /// @returns The ID of the rule, or std::nullopt when none applies.
+  ///
+  /// @throws common::assertion_error When `tolerance` is negative.
+  std::optional<api::rules::Rule::Id> FindRule(const api::RoadPosition& road_position,
+                                               const api::rules::Rule::TypeId& rule_type, double tolerance) const;
+
+  /// Finds all the rules of `rule_type` type that apply to `road_position`
+  /// under `tolerance`.
+  ///
+  /// @returns The IDs of the rules, sorted and without duplicates.
+  ///
+  /// @throws common::assertion_error When `tolerance` is negative.
+  std::vector<api::rules::Rule::Id> FindRules(const api::RoadPosition& road_position,
+                                              const api::rules::Rule::TypeId& rule_type, double tolerance) const;
+
+ private:
+  // A (rule ID, SRange) association.
+  struct Entry {
+    api::rules::Rule::Id id;
+    api::SRange s_range;
+  };
+
+  using Intervals = common::IntervalTree<Entry>;
+
+  // Calls `visitor` with the ID of every rule of `rule_type` whose ranges on `road_position.lane` intersect
+  // `road_position.pos.s()` under `tolerance`, once per intersecting range.
+  template <typename Visitor>
+  void Visit(const api::RoadPosition& road_position, const api::rules::Rule::TypeId& rule_type, double tolerance,
+             Visitor&& visitor) const;
+
+  // Rebuilds the index when `revision` differs from the one of the rules it was built with.
+  void RebuildIfNeeded(std::size_t revision) const;
+
+  // Indexes the rules of `rulebook_`.
+  void Build() const;
+
+  const api::rules::RoadRulebook* rulebook_{};
+  mutable std::unordered_map<api::LaneId, std::unordered_map<api::rules::Rule::TypeId, Intervals>> index_;
+  mutable std::atomic<std::size_t> revision_{0};
+  mutable std::mutex mutex_;
+};
+
+}  // namespace maliput
@@ -0,0 +1,161 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2023, Woven by Toyota. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "maliput/common/maliput_copyable.h"
+
+namespace maliput {
+namespace common {
+
+/// @file
+/// A self-contained profiler backend for the MALIPUT_PROFILE_* macros, see
+/// profiler.h. It is used when maliput is built with
+/// `MALIPUT_BUILTIN_PROFILER_ENABLE` and without `MALIPUT_PROFILER_ENABLE`,
+/// but its API is always available.
+///
+/// Recording is toggled at runtime with profiler::SetEnabled() and is
+/// disabled by default; while disabled, a profiled scope costs a relaxed
+/// atomic load. While enabled, each thread records, without locks:
+/// - The begin and end events of its scopes in a ring buffer of
+///   profiler::kEventBufferSize events, timestamped with the CPU time stamp
+///   counter where available. Older events are overwritten.
+/// - The number of calls, the total and maximum duration and a latency
+///   histogram of up to profiler::kMaxScopeNames distinct scope names.
+///
+/// profiler::GetStatistics() aggregates the counters of all threads and
+/// profiler::WriteChromeTrace() dumps the buffered events in the Chrome
+/// trace-event format, to be opened with chrome://tracing or Perfetto.
+namespace profiler {
+
+/// Number of events kept per thread.
+constexpr std::size_t kEventBufferSize{1 << 14};
+/// Number of distinct scope names with statistics per thread. Scopes beyond
+/// it are recorded as events only.
+constexpr std::size_t kMaxScopeNames{256};
+/// Maximum nesting depth of the scopes with statistics. Deeper scopes are
+/// recorded as events only.
+constexpr std::size_t kMaxScopeDepth{128};
+/// Number of buckets of the latency histograms.
+constexpr std::size_t kNumHistogramBuckets{40};
+
+namespace internal {
+
+extern std::atomic<bool> enabled;
+
+}  // namespace internal
+
+/// Enables or disables the recording of scopes.
+void SetEnabled(bool enabled);
+
+/// @returns Whether scopes are being recorded.
+inline bool IsEnabled() { return internal::enabled.load(std::memory_order_relaxed); }
+
+/// Names the calling thread in the Chrome traces.
+void SetThreadName(const std::string& name);
+
+/// Begins a scope named @p name in the calling thread, when recording is
+/// enabled. @p name must outlive the profiler, e.g. a string literal.
+/// @returns Whether the scope began. Only then must it be ended with End().
+bool Begin(const char* name);
+
+/// Ends the innermost scope of the calling thread, if any.
+void End();
+
+/// Begins a scope like Begin() and remembers whether it began, so the
+/// matching EndSample() only ends it then. It backs MALIPUT_PROFILE_BEGIN(),
+/// whose callers cannot keep the result of Begin().
+void BeginSample(const char* name);
+
+/// Ends the innermost sample of the calling thread begun with BeginSample(),
+/// if it began a scope.
+void EndSample();
+
+/// Records a scope that spans its lifetime, when recording is enabled at
+/// construction.
+class ScopedProfile {
+ public:
+  MALIPUT_NO_COPY_NO_MOVE_NO_ASSIGN(ScopedProfile);
+
+  /// Begins a scope named @p name. @see Begin().
+  explicit ScopedProfile(const char* name) : active_(IsEnabled() && Begin(name)) {}
+
+  ~ScopedProfile() {
+    if (active_) {
+      End();
+    }
+  }
+
+ private:
+  const bool active_{};
+};
+
+/// Statistics of the scopes that share a name.
+struct ScopeStatistics {
+  /// @returns The mean duration, in nanoseconds, or zero when there were no
+  /// calls.
+  double mean_ns() const { return calls == 0 ? 0. : total_ns / static_cast<double>(calls); }
+
+  /// The name of the scopes.
+  std::string name;
+  /// Number of completed scopes.
+  int64_t calls{0};
+  /// Total duration of the scopes, in nanoseconds.
+  double total_ns{0.};
+  /// Maximum duration of a scope, in nanoseconds.
+  double max_ns{0.};
+  /// `histogram[i]` counts the scopes whose duration is in
+  /// `[2^i, 2^(i+1))` nanoseconds. The first bucket also counts the shorter
+  /// scopes and the last bucket the longer ones.
+  std::array<int64_t, kNumHistogramBuckets> histogram{};
+};
+
+/// @returns The statistics of every scope name, merged across threads and
+/// sorted by decreasing total duration.
+std::vector<ScopeStatistics> GetStatistics();
+
+/// Writes the buffered events of all threads to @p os as a Chrome
+/// trace-event JSON document. Events that are overwritten while writing are
+/// skipped.
+void WriteChromeTrace(std::ostream& os);
+
+/// Discards the statistics and the buffered events of all threads. Each scope
+/// that ends concurrently is either fully discarded or fully kept.
+void Reset();
+
+}  // namespace profiler
+}  // namespace common
+}  // namespace maliput
@@ -0,0 +1,143 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2023, Woven by Toyota. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "maliput/common/maliput_throw.h"
+
+namespace maliput {
+namespace common {
+
+/// A static interval tree over closed intervals [min, max] carrying a `T` value each.
+///
+/// Intervals are kept sorted by `min` in a vector which forms an implicit balanced binary search tree: the root of
+/// the subtree over [begin, end) is the middle interval. Every node also stores the largest `max` of its subtree, so
+/// Visit() runs in O(log(n) + k) for n intervals, k of them reported, without allocating.
+///
+/// Insert() and RemoveIf() leave the tree unbuilt, and Build() must be called before Visit(). Bulk loading thus sorts
+/// the intervals once.
+///
+/// @tparam T The type of the values.
+template <typename T>
+class IntervalTree {
+ public:
+  /// An interval and its value.
+  struct Interval {
+    double min{};
+    double max{};
+    T value;
+  };
+
+  /// Adds [@p min, @p max] with @p value.
+  /// @throws common::assertion_error When @p min is greater than @p max.
+  void Insert(double min, double max, T value) {
+    MALIPUT_THROW_UNLESS(min <= max);
+    intervals_.push_back(Interval{min, max, std::move(value)});
+    built_ = false;
+  }
+
+  /// Removes every interval for which `predicate(interval)` is true.
+  template <typename Predicate>
+  void RemoveIf(Predicate&& predicate) {
+    intervals_.erase(std::remove_if(intervals_.begin(), intervals_.end(), std::forward<Predicate>(predicate)),
+                     intervals_.end());
+    built_ = false;
+  }
+
+  /// Removes all the intervals.
+  void Clear() {
+    intervals_.clear();
+    subtree_max_.clear();
+    built_ = true;
+  }
+
+  /// Sorts the intervals and computes the bounds of every subtree. It is a no-op if the tree is already built.
+  void Build() {
+    if (built_) return;
+    std::sort(intervals_.begin(), intervals_.end(),
+              [](const Interval& lhs, const Interval& rhs) { return lhs.min < rhs.min; });
+    subtree_max_.resize(intervals_.size());
+    Build(0, intervals_.size());
+    built_ = true;
+  }
+
+  /// Calls `visitor(interval)` with every interval that overlaps [@p min, @p max], in no particular order.
+  /// @throws common::assertion_error When the tree is not built.
+  template <typename Visitor>
+  void Visit(double min, double max, Visitor&& visitor) const {
+    MALIPUT_THROW_UNLESS(built_);
+    Visit(min, max, 0, intervals_.size(), visitor);
+  }
+
+  /// @returns True when Visit() can be called.
+  bool is_built() const { return built_; }
+
+  /// @returns True when there are no intervals.
+  bool empty() const { return intervals_.empty(); }
+
+  /// @returns The number of intervals.
+  std::size_t size() const { return intervals_.size(); }
+
+ private:
+  // Computes `subtree_max_` over [begin, end) and returns the largest `max` in it.
+  double Build(std::size_t begin, std::size_t end) {
+    if (begin >= end) return -std::numeric_limits<double>::infinity();
+    const std::size_t middle = begin + (end - begin) / 2;
+    subtree_max_[middle] = std::max({intervals_[middle].max, Build(begin, middle), Build(middle + 1, end)});
+    return subtree_max_[middle];
+  }
+
+  // Visits the subtree over [begin, end). The right subtree is walked iteratively.
+  template <typename Visitor>
+  void Visit(double min, double max, std::size_t begin, std::size_t end, Visitor& visitor) const {
+    while (begin < end) {
+      const std::size_t middle = begin + (end - begin) / 2;
+      if (subtree_max_[middle] < min) return;
+      Visit(min, max, begin, middle, visitor);
+      // Intervals from `middle` onwards start after the query ends.
+      if (intervals_[middle].min > max) return;
+      if (intervals_[middle].max >= min) {
+        visitor(intervals_[middle]);
+      }
+      begin = middle + 1;
+    }
+  }
+
+  std::vector<Interval> intervals_;
+  std::vector<double> subtree_max_;
+  bool built_{true};
+};
+
+}  // namespace common
+}  // namespace maliput
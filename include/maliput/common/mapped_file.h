@@ -0,0 +1,76 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2023, Woven by Toyota. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <ostream>
+#include <string>
+
+#include "maliput/common/maliput_copyable.h"
+
+namespace maliput {
+namespace common {
+
+/// Read-only memory mapping of a file.
+///
+/// The contents are paged in on demand, so binary caches and snapshots can be read in place without copying the
+/// whole file first.
+class MappedFile {
+ public:
+  MALIPUT_NO_COPY_NO_MOVE_NO_ASSIGN(MappedFile);
+
+  /// Maps the file at @p path. data() is nullptr when the file doesn't exist, is empty or can't be mapped.
+  explicit MappedFile(const std::string& path);
+
+  ~MappedFile();
+
+  /// @returns The mapped contents or nullptr when the file couldn't be mapped.
+  const char* data() const { return data_; }
+
+  /// @returns The size of the mapped contents in bytes.
+  std::size_t size() const { return size_; }
+
+ private:
+  const char* data_{nullptr};
+  std::size_t size_{0};
+};
+
+/// Writes the file at @p path so that readers, e.g. MappedFile, never see it partially written.
+///
+/// The contents are written to a uniquely named temporary file next to @p path, which is then renamed to @p path.
+/// Concurrent writers, from any thread or process, therefore never share a temporary file and the last rename wins.
+/// @param path Path of the file to write.
+/// @param write Writes the contents of the file to the given stream.
+/// @returns False when the file couldn't be written. Nothing is left behind in that case.
+/// @throws Whatever @p write throws, after removing the temporary file.
+bool WriteFileAtomically(const std::string& path, const std::function<void(std::ostream*)>& write);
+
+}  // namespace common
+}  // namespace maliput
@@ -0,0 +1,115 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2023, Woven by Toyota. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace maliput {
+namespace common {
+
+/// Calls `function(i)` for every `i` in [0, @p num_tasks) using up to @p num_threads threads, the calling thread
+/// included. Threads pick the tasks in increasing order, so long tasks should come first.
+///
+/// When a task throws, the remaining tasks are still run and the first exception caught is rethrown once all the
+/// threads are joined.
+///
+/// @param num_tasks Number of tasks.
+/// @param num_threads Maximum number of threads. Zero is interpreted as one.
+/// @param function Callable invoked as `function(std::size_t i)`. It must be safe to call concurrently.
+template <typename Function>
+void ParallelFor(std::size_t num_tasks, std::size_t num_threads, Function&& function) {
+  num_threads = std::min(num_threads, num_tasks);
+  if (num_threads <= 1) {
+    for (std::size_t i = 0; i < num_tasks; ++i) {
+      function(i);
+    }
+    return;
+  }
+  std::atomic<std::size_t> next_task{0};
+  std::mutex exception_mutex;
+  std::exception_ptr exception;
+  const auto work = [&]() {
+    for (std::size_t i = next_task++; i < num_tasks; i = next_task++) {
+      try {
+        function(i);
+      } catch (...) {
+        const std::lock_guard<std::mutex> lock(exception_mutex);
+        if (!exception) {
+          exception = std::current_exception();
+        }
+      }
+    }
+  };
+  std::vector<std::thread> threads;
+  threads.reserve(num_threads - 1);
+  for (std::size_t i = 1; i < num_threads; ++i) {
+    threads.emplace_back(work);
+  }
+  work();
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+  if (exception) {
+    std::rethrow_exception(exception);
+  }
+}
+
+/// Number of chunks MakeChunks() splits the work into for each thread, so threads that finish early can take over the
+/// remaining work.
+constexpr std::size_t kChunksPerThread{4};
+
+/// Splits [0, @p size) into contiguous `[begin, end)` ranges of similar size, to be run as the tasks of a
+/// ParallelFor() with @p num_threads threads: a single range when @p num_threads is at most one, and up to
+/// kChunksPerThread ranges per thread otherwise.
+///
+/// Callers that keep the results of each range apart and concatenate them in range order get the same results
+/// regardless of @p num_threads.
+inline std::vector<std::pair<std::size_t, std::size_t>> MakeChunks(std::size_t size, std::size_t num_threads) {
+  std::vector<std::pair<std::size_t, std::size_t>> chunks;
+  if (size == 0) {
+    return chunks;
+  }
+  const std::size_t num_chunks = std::min(size, num_threads > 1 ? num_threads * kChunksPerThread : std::size_t{1});
+  const std::size_t chunk_size = (size + num_chunks - 1) / num_chunks;
+  chunks.reserve(num_chunks);
+  for (std::size_t begin = 0; begin < size; begin += chunk_size) {
+    chunks.emplace_back(begin, std::min(begin + chunk_size, size));
+  }
+  return chunks;
+}
+
+}  // namespace common
+}  // namespace maliput
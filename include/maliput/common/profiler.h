@@ -31,12 +31,19 @@
 
 /// @file Wraps ignition common's profiler behind maliput macros.
 ///       This allows us to enable/disable profiling at compile time and avoid adding a dependency on ignition common.
+///       When `MALIPUT_PROFILER_ENABLE` is not set but `MALIPUT_BUILTIN_PROFILER_ENABLE` is, the macros use the
+///       built-in backend instead, see builtin_profiler.h.
 
 #ifndef MALIPUT_PROFILER_ENABLE
 /// Always set this variable to some value
 #define MALIPUT_PROFILER_ENABLE 0
 #endif
 
+#ifndef MALIPUT_BUILTIN_PROFILER_ENABLE
+/// Always set this variable to some value
+#define MALIPUT_BUILTIN_PROFILER_ENABLE 0
+#endif
+
 #if MALIPUT_PROFILER_ENABLE
 
 #define IGN_PROFILER_ENABLE 1
@@ -64,6 +71,21 @@
 
 /// \brief Macro to determine if profiler is enabled and has an implementation.
 #define MALIPUT_PROFILER_VALID IGN_PROFILER_VALID
+#elif MALIPUT_BUILTIN_PROFILER_ENABLE
+
+#include "maliput/common/builtin_profiler.h"
+
+#define MALIPUT_PROFILE_THREAD_NAME(name) ::maliput::common::profiler::SetThreadName(name)
+#define MALIPUT_PROFILE_LOG_TEXT(name) ((void)name)
+#define MALIPUT_PROFILE_BEGIN(name) ::maliput::common::profiler::BeginSample(name)
+#define MALIPUT_PROFILE_END() ::maliput::common::profiler::EndSample()
+#define MALIPUT_PROFILE_L(name, line) ::maliput::common::profiler::ScopedProfile maliputProfile##line(name)
+/// \brief Expands `line` before pasting it in MALIPUT_PROFILE_L.
+#define MALIPUT_PROFILE_L_EXPANDED(name, line) MALIPUT_PROFILE_L(name, line)
+#define MALIPUT_PROFILE(name) MALIPUT_PROFILE_L_EXPANDED(name, __LINE__)
+#define MALIPUT_PROFILE_FUNC() MALIPUT_PROFILE(__FUNCTION__)
+#define MALIPUT_PROFILE_PRETTY_FUNC() MALIPUT_PROFILE(__PRETTY_FUNCTION__)
+#define MALIPUT_PROFILER_VALID 1
 #else
 
 #define MALIPUT_PROFILE_THREAD_NAME(name) ((void)name)
@@ -76,4 +98,4 @@
 #define MALIPUT_PROFILE_PRETTY_FUNC() ((void)0)
 #define MALIPUT_PROFILER_VALID MALIPUT_PROFILER_ENABLE
 
-#endif  // MALIPUT_PROFILER_ENABLE
+#endif  // MALIPUT_PROFILER_ENABLE, MALIPUT_BUILTIN_PROFILER_ENABLE
@@ -0,0 +1,107 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2023, Woven by Toyota. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+namespace maliput {
+namespace common {
+
+/// An immutable, reference-counted string that caches its DefaultHash.
+///
+/// Copies share the string, so copying a %SharedString increments an atomic
+/// reference count and never allocates. Equality compares the addresses of
+/// the shared strings first, then their hashes, and only then their contents.
+///
+/// A %SharedString is private to its copies unless it is created with
+/// Intern(), which looks the string up in a process-wide table and shares the
+/// instance already held there, so equal interned strings share the same
+/// instance and compare by address. Interning is opt-in: it takes the lock of
+/// a shard of the table, so it suits strings that are copied and compared much
+/// more often than they are created, such as the identifiers of a loaded road
+/// network.
+///
+/// The table does not own the strings: an interned string leaves it when its
+/// last copy is destroyed. Its size is therefore bounded by the number of
+/// distinct interned strings alive, and interning transient strings doesn't
+/// leak memory.
+class SharedString {
+ public:
+  /// Constructs an empty string.
+  SharedString() = default;
+
+  /// Constructs a string that is not interned. It doesn't use the table.
+  explicit SharedString(std::string string);
+
+  SharedString(const SharedString& other) noexcept;
+  SharedString& operator=(const SharedString& other) noexcept;
+  SharedString(SharedString&& other) noexcept;
+  SharedString& operator=(SharedString&& other) noexcept;
+  ~SharedString();
+
+  /// Returns a string equal to @p string that shares the instance held by the
+  /// table, adding it to the table when it is not there yet. It is safe to call
+  /// concurrently from multiple threads.
+  static SharedString Intern(std::string string);
+
+  /// Returns the number of strings in the table, i.e. the number of distinct
+  /// interned strings alive.
+  static std::size_t table_size();
+
+  /// Returns the string.
+  const std::string& string() const;
+
+  /// Returns `DefaultHash{}(string())`.
+  std::size_t hash() const;
+
+  /// Returns true when the string was created with Intern().
+  bool is_interned() const;
+
+  /// Returns true when both strings share the same instance.
+  bool shares_instance_with(const SharedString& other) const { return node_ == other.node_; }
+
+  bool operator==(const SharedString& rhs) const {
+    return node_ == rhs.node_ || (hash() == rhs.hash() && string() == rhs.string());
+  }
+  bool operator!=(const SharedString& rhs) const { return !(*this == rhs); }
+
+ private:
+  struct Node;
+
+  explicit SharedString(Node* node) : node_(node) {}
+
+  // Releases the reference to node_, if any.
+  void Release();
+
+  Node* node_{};
+};
+
+}  // namespace common
+}  // namespace maliput
@@ -0,0 +1,112 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2023, Woven by Toyota. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+#include "maliput/api/lane.h"
+#include "maliput/geometry_base/strategy_base.h"
+#include "maliput/math/axis_aligned_box.h"
+
+namespace maliput {
+namespace geometry_base {
+
+/// Implements StrategyBase by organizing the maliput::api::Lane space into a bounding volume hierarchy (BVH).
+///
+/// Each maliput::api::Lane is split along its `s` coordinate into chunks of at most `chunk_length` length,
+/// and each chunk is enclosed by a maliput::math::AxisAlignedBox that covers the lane volume (lane bounds and
+/// elevation bounds). The boxes are grown by the sagitta of the lane surface between samples, so curved lanes and
+/// varying lane bounds remain covered. The chunks are then organized in a binary tree of axis aligned boxes built
+/// top-down by median splits.
+///
+/// Queries traverse the tree in best-first order using the distance to the boxes as a lower bound of the
+/// distance to the lanes. Therefore, maliput::api::Lane::ToLanePosition() is called at most once per lane
+/// and in increasing lower-bound order, and the search terminates as soon as no remaining volume can hold a
+/// closer result.
+///
+/// Similarly to KDTreeStrategy, the hierarchy is built in construction time by sampling the lanes, therefore
+/// the RoadGeometry should be entirely built before this class instantiation.
+class BVHStrategy final : public StrategyBase {
+ public:
+  /// Constructs a BVHStrategy.
+  /// @param rg The maliput::api::RoadGeometry to organize. It must not be nullptr.
+  /// @param chunk_length The maximum length in the `s` coordinate covered by each volume. It must be positive.
+  ///        Within each chunk, lanes are sampled at a quarter of this distance to compute the volumes.
+  /// @throws maliput::common::assertion_error When @p rg is nullptr.
+  /// @throws maliput::common::assertion_error When @p chunk_length is not positive.
+  BVHStrategy(const api::RoadGeometry* rg, double chunk_length);
+  ~BVHStrategy() override = default;
+
+ private:
+  // A chunk of a lane enclosed by an axis aligned box.
+  struct Primitive {
+    math::AxisAlignedBox box;
+    const api::Lane* lane{};
+  };
+
+  // A node in the hierarchy. Leaf nodes refer to the range [begin, end) in primitives_,
+  // inner nodes have both `left` and `right` children.
+  struct Node {
+    math::AxisAlignedBox box;
+    std::optional<std::size_t> left;
+    std::optional<std::size_t> right;
+    std::size_t begin{};
+    std::size_t end{};
+  };
+
+  // Documentation inherited.
+  api::RoadPositionResult DoToRoadPosition(const api::InertialPosition& inertial_position,
+                                           const std::optional<api::RoadPosition>& hint) const override;
+
+  // Documentation inherited.
+  std::vector<api::RoadPositionResult> DoFindRoadPositions(const api::InertialPosition& inertial_position,
+                                                           double radius) const override;
+
+  // Builds the volumes of the chunks of @p lane and appends them to primitives_.
+  void AddLanePrimitives(const api::Lane* lane);
+
+  // Builds the subtree for primitives_ in the range [begin, end).
+  // @returns The index of the root node of the subtree in nodes_.
+  std::size_t BuildNode(std::size_t begin, std::size_t end);
+
+  // Obtains the distinct lanes whose volumes are within @p radius of @p inertial_position.
+  // @returns The lanes, sorted by increasing distance to their closest volume.
+  std::vector<const api::Lane*> FindCandidateLanes(const math::Vector3& inertial_position, double radius) const;
+
+  static constexpr std::size_t kMaxPrimitivesPerLeaf{4};
+
+  const double chunk_length_{};
+  std::vector<Primitive> primitives_;
+  std::vector<Node> nodes_;
+};
+
+}  // namespace geometry_base
+}  // namespace maliput
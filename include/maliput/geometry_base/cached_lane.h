@@ -0,0 +1,157 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2023, Woven by Toyota. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+#include "maliput/api/branch_point.h"
+#include "maliput/api/lane.h"
+#include "maliput/api/lane_data.h"
+#include "maliput/api/segment.h"
+#include "maliput/common/maliput_copyable.h"
+#include "maliput/geometry_base/lru_cache.h"
+
+namespace maliput {
+namespace geometry_base {
+
+class CachedRoadGeometry;
+
+/// An api::Lane decorator that memoizes the pure geometric queries of another
+/// api::Lane.
+///
+/// length() is evaluated once, at construction. lane_bounds(),
+/// segment_bounds(), elevation_bounds() and ToInertialPosition() are cached
+/// in bounded LruCaches keyed by their arguments, quantized to multiples of
+/// `quantum`. On a miss, the wrapped lane is evaluated at the quantized
+/// arguments (with `s` clamped to `[0, length()]`), so results do not depend on
+/// the order of the queries and differ from the ones of the wrapped lane by,
+/// at most, their variation within half a `quantum`.
+///
+/// Every other query is forwarded to the wrapped lane. Topology queries
+/// (segment(), to_left(), to_right() and the branch queries) return the
+/// wrapped objects, unless the CachedLane belongs to a CachedRoadGeometry, in
+/// which case they return the decorators of that CachedRoadGeometry.
+///
+/// Instances are thread safe as long as the wrapped lane is.
+class CachedLane final : public api::Lane {
+ public:
+  MALIPUT_NO_COPY_NO_MOVE_NO_ASSIGN(CachedLane);
+
+  /// Lookup counters of each cached query.
+  struct Statistics {
+    CacheStatistics lane_bounds;
+    CacheStatistics segment_bounds;
+    CacheStatistics elevation_bounds;
+    CacheStatistics to_inertial_position;
+  };
+
+  /// Constructs a CachedLane.
+  /// @param lane The api::Lane to decorate. It must not be nullptr and must
+  ///        outlive this object.
+  /// @param quantum The resolution of the cache keys, in the units of the
+  ///        lane coordinates. It must be positive.
+  /// @param capacity The maximum number of entries of each query cache. It
+  ///        must be positive.
+  /// @throws maliput::common::assertion_error When @p lane is nullptr, or
+  ///         @p quantum or @p capacity are not positive.
+  CachedLane(const api::Lane* lane, double quantum, std::size_t capacity);
+
+  /// @returns The decorated api::Lane.
+  const api::Lane* lane() const { return lane_; }
+
+  /// @returns The resolution of the cache keys.
+  double quantum() const { return quantum_; }
+
+  /// @returns The lookup counters of the caches since construction.
+  Statistics statistics() const;
+
+ private:
+  friend class CachedRoadGeometry;
+
+  // Constructs a CachedLane whose topology queries return the decorators of @p road_geometry.
+  CachedLane(const api::Lane* lane, double quantum, std::size_t capacity, const CachedRoadGeometry* road_geometry);
+  // Quantized query arguments.
+  using Key1 = int64_t;
+  using Key2 = std::array<int64_t, 2>;
+  using Key3 = std::array<int64_t, 3>;
+
+  template <std::size_t N>
+  struct KeyHash {
+    std::size_t operator()(const std::array<int64_t, N>& key) const;
+  };
+
+  // @returns @p value rounded to the closest multiple of quantum_, in quanta.
+  int64_t Quantize(double value) const;
+  // @returns The quantized s coordinate @p key, clamped to the lane.
+  double QuantizedS(int64_t key) const;
+
+  api::LaneId do_id() const override { return lane_->id(); }
+  const api::Segment* do_segment() const override;
+  int do_index() const override { return lane_->index(); }
+  const api::Lane* do_to_left() const override;
+  const api::Lane* do_to_right() const override;
+  double do_length() const override { return length_; }
+  api::RBounds do_lane_bounds(double s) const override;
+  api::RBounds do_segment_bounds(double s) const override;
+  api::HBounds do_elevation_bounds(double s, double r) const override;
+  api::InertialPosition DoToInertialPosition(const api::LanePosition& lane_pos) const override;
+  api::LanePositionResult DoToLanePosition(const api::InertialPosition& inertial_pos) const override {
+    return lane_->ToLanePosition(inertial_pos);
+  }
+  api::LanePositionResult DoToSegmentPosition(const api::InertialPosition& inertial_pos) const override {
+    return lane_->ToSegmentPosition(inertial_pos);
+  }
+  api::Rotation DoGetOrientation(const api::LanePosition& lane_pos) const override {
+    return lane_->GetOrientation(lane_pos);
+  }
+  api::LanePosition DoEvalMotionDerivatives(const api::LanePosition& position,
+                                            const api::IsoLaneVelocity& velocity) const override {
+    return lane_->EvalMotionDerivatives(position, velocity);
+  }
+  const api::BranchPoint* DoGetBranchPoint(const api::LaneEnd::Which which_end) const override;
+  const api::LaneEndSet* DoGetConfluentBranches(const api::LaneEnd::Which which_end) const override;
+  const api::LaneEndSet* DoGetOngoingBranches(const api::LaneEnd::Which which_end) const override;
+  std::optional<api::LaneEnd> DoGetDefaultBranch(const api::LaneEnd::Which which_end) const override;
+
+  const api::Lane* lane_{};
+  // The CachedRoadGeometry this lane belongs to, if any.
+  const CachedRoadGeometry* road_geometry_{};
+  const double quantum_{};
+  const double length_{};
+  mutable LruCache<Key1, api::RBounds> lane_bounds_;
+  mutable LruCache<Key1, api::RBounds> segment_bounds_;
+  mutable LruCache<Key2, api::HBounds, KeyHash<2>> elevation_bounds_;
+  mutable LruCache<Key3, api::InertialPosition, KeyHash<3>> inertial_positions_;
+};
+
+}  // namespace geometry_base
+}  // namespace maliput
@@ -0,0 +1,149 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2023, Woven by Toyota. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include "maliput/api/lane.h"
+#include "maliput/api/lane_data.h"
+#include "maliput/api/road_geometry.h"
+#include "maliput/common/maliput_copyable.h"
+#include "maliput/geometry_base/cached_lane.h"
+
+namespace maliput {
+namespace geometry_base {
+
+/// An api::RoadGeometry decorator that memoizes the pure geometric queries of
+/// the lanes of another api::RoadGeometry.
+///
+/// Every lane of the wrapped api::RoadGeometry is decorated with a CachedLane,
+/// and every Junction, Segment and BranchPoint with a decorator that forwards
+/// to the wrapped one. The hierarchy of this object only holds decorators:
+/// navigating it (e.g. junction(i)->segment(j)->lane(k), Lane::segment() or
+/// the branch queries), ById() and the position queries (ToRoadPosition(),
+/// ToRoadPositions() and FindRoadPositions()) return decorators, and their
+/// owners are decorators as well, so CheckInvariants() holds for this object
+/// whenever it holds for the wrapped one. Hints may hold either CachedLanes
+/// or the wrapped lanes.
+///
+/// Instances are thread safe as long as the wrapped api::RoadGeometry is.
+class CachedRoadGeometry final : public api::RoadGeometry {
+ public:
+  MALIPUT_NO_COPY_NO_MOVE_NO_ASSIGN(CachedRoadGeometry);
+
+  /// Constructs a CachedRoadGeometry.
+  /// @param road_geometry The api::RoadGeometry to decorate. It must not be
+  ///        nullptr and must outlive this object.
+  /// @param quantum The resolution of the cache keys. @see CachedLane.
+  /// @param capacity The maximum number of entries of each query cache of
+  ///        each lane. @see CachedLane.
+  /// @throws maliput::common::assertion_error When @p road_geometry is
+  ///         nullptr, or @p quantum or @p capacity are not positive.
+  CachedRoadGeometry(const api::RoadGeometry* road_geometry, double quantum, std::size_t capacity);
+
+  ~CachedRoadGeometry() override;
+
+  /// @returns The decorated api::RoadGeometry.
+  const api::RoadGeometry* road_geometry() const { return road_geometry_; }
+
+  /// @returns The CachedLane that decorates @p lane, @p lane itself when it is
+  /// a CachedLane of this object, or nullptr when @p lane does not belong to
+  /// the decorated api::RoadGeometry.
+  const CachedLane* GetCachedLane(const api::Lane* lane) const;
+
+  /// @returns The sum of the lookup counters of all CachedLanes.
+  CachedLane::Statistics statistics() const;
+
+ private:
+  // CachedLanes resolve their topology queries into the decorators of this object.
+  friend class CachedLane;
+
+  class CachedIdIndex;
+  class CachedJunction;
+  class CachedSegment;
+  class CachedLaneEndSet;
+  class CachedBranchPoint;
+
+  // @returns The wrapped lane of @p lane when it is a CachedLane, @p lane otherwise.
+  static const api::Lane* Unwrap(const api::Lane* lane);
+
+  // @returns The decorator of @p junction, or nullptr when @p junction does not belong to the decorated
+  // api::RoadGeometry.
+  const api::Junction* GetCachedJunction(const api::Junction* junction) const;
+
+  // @returns The decorator of @p segment, or nullptr when @p segment does not belong to the decorated
+  // api::RoadGeometry.
+  const api::Segment* GetCachedSegment(const api::Segment* segment) const;
+
+  // @returns The decorator of @p branch_point, or nullptr when @p branch_point does not belong to the decorated
+  // api::RoadGeometry.
+  const api::BranchPoint* GetCachedBranchPoint(const api::BranchPoint* branch_point) const;
+
+  // @returns @p results with their lanes replaced by their CachedLanes.
+  std::vector<api::RoadPositionResult> Wrap(std::vector<api::RoadPositionResult> results) const;
+
+  api::RoadGeometryId do_id() const override { return road_geometry_->id(); }
+  int do_num_junctions() const override { return road_geometry_->num_junctions(); }
+  const api::Junction* do_junction(int index) const override {
+    return GetCachedJunction(road_geometry_->junction(index));
+  }
+  int do_num_branch_points() const override { return road_geometry_->num_branch_points(); }
+  const api::BranchPoint* do_branch_point(int index) const override {
+    return GetCachedBranchPoint(road_geometry_->branch_point(index));
+  }
+  const IdIndex& DoById() const override;
+  api::RoadPositionResult DoToRoadPosition(const api::InertialPosition& inertial_position,
+                                           const std::optional<api::RoadPosition>& hint) const override;
+  std::vector<api::RoadPositionResult> DoToRoadPositions(const std::vector<api::InertialPosition>& inertial_positions,
+                                                         const std::vector<std::optional<api::RoadPosition>>& hints,
+                                                         std::size_t num_threads) const override;
+  std::vector<api::RoadPositionResult> DoFindRoadPositions(const api::InertialPosition& inertial_position,
+                                                           double radius) const override;
+  double do_linear_tolerance() const override { return road_geometry_->linear_tolerance(); }
+  double do_angular_tolerance() const override { return road_geometry_->angular_tolerance(); }
+  double do_scale_length() const override { return road_geometry_->scale_length(); }
+  math::Vector3 do_inertial_to_backend_frame_translation() const override {
+    return road_geometry_->inertial_to_backend_frame_translation();
+  }
+
+  const api::RoadGeometry* road_geometry_{};
+  // Decorators keyed by the wrapped objects.
+  std::unordered_map<const api::Lane*, std::unique_ptr<CachedLane>> cached_lanes_;
+  std::unordered_map<const api::Segment*, std::unique_ptr<CachedSegment>> cached_segments_;
+  std::unordered_map<const api::Junction*, std::unique_ptr<CachedJunction>> cached_junctions_;
+  std::unordered_map<const api::BranchPoint*, std::unique_ptr<CachedBranchPoint>> cached_branch_points_;
+  std::unique_ptr<CachedIdIndex> id_index_;
+};
+
+}  // namespace geometry_base
+}  // namespace maliput
@@ -29,10 +29,14 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <optional>
+#include <string>
 #include <vector>
 
+#include "maliput/common/mapped_file.h"
 #include "maliput/geometry_base/strategy_base.h"
 #include "maliput/math/kd_tree.h"
 
@@ -45,12 +49,53 @@ namespace geometry_base {
 /// the RoadGeometry should be entirely built before this class instantiation.
 class KDTreeStrategy final : public StrategyBase {
  public:
-  KDTreeStrategy(const api::RoadGeometry* rg, double sampling_step);
+  /// Constructs a KDTreeStrategy.
+  ///
+  /// Lanes are sampled every @p sampling_step in both s and r coordinates. When @p num_threads is greater than one,
+  /// lanes are sampled concurrently and the upper levels of the kd-tree are built in parallel. The resulting index is
+  /// identical to the one built with a single thread, so queries do not depend on @p num_threads.
+  ///
+  /// @param rg The road geometry to index. Its lanes must support concurrent const queries when @p num_threads is
+  /// greater than one.
+  /// @param sampling_step The distance between samples.
+  /// @param num_threads Number of threads used to build the index.
+  /// @throws maliput::common::assertion_error When @p num_threads is zero.
+  KDTreeStrategy(const api::RoadGeometry* rg, double sampling_step, std::size_t num_threads = 1);
+
+  /// Constructs a KDTreeStrategy whose index is persisted in @p cache_path.
+  ///
+  /// When @p cache_path holds an index saved for a road geometry with the same id, the same content hash and the same
+  /// @p sampling_step, the file is memory-mapped and the index is restored from it without sampling the lanes nor
+  /// sorting the samples. The kd-tree reads the sample coordinates in place from the mapped file, which stays mapped
+  /// while this strategy lives; only the lane each sample belongs to is resolved when loading. Otherwise, the index
+  /// is built as in the other constructor and saved in @p cache_path so following instantiations can reuse it.
+  /// Failing to write the cache is not an error.
+  ///
+  /// The content hash is computed out of the lane ids and lengths, and the lane bounds and centerline position of
+  /// each lane every @p sampling_step along s. It is meant to detect stale caches, modifications that don't alter any
+  /// of these are not detected.
+  ///
+  /// @param rg The road geometry to index.
+  /// @param sampling_step The distance between samples.
+  /// @param num_threads Number of threads used to build the index when the cache can't be used.
+  /// @param cache_path Path to the cache file.
+  /// @throws maliput::common::assertion_error When @p num_threads is zero.
+  KDTreeStrategy(const api::RoadGeometry* rg, double sampling_step, std::size_t num_threads,
+                 const std::string& cache_path);
+
   ~KDTreeStrategy() override = default;
 
+  /// Saves the index in @p path.
+  ///
+  /// The file is written next to @p path and then renamed, so concurrent readers never see a partially written
+  /// cache. See the cache constructor for further details.
+  /// @param path Path to the cache file.
+  /// @throws maliput::common::assertion_error When the file can't be written.
+  void SaveIndex(const std::string& path) const;
+
  private:
   /// A wrapper around maliput::math::Vector3 that also stores the lane_id
-  /// Convenient for the KDTree3D population.
+  /// Convenient for the ImplicitKDTree3D population.
   class MaliputPoint : public maliput::math::Vector3 {
    public:
     /// Creates a MaliputPoint from a Vector3.
@@ -60,7 +105,9 @@ class KDTreeStrategy final : public StrategyBase {
     /// Creates a MaliputPoint from a Vector3 and a lane_id.
     /// @param xyz The Vector3 to be wrapped.
     /// @param lane The lane the point belongs to.
-    MaliputPoint(const Vector3& xyz, const api::Lane* lane) : Vector3(xyz), lane_(std::make_optional(lane)) {
+    /// @param lane_index The index of @p lane in the lanes of the RoadGeometry sorted by id.
+    MaliputPoint(const Vector3& xyz, const api::Lane* lane, std::uint32_t lane_index)
+        : Vector3(xyz), lane_(std::make_optional(lane)), lane_index_(lane_index) {
       MALIPUT_THROW_UNLESS(lane != nullptr);
     }
 
@@ -70,10 +117,35 @@ class KDTreeStrategy final : public StrategyBase {
     /// @return The lane if any, std::nullopt otherwise.
     std::optional<const api::Lane*> get_lane() const { return lane_; }
 
+    /// Returns the index of the lane in the lanes of the RoadGeometry sorted by id.
+    /// It is meaningless when the point has no lane.
+    std::uint32_t lane_index() const { return lane_index_; }
+
    private:
     std::optional<const api::Lane*> lane_;
+    std::uint32_t lane_index_{0};
   };
 
+  // Distinct lanes of the samples reported by a kd-tree search. Defined in the translation unit.
+  class CandidateLanes;
+
+  // Samples @p lane every @p sampling_step in s and r coordinates, at h = 0.
+  // @p lane_index is the index of @p lane in the lanes of the RoadGeometry sorted by id.
+  // @p max_elevation is set to the largest absolute elevation bound found at the samples.
+  static std::vector<MaliputPoint> SampleLane(const api::Lane* lane, std::uint32_t lane_index, double sampling_step,
+                                              double* max_elevation);
+
+  // Samples the lanes and builds the kd-tree using up to @p num_threads threads.
+  void BuildIndex(std::size_t num_threads);
+
+  // Restores the kd-tree from the cache file at @p path.
+  // @returns False when the file doesn't exist or doesn't match the road geometry and the sampling step.
+  bool LoadIndex(const std::string& path);
+
+  // Writes the cache file at @p path.
+  // @returns False when the file can't be written.
+  bool WriteIndex(const std::string& path) const;
+
   // Documentation inherited.
   api::RoadPositionResult DoToRoadPosition(const api::InertialPosition& inertial_position,
                                            const std::optional<api::RoadPosition>& hint) const override;
@@ -84,16 +156,28 @@ class KDTreeStrategy final : public StrategyBase {
 
   // Obtains the closest lane in the road geometry to a given point.
   // @param point The point to be used as reference.
+  // @param statistics When it is not nullptr, the counters of the query are added to it.
   // @return The closest lane to the point.
-  api::RoadPositionResult ClosestLane(const api::InertialPosition& inertial_position) const;
+  api::RoadPositionResult ClosestLane(const api::InertialPosition& inertial_position,
+                                      StrategyStatistics* statistics) const;
 
   // Obtains the closest lanes in the road geometry to a given point within a region around the point.
   // The region is an axis-aligned box with the point as center and the distance as half of the box's edge length.
-  std::deque<const api::Lane*> ClosestLanes(const api::InertialPosition& point, double half_edge_length) const;
+  // The distinct lanes found are added to @p lanes.
+  // When @p statistics is not nullptr, the counters of the search are added to it.
+  void ClosestLanes(const api::InertialPosition& point, double half_edge_length, CandidateLanes* lanes,
+                    StrategyStatistics* statistics) const;
 
-  std::unique_ptr<math::KDTree3D<MaliputPoint>> kd_tree_;
+  // The cache file the index was loaded from, if any. The kd-tree reads its coordinates from it.
+  std::unique_ptr<common::MappedFile> index_file_;
+  std::unique_ptr<math::ImplicitKDTree3D<MaliputPoint>> kd_tree_;
 
   const double sampling_step_;
+  // Largest absolute elevation bound of the samples. Samples lie at h = 0, so lane positions may be this far from
+  // their closest sample in addition to the sampling step.
+  double max_elevation_{0.};
+  // Number of lanes of the RoadGeometry, which bounds MaliputPoint::lane_index().
+  std::size_t num_lanes_{0};
 };
 
 }  // namespace geometry_base
@@ -0,0 +1,148 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2023, Woven by Toyota. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+
+#include "maliput/common/maliput_copyable.h"
+#include "maliput/common/maliput_throw.h"
+
+namespace maliput {
+namespace geometry_base {
+
+/// Counts the lookups of a cache.
+struct CacheStatistics {
+  /// @returns The fraction of lookups that found their key, or zero when
+  /// there were no lookups.
+  double hit_rate() const {
+    const int64_t lookups = hits + misses;
+    return lookups == 0 ? 0. : static_cast<double>(hits) / static_cast<double>(lookups);
+  }
+
+  /// Lookups that found their key.
+  int64_t hits{0};
+  /// Lookups that did not find their key.
+  int64_t misses{0};
+};
+
+/// A thread-safe cache that holds up to `capacity` entries and evicts the
+/// least recently used one when it is full.
+///
+/// @tparam Key The type of the keys. It must be hashable by @p Hash and
+///         EqualityComparable.
+/// @tparam Value The type of the cached values. It must be copyable.
+/// @tparam Hash The hashing functor of @p Key.
+template <typename Key, typename Value, typename Hash = std::hash<Key>>
+class LruCache {
+ public:
+  MALIPUT_NO_COPY_NO_MOVE_NO_ASSIGN(LruCache);
+
+  /// Constructs an empty cache.
+  /// @param capacity The maximum number of entries. It must be positive.
+  /// @throws maliput::common::assertion_error When @p capacity is zero.
+  explicit LruCache(std::size_t capacity) : capacity_(capacity) { MALIPUT_THROW_UNLESS(capacity_ > 0); }
+
+  /// Looks @p key up and, when found, marks it as the most recently used.
+  /// @returns The value cached for @p key, or std::nullopt when there is none.
+  std::optional<Value> Get(const Key& key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    const auto it = index_.find(key);
+    if (it == index_.end()) {
+      ++statistics_.misses;
+      return std::nullopt;
+    }
+    ++statistics_.hits;
+    entries_.splice(entries_.begin(), entries_, it->second);
+    return it->second->second;
+  }
+
+  /// Caches @p value for @p key as the most recently used entry, evicting the
+  /// least recently used one when the cache is full. When @p key is already
+  /// cached, its value is kept.
+  void Put(const Key& key, const Value& value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (index_.find(key) != index_.end()) {
+      return;
+    }
+    if (entries_.size() == capacity_) {
+      index_.erase(entries_.back().first);
+      entries_.pop_back();
+    }
+    entries_.emplace_front(key, value);
+    index_.emplace(key, entries_.begin());
+  }
+
+  /// @returns The value cached for @p key, computing it with @p compute and
+  /// caching it when there is none. @p compute runs without holding the lock,
+  /// so concurrent misses of the same key may compute it more than once.
+  template <typename Compute>
+  Value GetOrCompute(const Key& key, Compute&& compute) {
+    std::optional<Value> value = Get(key);
+    if (!value.has_value()) {
+      value = compute();
+      Put(key, *value);
+    }
+    return *value;
+  }
+
+  /// @returns The number of cached entries.
+  std::size_t size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return entries_.size();
+  }
+
+  /// @returns The maximum number of entries.
+  std::size_t capacity() const { return capacity_; }
+
+  /// @returns The lookup counters since construction.
+  CacheStatistics statistics() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return statistics_;
+  }
+
+ private:
+  // Entries, from the most to the least recently used.
+  using Entries = std::list<std::pair<Key, Value>>;
+
+  const std::size_t capacity_{};
+  mutable std::mutex mutex_;
+  Entries entries_;
+  std::unordered_map<Key, typename Entries::iterator, Hash> index_;
+  CacheStatistics statistics_;
+};
+
+}  // namespace geometry_base
+}  // namespace maliput
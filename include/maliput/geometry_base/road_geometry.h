@@ -29,6 +29,7 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #pragma once
 
+#include <cstddef>
 #include <memory>
 #include <type_traits>
 #include <utility>
@@ -42,6 +43,7 @@
 #include "maliput/common/maliput_throw.h"
 #include "maliput/geometry_base/branch_point.h"
 #include "maliput/geometry_base/brute_force_strategy.h"
+#include "maliput/geometry_base/bvh_strategy.h"
 #include "maliput/geometry_base/junction.h"
 #include "maliput/geometry_base/kd_tree_strategy.h"
 #include "maliput/geometry_base/strategy_base.h"
@@ -72,6 +74,10 @@ namespace geometry_base {
 /// 2. KdTreeStrategy: This strategy performs a search for the nearest lane on the road network using a KdTree.
 ///                    In order to achieve this, the kdtree space needs to initialized, which is done by calling
 ///                    InitializeStrategy() method, after all the lanes have been added to the road geometry.
+/// 3. BVHStrategy: This strategy performs a best-first search over a bounding volume hierarchy of lane chunks.
+///                 Each lane is evaluated at most once per query and the search stops when no remaining volume
+///                 can hold a closer result. As with KdTreeStrategy, it is initialized by calling
+///                 InitializeStrategy() method, after all the lanes have been added to the road geometry.
 ///
 /// The InitializeStrategy() method allows you to indicate which strategy you want to use for the search and it is
 /// mandatory to call it before using the DoToRoadPosition and DoToFindRoadPosition methods.
@@ -89,6 +95,7 @@ namespace geometry_base {
 /// // Initialize the strategy.
 /// road_geometry->InitializeStrategy<maliput::geometry_base::KDTreeStrategy>(0.25 /* sampling step */);
 /// // or road_geometry->InitializeStrategy<maliput::geometry_base::BruteForceStrategy>();
+/// // or road_geometry->InitializeStrategy<maliput::geometry_base::BVHStrategy>(10. /* chunk length */);
 /// @endcode
 ///
 class RoadGeometry : public api::RoadGeometry {
@@ -161,6 +168,10 @@ class RoadGeometry : public api::RoadGeometry {
     strategy_ = std::make_unique<StrategyT>(this, std::forward<Args>(args)...);
   }
 
+  /// @returns The strategy that resolves ToRoadPosition() and FindRoadPositions(), e.g. to collect its
+  /// StrategyStatistics.
+  const StrategyBase& strategy() const { return *strategy_; }
+
   ~RoadGeometry() override = default;
 
  private:
@@ -171,6 +182,12 @@ class RoadGeometry : public api::RoadGeometry {
   virtual std::vector<api::RoadPositionResult> DoFindRoadPositions(const api::InertialPosition& inertial_position,
                                                                    double radius) const override;
 
+  // Forwards the batch to the strategy, which may fan it out across @p num_threads.
+  // Derived classes overriding DoToRoadPosition() should override this method as well.
+  virtual std::vector<api::RoadPositionResult> DoToRoadPositions(
+      const std::vector<api::InertialPosition>& inertial_positions,
+      const std::vector<std::optional<api::RoadPosition>>& hints, std::size_t num_threads) const override;
+
   // The non-template implementation of AddJunction<T>()
   void AddJunctionPrivate(std::unique_ptr<Junction> junction);
 
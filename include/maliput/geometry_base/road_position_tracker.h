@@ -0,0 +1,115 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2023, Woven by Toyota. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <cstddef>
+#include <optional>
+
+#include "maliput/api/lane_data.h"
+#include "maliput/api/road_geometry.h"
+#include "maliput/common/maliput_copyable.h"
+
+namespace maliput {
+namespace geometry_base {
+
+/// Tracks the api::RoadPosition of a continuously moving agent.
+///
+/// Each call to Update() localizes the new api::InertialPosition by first
+/// querying the lane of the previous api::RoadPosition, its adjacent lanes
+/// (api::Lane::to_left() and api::Lane::to_right()) and the lanes that continue
+/// it at both ends (api::Lane::GetOngoingBranches()). Only when none of those
+/// lanes contains the position within api::RoadGeometry::linear_tolerance(),
+/// the query falls back to api::RoadGeometry::ToRoadPosition(), which uses the
+/// RoadGeometry's global strategy.
+///
+/// For agents moving less than a lane length per tick, localization is then
+/// a constant number of api::Lane::ToLanePosition() calls.
+///
+/// Results are equivalent to the ones of api::RoadGeometry::ToRoadPosition()
+/// whenever the position lies within a lane. When the position lies in the
+/// overlap of several lanes, the tracker may keep the previous lane.
+///
+/// Instances are not thread safe; use one tracker per agent.
+class RoadPositionTracker {
+ public:
+  MALIPUT_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(RoadPositionTracker);
+
+  /// Constructs a tracker without a previous api::RoadPosition.
+  /// @param road_geometry The api::RoadGeometry to localize against. It must
+  ///        not be nullptr and must outlive this object.
+  /// @throws maliput::common::assertion_error When @p road_geometry is nullptr.
+  explicit RoadPositionTracker(const api::RoadGeometry* road_geometry);
+
+  /// Constructs a tracker whose first Update() starts from @p road_position.
+  /// @param road_geometry The api::RoadGeometry to localize against. It must
+  ///        not be nullptr and must outlive this object.
+  /// @param road_position The initial api::RoadPosition. Its lane must belong
+  ///        to @p road_geometry.
+  /// @throws maliput::common::assertion_error When @p road_geometry or
+  ///         `road_position.lane` are nullptr.
+  RoadPositionTracker(const api::RoadGeometry* road_geometry, const api::RoadPosition& road_position);
+
+  /// Localizes @p inertial_position and records the result as the hint for
+  /// the next call.
+  /// @param inertial_position The position to localize.
+  /// @returns The api::RoadPositionResult for @p inertial_position.
+  api::RoadPositionResult Update(const api::InertialPosition& inertial_position);
+
+  /// Drops the tracked api::RoadPosition, so the next Update() queries the
+  /// whole api::RoadGeometry.
+  void Reset() { road_position_.reset(); }
+
+  /// @returns The last tracked api::RoadPosition, if any.
+  const std::optional<api::RoadPosition>& road_position() const { return road_position_; }
+
+  /// @returns The number of Update() calls that were resolved by the lanes
+  /// around the tracked api::RoadPosition.
+  std::size_t num_local_hits() const { return num_local_hits_; }
+
+  /// @returns The number of Update() calls that used
+  /// api::RoadGeometry::ToRoadPosition().
+  std::size_t num_fallbacks() const { return num_fallbacks_; }
+
+ private:
+  // Evaluates @p lane and, when it is closer than @p best, stores the result
+  // in @p best.
+  static void Consider(const api::Lane* lane, const api::InertialPosition& inertial_position,
+                       std::optional<api::RoadPositionResult>* best);
+
+  // Evaluates the lanes around `road_position_->lane`.
+  std::optional<api::RoadPositionResult> LocalSearch(const api::InertialPosition& inertial_position) const;
+
+  const api::RoadGeometry* road_geometry_{};
+  std::optional<api::RoadPosition> road_position_{};
+  std::size_t num_local_hits_{0};
+  std::size_t num_fallbacks_{0};
+};
+
+}  // namespace geometry_base
+}  // namespace maliput
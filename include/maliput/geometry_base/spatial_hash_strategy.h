@@ -0,0 +1,132 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2023, Woven by Toyota. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "maliput/api/lane.h"
+#include "maliput/common/maliput_hash.h"
+#include "maliput/geometry_base/strategy_base.h"
+#include "maliput/math/vector.h"
+
+namespace maliput {
+namespace geometry_base {
+
+/// Implements StrategyBase by rasterizing the maliput::api::Lane footprints into a uniform hash grid over the
+/// inertial XY plane.
+///
+/// Each maliput::api::Lane is split along its `s` coordinate into chunks of at most `cell_size` length, and each
+/// chunk is enclosed by an axis aligned box that covers the lane volume (lane bounds and elevation bounds). Every
+/// grid cell the XY projection of a box overlaps records the lane along with the `z` range of the box, so each cell
+/// holds the list of lanes that may contain points within it.
+///
+/// Queries visit the cells in rings of growing Chebyshev distance around the cell of the query point. A cell entry
+/// is only evaluated with maliput::api::Lane::ToLanePosition() when the distance to its cell, extruded along the
+/// entry's `z` range, may improve the result; and the search stops as soon as the next ring is farther than the
+/// best result. Therefore, for points on or near the road, the cost of a query depends on the lane density around
+/// the point and not on the size of the RoadGeometry.
+///
+/// This strategy suits road networks that are mostly planar: lanes that stack over each other (e.g. bridges) share
+/// cells and are told apart by their `z` ranges only.
+///
+/// Similarly to KDTreeStrategy, the grid is built in construction time by sampling the lanes, therefore the
+/// RoadGeometry should be entirely built before this class instantiation.
+class SpatialHashStrategy final : public StrategyBase {
+ public:
+  /// Constructs a SpatialHashStrategy.
+  /// @param rg The maliput::api::RoadGeometry to organize. It must not be nullptr.
+  /// @param cell_size The side length of the grid cells. It must be positive. Lanes are sampled at a quarter of
+  ///        this distance to compute the footprints. Values in the order of the lane width are a good start.
+  /// @throws maliput::common::assertion_error When @p rg is nullptr.
+  /// @throws maliput::common::assertion_error When @p cell_size is not positive.
+  SpatialHashStrategy(const api::RoadGeometry* rg, double cell_size);
+  ~SpatialHashStrategy() override = default;
+
+  /// @returns The number of non empty cells.
+  std::size_t num_cells() const { return cells_.size(); }
+
+  /// @returns The total number of lane entries across all the cells.
+  std::size_t num_entries() const { return entries_.size(); }
+
+ private:
+  // A lane that may have points within a cell, along with the `z` range those points may have.
+  struct Entry {
+    const api::Lane* lane{};
+    double min_z{};
+    double max_z{};
+  };
+
+  // The grid indices of a cell along the x and y axes.
+  using CellKey = std::pair<std::int64_t, std::int64_t>;
+
+  // The range [begin, end) of a cell's entries in entries_.
+  struct Range {
+    std::size_t begin{};
+    std::size_t end{};
+  };
+
+  // Documentation inherited.
+  api::RoadPositionResult DoToRoadPosition(const api::InertialPosition& inertial_position,
+                                           const std::optional<api::RoadPosition>& hint) const override;
+
+  // Documentation inherited.
+  std::vector<api::RoadPositionResult> DoFindRoadPositions(const api::InertialPosition& inertial_position,
+                                                           double radius) const override;
+
+  // Rasterizes the chunks of @p lane into @p cells.
+  void AddLane(const api::Lane* lane, std::unordered_map<CellKey, std::vector<Entry>, common::DefaultHash>* cells);
+
+  // @returns The grid index of the cell holding @p coordinate.
+  std::int64_t CellIndex(double coordinate) const;
+
+  // @returns The distance from @p xyz to the volume of @p entry in cell (@p ix, @p iy).
+  double Distance(const math::Vector3& xyz, std::int64_t ix, std::int64_t iy, const Entry& entry) const;
+
+  // Calls @p visitor with each entry of cell (@p ix, @p iy), if the cell is not empty.
+  template <typename Visitor>
+  void VisitCell(std::int64_t ix, std::int64_t iy, Visitor&& visitor) const;
+
+  const double cell_size_{};
+  std::vector<Entry> entries_;
+  std::unordered_map<CellKey, Range, common::DefaultHash> cells_;
+  // Bounds of the grid indices of the non empty cells. They describe an empty range when there are no cells.
+  std::int64_t min_ix_{std::numeric_limits<std::int64_t>::max()};
+  std::int64_t max_ix_{std::numeric_limits<std::int64_t>::min()};
+  std::int64_t min_iy_{std::numeric_limits<std::int64_t>::max()};
+  std::int64_t max_iy_{std::numeric_limits<std::int64_t>::min()};
+};
+
+}  // namespace geometry_base
+}  // namespace maliput
@@ -29,6 +29,9 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #pragma once
 
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <optional>
 #include <vector>
@@ -48,28 +51,88 @@ namespace geometry_base {
 bool IsNewRoadPositionResultCloser(const maliput::api::RoadPositionResult& new_road_position_result,
                                    const maliput::api::RoadPositionResult& road_position_result);
 
+/// Counters of the queries resolved by a StrategyBase. See StrategyBase::EnableStatistics().
+/// Counters that don't apply to a strategy remain zero.
+struct StrategyStatistics {
+  /// Number of resolved ToRoadPosition() and FindRoadPositions() queries, batched ones included.
+  int64_t num_queries{0};
+  /// Number of nodes of the spatial index visited by the searches.
+  int64_t num_visited_nodes{0};
+  /// Number of points reported by the searches of the spatial index.
+  int64_t num_returned_points{0};
+  /// Number of distinct candidate lanes, summed over the queries.
+  int64_t num_candidate_lanes{0};
+  /// Number of maliput::api::Lane::ToLanePosition() calls.
+  int64_t num_to_lane_position_calls{0};
+  /// Number of hinted queries whose result is within the linear tolerance of the hinted lane.
+  int64_t num_hint_hits{0};
+  /// Number of hinted queries whose result is farther than the linear tolerance from the hinted lane.
+  int64_t num_hint_misses{0};
+  /// Largest number of distinct candidate lanes of a single query.
+  int64_t max_candidate_lanes{0};
+  /// Largest number of nodes of the spatial index visited by a single query.
+  int64_t max_visited_nodes{0};
+};
+
 /// Provides a base interface for defining strategies that will affect the behavior
 /// of the queries RoadGeomoetry::ToRoadPosition and RoadGeomoetry::FindRoadPositions.
 /// See RoadGeometry::InitializeStrategy().
+///
+/// Strategies may collect StrategyStatistics of their queries, which is disabled by default. Statistics are not part
+/// of the observable state of the strategy, so they can be toggled and reset through const references, concurrently
+/// with queries.
 class StrategyBase {
  public:
   virtual ~StrategyBase() = default;
 
   api::RoadPositionResult ToRoadPosition(const api::InertialPosition& inertial_position,
                                          const std::optional<api::RoadPosition>& hint) const {
+    CountQueries(1);
     return DoToRoadPosition(inertial_position, hint);
   }
 
   std::vector<api::RoadPositionResult> FindRoadPositions(const api::InertialPosition& inertial_position,
                                                          double radius) const {
+    CountQueries(1);
     return DoFindRoadPositions(inertial_position, radius);
   }
 
+  /// Batched version of ToRoadPosition().
+  /// See maliput::api::RoadGeometry::ToRoadPositions() for a description of the parameters.
+  std::vector<api::RoadPositionResult> ToRoadPositions(const std::vector<api::InertialPosition>& inertial_positions,
+                                                       const std::vector<std::optional<api::RoadPosition>>& hints,
+                                                       std::size_t num_threads) const {
+    CountQueries(static_cast<int64_t>(inertial_positions.size()));
+    return DoToRoadPositions(inertial_positions, hints, num_threads);
+  }
+
+  /// Enables or disables the collection of statistics. Collected statistics are kept.
+  void EnableStatistics(bool enable) const { statistics_enabled_.store(enable, std::memory_order_relaxed); }
+
+  /// @returns Whether statistics are being collected.
+  bool statistics_enabled() const { return statistics_enabled_.load(std::memory_order_relaxed); }
+
+  /// @returns The statistics collected so far. Queries running concurrently may be partially accounted for.
+  StrategyStatistics GetStatistics() const;
+
+  /// Discards the statistics collected so far.
+  void ResetStatistics() const;
+
  protected:
   StrategyBase(const api::RoadGeometry* rg) : rg_(rg) { MALIPUT_THROW_UNLESS(rg_ != nullptr); }
 
   const api::RoadGeometry* get_road_geometry() const { return rg_; }
 
+  /// Adds the counters of a single query to the statistics, when they are enabled. Derived classes are expected to
+  /// check statistics_enabled() before collecting them.
+  /// Queries are counted by StrategyBase, and the maxima are updated out of the counters of @p query_statistics, so
+  /// its `num_queries`, `max_candidate_lanes` and `max_visited_nodes` are ignored.
+  void RecordStatistics(const StrategyStatistics& query_statistics) const;
+
+  /// @returns The statistics of a hinted query whose maliput::api::Lane::ToLanePosition() call on the hinted lane
+  /// returned @p lane_position_result.
+  StrategyStatistics HintedQueryStatistics(const api::LanePositionResult& lane_position_result) const;
+
  private:
   virtual api::RoadPositionResult DoToRoadPosition(const api::InertialPosition& inertial_position,
                                                    const std::optional<api::RoadPosition>& hint) const = 0;
@@ -77,7 +140,37 @@ class StrategyBase {
   virtual std::vector<api::RoadPositionResult> DoFindRoadPositions(const api::InertialPosition& inertial_position,
                                                                    double radius) const = 0;
 
+  // Splits the batch into the contiguous chunks of common::MakeChunks(), which are resolved
+  // concurrently via DoToRoadPosition() with common::ParallelFor() on up to `num_threads` threads.
+  // Derived classes are expected to have a thread-safe DoToRoadPosition(); they may
+  // override this method to provide a more efficient batch resolution.
+  virtual std::vector<api::RoadPositionResult> DoToRoadPositions(
+      const std::vector<api::InertialPosition>& inertial_positions,
+      const std::vector<std::optional<api::RoadPosition>>& hints, std::size_t num_threads) const;
+
+  // Adds @p num_queries to the statistics, when they are enabled.
+  void CountQueries(int64_t num_queries) const {
+    if (statistics_enabled()) {
+      statistics_.num_queries.fetch_add(num_queries, std::memory_order_relaxed);
+    }
+  }
+
+  // Thread-safe counterpart of StrategyStatistics.
+  struct AtomicStatistics {
+    std::atomic<int64_t> num_queries{0};
+    std::atomic<int64_t> num_visited_nodes{0};
+    std::atomic<int64_t> num_returned_points{0};
+    std::atomic<int64_t> num_candidate_lanes{0};
+    std::atomic<int64_t> num_to_lane_position_calls{0};
+    std::atomic<int64_t> num_hint_hits{0};
+    std::atomic<int64_t> num_hint_misses{0};
+    std::atomic<int64_t> max_candidate_lanes{0};
+    std::atomic<int64_t> max_visited_nodes{0};
+  };
+
   const api::RoadGeometry* rg_{};
+  mutable std::atomic<bool> statistics_enabled_{false};
+  mutable AtomicStatistics statistics_;
 };
 
 }  // namespace geometry_base
@@ -70,6 +70,16 @@ class AxisAlignedBox : public BoundingRegion<Vector3> {
   /// @returns The intersection of this region with @p other .
   std::optional<AxisAlignedBox> GetIntersection(const AxisAlignedBox& other) const;
 
+  /// Computes the smallest box that contains both this region and @p other .
+  /// @param other The other region to merge with.
+  /// @returns The union box. It keeps this region's tolerance.
+  AxisAlignedBox GetUnion(const AxisAlignedBox& other) const;
+
+  /// Computes the Euclidean distance from @p position to this region.
+  /// @param position Inertial-frame's coordinate.
+  /// @returns The distance to the closest point in the box, zero when @p position is contained.
+  double Distance(const Vector3& position) const;
+
  private:
   static constexpr double kTolerance{1e-14};
   /// Implements BoundingRegion::do_position() method.
@@ -30,20 +30,36 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <deque>
+#include <iterator>
 #include <limits>
 #include <memory>
+#include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "maliput/common/logger.h"
 #include "maliput/common/maliput_copyable.h"
 #include "maliput/common/maliput_throw.h"
+#include "maliput/common/parallel_for.h"
 #include "maliput/math/axis_aligned_box.h"
 #include "maliput/math/overlapping_type.h"
 
 namespace maliput {
 namespace math {
+
+/// A point found by a k-nearest-neighbour query.
+/// @tparam Coordinate The type of the coordinate.
+template <typename Coordinate>
+struct Neighbour {
+  /// The point in the tree.
+  const Coordinate* coordinate{nullptr};
+  /// Distance to the query point, as computed by the tree's distance functor.
+  double distance{};
+};
+
 namespace details {
 
 /// Represents a node in a kd-tree data structure.
@@ -139,6 +155,49 @@ Node* MakeKdTree(std::size_t begin, std::size_t end, std::size_t index, std::deq
   return &nodes[node_index];
 }
 
+/// Reorders @p points so the range [begin, end) describes an implicit balanced kd-tree.
+/// The node of the range is its median element, located at `begin + (end - begin) / 2`, and its left and right
+/// subtrees are the ranges [begin, median) and [median + 1, end) respectively. This is the same partition
+/// MakeKdTree() produces, but no node structure nor links are created: the layout of the contiguous
+/// container is the tree itself.
+///
+/// @tparam Dimension Dimensions of the tree.
+/// @tparam Coordinate The type of the coordinates. It must provide operator[] for accessing each dimension.
+///
+/// The subtrees of the first @p parallel_depth levels are built concurrently, the left one in a new thread. As every
+/// subtree only touches its own range, the result is identical to the one obtained when @p parallel_depth is zero.
+///
+/// @param begin Is the start of range.
+/// @param end Is the end of range.
+/// @param index Is the dimension being evaluated.
+/// @param points Is the list of points to be sorted.
+/// @param parallel_depth Is the number of levels whose subtrees are built concurrently.
+template <std::size_t Dimension, typename Coordinate>
+void MakeImplicitKdTree(std::size_t begin, std::size_t end, std::size_t index, std::vector<Coordinate>& points,
+                        std::size_t parallel_depth = 0) {
+  static_assert(Dimension > 0, "Dimension must be greater than 0.");
+  // Ranges of zero or one elements are already a valid tree.
+  if (end <= begin + 1) return;
+  const std::size_t node_index = begin + (end - begin) / 2;
+  const auto i = points.begin();
+  std::nth_element(i + begin, i + node_index, i + end,
+                   [index](const Coordinate& lhs, const Coordinate& rhs) { return lhs[index] < rhs[index]; });
+  index = (index + 1) % Dimension;
+  if (parallel_depth == 0) {
+    MakeImplicitKdTree<Dimension>(begin, node_index, index, points);
+    MakeImplicitKdTree<Dimension>(node_index + 1, end, index, points);
+    return;
+  }
+  // The left subtree is built on a new thread while the calling thread builds the right one.
+  common::ParallelFor(2, 2, [&](std::size_t subtree) {
+    if (subtree == 0) {
+      MakeImplicitKdTree<Dimension>(begin, node_index, index, points, parallel_depth - 1);
+    } else {
+      MakeImplicitKdTree<Dimension>(node_index + 1, end, index, points, parallel_depth - 1);
+    }
+  });
+}
+
 /// Computes the regions corresponding to each node in a tree and stores them in the nodes.
 ///
 /// The region corresponding to the left child(`lc`) of a node `v` at even depth can be computed
@@ -179,6 +238,27 @@ void Initialize3dRegions(bool left, Node* node) {
   if (node->get_right() != nullptr) Initialize3dRegions(false, node->get_right());
 }
 
+/// Evaluates how @p region overlaps the box delimited by @p min_corner and @p max_corner, without allocating.
+/// Unlike AxisAlignedBox::Overlaps(), containment is evaluated without @p region's tolerance. That is conservative
+/// for range searches: boxes that are contained only within the tolerance are reported as intersected, so their
+/// points are checked one by one with AxisAlignedBox::Contains().
+/// @tparam Corner The type of the corners. It must provide operator[] for accessing each dimension.
+/// @param region The search region.
+/// @param min_corner Minimum corner of the box.
+/// @param max_corner Maximum corner of the box.
+/// @returns The overlapping type.
+template <typename Corner>
+OverlappingType GetOverlappingType(const AxisAlignedBox& region, const Corner& min_corner, const Corner& max_corner) {
+  const Vector3& region_min = region.min_corner();
+  const Vector3& region_max = region.max_corner();
+  bool contained = true;
+  for (std::size_t i = 0; i < 3; ++i) {
+    if (max_corner[i] < region_min[i] || min_corner[i] > region_max[i]) return OverlappingType::kDisjointed;
+    contained = contained && region_min[i] <= min_corner[i] && max_corner[i] <= region_max[i];
+  }
+  return contained ? OverlappingType::kContained : OverlappingType::kIntersected;
+}
+
 /// Calculates the squared distance between two points.
 /// @tparam Coordinate The type of the coordinates.
 /// @tparam Dimension The dimension of the points.
@@ -221,6 +301,34 @@ struct NodeCmp {
   const std::size_t index_{};
 };
 
+/// Offers @p coordinate to @p heap, a max-heap on the distance holding the best @p k neighbours found so far.
+/// @p heap never grows beyond @p k elements; when full, @p coordinate replaces the farthest neighbour if it is closer.
+/// @returns True when @p heap holds @p k neighbours.
+template <typename Coordinate>
+bool PushBoundedHeap(const Coordinate* coordinate, double distance, std::size_t k,
+                     std::vector<Neighbour<Coordinate>>* heap) {
+  const auto cmp = [](const Neighbour<Coordinate>& lhs, const Neighbour<Coordinate>& rhs) {
+    return lhs.distance < rhs.distance;
+  };
+  if (heap->size() < k) {
+    heap->push_back({coordinate, distance});
+    std::push_heap(heap->begin(), heap->end(), cmp);
+  } else if (distance < heap->front().distance) {
+    std::pop_heap(heap->begin(), heap->end(), cmp);
+    heap->back() = {coordinate, distance};
+    std::push_heap(heap->begin(), heap->end(), cmp);
+  }
+  return heap->size() == k;
+}
+
+/// Sorts @p heap, as filled by PushBoundedHeap(), by increasing distance.
+template <typename Coordinate>
+void SortBoundedHeap(std::vector<Neighbour<Coordinate>>* heap) {
+  std::sort_heap(heap->begin(), heap->end(), [](const Neighbour<Coordinate>& lhs, const Neighbour<Coordinate>& rhs) {
+    return lhs.distance < rhs.distance;
+  });
+}
+
 /// KDTree provides a space-partitioning data structure for organizing points in a k-dimensional space.
 /// The tree is built from a set of points, where each point is a vector of length k.
 /// The tree is built balanced, to guarantee an average of O(log(n)) time for nearest-neighbor queries.
@@ -295,6 +403,61 @@ class KDTreeBase {
     return best->get_coordinate();
   }
 
+  /// Finds the @p k nearest points in the tree to the given point. (k-Nearest Neighbours (kNN))
+  /// @param point a point.
+  /// @param k the number of points to look for.
+  /// @return the min(k, number of points) nearest points sorted by increasing distance.
+  std::vector<const Coordinate*> KNearest(const Coordinate& point, std::size_t k) const {
+    std::vector<Neighbour<Coordinate>> neighbours;
+    KNearest(point, k, &neighbours);
+    std::vector<const Coordinate*> result(neighbours.size());
+    std::transform(neighbours.begin(), neighbours.end(), result.begin(),
+                   [](const Neighbour<Coordinate>& neighbour) { return neighbour.coordinate; });
+    return result;
+  }
+
+  /// Finds the @p k nearest points in the tree to the given point. (k-Nearest Neighbours (kNN))
+  /// @p neighbours is used as a bounded max-heap during the search and it is reused across calls: no allocation
+  /// happens once its capacity reaches @p k.
+  /// @param point a point.
+  /// @param k the number of points to look for.
+  /// @param neighbours the min(k, number of points) nearest points sorted by increasing distance. It must not be
+  /// nullptr.
+  /// @throws maliput::common::assertion_error When @p neighbours is nullptr.
+  void KNearest(const Coordinate& point, std::size_t k, std::vector<Neighbour<Coordinate>>* neighbours) const {
+    MALIPUT_THROW_UNLESS(neighbours != nullptr);
+    neighbours->clear();
+    if (k == 0) return;
+    neighbours->reserve(k);
+    KNearest(root_, point, 0, k, neighbours);
+    SortBoundedHeap(neighbours);
+  }
+
+  /// Finds the points in the tree within @p radius of the given point.
+  /// @param point a point.
+  /// @param radius the search radius. Distance is expected to be a squared distance, so points whose distance to
+  /// @p point is less than or equal to `radius * radius` are found.
+  /// @return the points within the radius, in no particular order.
+  /// @throws maliput::common::assertion_error When @p radius is negative.
+  std::vector<const Coordinate*> RadiusSearch(const Coordinate& point, double radius) const {
+    std::vector<const Coordinate*> result;
+    RadiusSearch(point, radius, [&result](const Coordinate& coordinate, double) { result.push_back(&coordinate); });
+    return result;
+  }
+
+  /// Finds the points in the tree within @p radius of the given point and reports them to @p visitor, without
+  /// allocating.
+  /// @param point a point.
+  /// @param radius the search radius. See RadiusSearch(const Coordinate&, double).
+  /// @param visitor a callable invoked as `visitor(const Coordinate& coordinate, double distance)` for each point
+  /// found, in no particular order, where `distance` is computed by the Distance functor.
+  /// @throws maliput::common::assertion_error When @p radius is negative.
+  template <typename Visitor>
+  void RadiusSearch(const Coordinate& point, double radius, Visitor&& visitor) const {
+    MALIPUT_VALIDATE(radius >= 0, "Radius is negative.");
+    RadiusSearch(root_, point, 0, radius * radius, visitor);
+  }
+
  protected:
   using Node = details::Node<Coordinate, Region>;
 
@@ -332,6 +495,51 @@ class KDTreeBase {
                   nearest_neighbour_distance);
   }
 
+  // Collects in @p neighbours the @p k nearest points of the subtree at @p node to the given @p point.
+  // @param node The node to be evaluated.
+  // @param point The point to be evaluated.
+  // @param index Dimension under evaluation as this method is called recursively.
+  // @param k The number of points to look for.
+  // @param neighbours The bounded max-heap of the nearest points found so far.
+  void KNearest(const Node* node, const Coordinate& point, std::size_t index, std::size_t k,
+                std::vector<Neighbour<Coordinate>>* neighbours) const {
+    if (node == nullptr) return;
+    PushBoundedHeap(&node->get_coordinate(), Distance()(node->get_coordinate(), point), k, neighbours);
+    const double dx = node->get_coordinate()[index] - point[index];
+    index = (index + 1) % Dimension;
+    KNearest(dx > 0 ? node->get_left() : node->get_right(), point, index, k, neighbours);
+    // The other subtree may only hold closer points when the heap isn't full or the splitting plane is closer than
+    // the farthest neighbour.
+    if (neighbours->size() == k && dx * dx >= neighbours->front().distance) return;
+    KNearest(dx > 0 ? node->get_right() : node->get_left(), point, index, k, neighbours);
+  }
+
+  // Reports to @p visitor the points of the subtree at @p node whose distance to @p point is at most
+  // @p squared_radius.
+  // @param node The node to be evaluated.
+  // @param point The point to be evaluated.
+  // @param index Dimension under evaluation as this method is called recursively.
+  // @param squared_radius The squared search radius.
+  // @param visitor The callable to report the points to.
+  template <typename Visitor>
+  void RadiusSearch(const Node* node, const Coordinate& point, std::size_t index, double squared_radius,
+                    Visitor& visitor) const {
+    if (node == nullptr) return;
+    const double distance = Distance()(node->get_coordinate(), point);
+    if (distance <= squared_radius) {
+      visitor(node->get_coordinate(), distance);
+    }
+    const double dx = node->get_coordinate()[index] - point[index];
+    index = (index + 1) % Dimension;
+    // Left subtree coordinates are not greater than the node's one, and right subtree coordinates are not smaller.
+    if (dx > 0 || dx * dx <= squared_radius) {
+      RadiusSearch(node->get_left(), point, index, squared_radius, visitor);
+    }
+    if (dx <= 0 || dx * dx <= squared_radius) {
+      RadiusSearch(node->get_right(), point, index, squared_radius, visitor);
+    }
+  }
+
   // Root node of the tree.
   Node* root_ = nullptr;
   // Nodes in the tree.
@@ -411,14 +619,54 @@ class KDTree3D : public details::KDTreeBase<KDTree3D<Coordinate, Distance, NodeC
   /// For further info on Range Search algorithm see http://www.cs.utah.edu/~lifeifei/cis5930/kdtree.pdf
   std::deque<const Coordinate*> RangeSearch(const AxisAlignedBox& region) const {
     std::deque<const Coordinate*> result;
-    RangeSearch(this->root_, region, result);
+    RangeSearch(region, [&result](const Coordinate& coordinate) { result.push_back(&coordinate); });
     return result;
   }
 
+  /// Range search in the 3D-space that reports the Coordinates located in @p region to @p visitor.
+  /// The tree is traversed iteratively with a fixed-size stack, so no allocation happens.
+  /// @param region The region to be searched Coordinates on.
+  /// @param visitor A callable invoked as `visitor(const Coordinate& coordinate)` for each Coordinate located in
+  /// @p region.
+  template <typename Visitor>
+  void RangeSearch(const AxisAlignedBox& region, Visitor&& visitor) const {
+    // Pending subtrees. Subtrees flagged as contained are reported without evaluating their regions.
+    struct Subtree {
+      const KdTreeBaseNode* node;
+      bool contained;
+    };
+    std::array<Subtree, kMaxTraversalDepth> stack;
+    std::size_t stack_size{0};
+    if (this->root_ != nullptr) stack[stack_size++] = {this->root_, false};
+    while (stack_size > 0) {
+      const Subtree subtree = stack[--stack_size];
+      const KdTreeBaseNode* node = subtree.node;
+      const auto& coordinate = node->get_coordinate();
+      bool contained = subtree.contained;
+      if (!contained) {
+        const AxisAlignedBox& node_region = node->get_region();
+        const auto overlapping_type =
+            details::GetOverlappingType(region, node_region.min_corner(), node_region.max_corner());
+        if (overlapping_type == OverlappingType::kDisjointed) continue;
+        contained = overlapping_type == OverlappingType::kContained;
+      }
+      if (contained || region.Contains({coordinate[0], coordinate[1], coordinate[2]})) {
+        visitor(coordinate);
+      }
+      // The right subtree is pushed first so the left one is visited first.
+      if (node->get_right() != nullptr) stack[stack_size++] = {node->get_right(), contained};
+      if (node->get_left() != nullptr) stack[stack_size++] = {node->get_left(), contained};
+    }
+  }
+
  private:
   using KdTreeBaseNode = typename details::KDTreeBase<KDTree3D<Coordinate, Distance, NodeCmp>, Coordinate, 3,
                                                       AxisAlignedBox, Distance, NodeCmp>::Node;
 
+  // Maximum depth of the RangeSearch() stack. The tree is built by splitting ranges at their median, so its depth is
+  // bounded by the number of bits of std::size_t.
+  static constexpr std::size_t kMaxTraversalDepth{std::numeric_limits<std::size_t>::digits + 1};
+
   /// Initializes the regions of the nodes.
   /// This initialization must be run before calling the RangeSearch method.
   /// See RangeSearch method.
@@ -431,54 +679,450 @@ class KDTree3D : public details::KDTreeBase<KDTree3D<Coordinate, Distance, NodeC
     if (this->root_->get_left() != nullptr) details::Initialize3dRegions(true, this->root_->get_left());
     if (this->root_->get_right() != nullptr) details::Initialize3dRegions(false, this->root_->get_right());
   }
+};
 
-  // Performs a range search query recursively.
-  // @pre InitializeRegions() must be called before using this method.
-  // @param node The node to be searched.
-  // @param region The search region.
-  // @param result The result of the search.
-  void RangeSearch(KdTreeBaseNode* node, const AxisAlignedBox& region, std::deque<const Coordinate*>& result) const {
-    if (node == nullptr) return;
-    // If the node is a leaf, check if its coordinate is in the region.
-    if (node->get_left() == nullptr && node->get_right() == nullptr) {
-      const auto& coordinate = node->get_coordinate();
-      if (region.Contains({coordinate[0], coordinate[1], coordinate[2]})) {
-        result.push_back(&coordinate);
-      }
-      return;
+/// Implicit N-Dimension kd-tree.
+///
+/// It provides the same queries as KDTree but it doesn't allocate nodes: points are stored in a single contiguous
+/// container ordered so that the median of every range [begin, end) is the node at `begin + (end - begin) / 2`,
+/// and its subtrees are the ranges at both sides of it. The first `Dimension` components of the points are also kept
+/// as a structure of arrays, one contiguous array per dimension, which is what the traversals read so that they
+/// don't pull the rest of the points into the cache.
+///
+/// Both layouts are kept because `Coordinate` may carry data other than its components (e.g. the lane a sample
+/// belongs to) and queries return references to the stored points, so they can't be rebuilt from the arrays. The
+/// memory footprint is therefore the one of the points plus `Dimension` doubles per point, which is still well below
+/// the one of KDTree nodes.
+///
+/// Distances are computed as squared Euclidean distances over the first `Dimension` components of the coordinates.
+///
+/// @tparam Coordinate Data type being used, must have:
+/// - operator[] for accessing the value in each dimension.
+/// @tparam Dimension Dimension of the KD-tree.
+template <typename Coordinate, std::size_t Dimension>
+class ImplicitKDTree {
+ public:
+  MALIPUT_NO_COPY_NO_MOVE_NO_ASSIGN(ImplicitKDTree)
+  static_assert(Dimension > 0, "Dimension must be greater than 0.");
+
+  /// Tag type used to construct a tree from points that are already laid out, see points().
+  struct LaidOut {};
+
+  /// Constructs an ImplicitKDTree taking a pair of iterators. Adds each
+  /// point in the range [begin, end) to the tree.
+  ///
+  /// @param begin start of range
+  /// @param end end of range
+  /// @param num_threads Number of threads used to build the tree. The resulting tree does not depend on it.
+  /// @tparam Iterator type of the iterator.
+  /// @throws maliput::common::assertion_error When the range is empty.
+  /// @throws maliput::common::assertion_error When @p num_threads is zero.
+  template <typename Iterator>
+  ImplicitKDTree(Iterator begin, Iterator end, std::size_t num_threads = 1) : points_(begin, end) {
+    Build(num_threads);
+  }
+
+  /// Constructs an ImplicitKDTree taking a collection of points.
+  ///
+  /// @param points Collection of points. They are moved into the tree when @p points is an rvalue.
+  /// @param num_threads Number of threads used to build the tree. The resulting tree does not depend on it.
+  /// @tparam Collection type of the collection.
+  /// @throws maliput::common::assertion_error When the range is empty.
+  /// @throws maliput::common::assertion_error When @p num_threads is zero.
+  template <typename Collection>
+  ImplicitKDTree(Collection&& points, std::size_t num_threads = 1) {
+    if constexpr (std::is_rvalue_reference_v<Collection&&>) {
+      points_.assign(std::make_move_iterator(std::begin(points)), std::make_move_iterator(std::end(points)));
+    } else {
+      points_.assign(std::begin(points), std::end(points));
     }
-    // If the region is fully contained in the node, report the node and its children.
-    const auto overlapping_type = region.Overlaps(node->get_region());
+    Build(num_threads);
+  }
+
+  /// Constructs an ImplicitKDTree from points whose order already describes the tree, as returned by points().
+  /// No sorting is performed, which makes it suitable for restoring a previously built tree.
+  ///
+  /// @param points Points laid out by a previously built tree.
+  /// @throws maliput::common::assertion_error When @p points is empty.
+  ImplicitKDTree(std::vector<Coordinate>&& points, LaidOut) : points_(std::move(points)) {
+    MALIPUT_VALIDATE(!points_.empty(), "Empty range");
+    FillCoordinates();
+  }
 
-    if (overlapping_type == OverlappingType::kContained) {
-      ReportPointsInSubTree(node, result);
-      return;
+  /// Constructs an ImplicitKDTree from points that are already laid out, reading their components from
+  /// @p coordinates instead of copying them. It suits trees restored from memory-mapped files.
+  ///
+  /// @param points Points laid out by a previously built tree.
+  /// @param coordinates One array per dimension holding the components of @p points, in the same order. They are
+  /// not copied, so they must outlive the tree.
+  /// @throws maliput::common::assertion_error When @p points is empty or any of @p coordinates is nullptr.
+  ImplicitKDTree(std::vector<Coordinate>&& points, const std::array<const double*, Dimension>& coordinates, LaidOut)
+      : points_(std::move(points)), coordinates_(coordinates) {
+    MALIPUT_VALIDATE(!points_.empty(), "Empty range");
+    for (const double* dimension_coordinates : coordinates_) {
+      MALIPUT_VALIDATE(dimension_coordinates != nullptr, "Null coordinates");
     }
-    if (overlapping_type == OverlappingType::kIntersected) {
-      const auto& coordinate = node->get_coordinate();
-      if (region.Contains({coordinate[0], coordinate[1], coordinate[2]})) {
-        result.push_back(&coordinate);
-      }
-      RangeSearch(node->get_left(), region, result);
-      RangeSearch(node->get_right(), region, result);
-      return;
+  }
+
+  /// Finds the nearest point in the tree to the given point. (Nearest Neighbour (NN))
+  /// Tolerance being used is std::numeric_limits<double>::min().
+  /// @param point a point.
+  /// @return the nearest point in the tree to the given point
+  const Coordinate& nearest_point(const Coordinate& point) const {
+    return nearest_point(point, std::numeric_limits<double>::min());
+  }
+
+  /// Finds the nearest point in the tree to the given point. (Nearest Neighbour (NN))
+  /// @param point a point.
+  /// @param tolerance the maximum distance to the nearest neighbour to be considered a match.
+  /// @param num_visited_nodes When it is not nullptr, the number of nodes visited by the search is added to it.
+  /// @return the nearest point in the tree to the given point
+  /// @throws maliput::common::assertion_error When tolerance is negative.
+  const Coordinate& nearest_point(const Coordinate& point, double tolerance,
+                                  std::size_t* num_visited_nodes = nullptr) const {
+    MALIPUT_VALIDATE(tolerance > 0, "Tolerance is negative.");
+    std::size_t best = 0;
+    double best_dist = std::numeric_limits<double>::infinity();
+    std::size_t visited_nodes{0};
+    nearest_point(0, points_.size(), 0, ToArray(point), tolerance, &best, &best_dist, &visited_nodes);
+    if (num_visited_nodes != nullptr) {
+      *num_visited_nodes += visited_nodes;
     }
-    if (overlapping_type == OverlappingType::kDisjointed) {
-      return;
+    return points_[best];
+  }
+
+  /// Finds the @p k nearest points in the tree to the given point. (k-Nearest Neighbours (kNN))
+  /// @param point a point.
+  /// @param k the number of points to look for.
+  /// @return the min(k, number of points) nearest points sorted by increasing distance.
+  std::vector<const Coordinate*> KNearest(const Coordinate& point, std::size_t k) const {
+    std::vector<Neighbour<Coordinate>> neighbours;
+    KNearest(point, k, &neighbours);
+    std::vector<const Coordinate*> result(neighbours.size());
+    std::transform(neighbours.begin(), neighbours.end(), result.begin(),
+                   [](const Neighbour<Coordinate>& neighbour) { return neighbour.coordinate; });
+    return result;
+  }
+
+  /// Finds the @p k nearest points in the tree to the given point. (k-Nearest Neighbours (kNN))
+  /// @p neighbours is used as a bounded max-heap during the search and it is reused across calls: no allocation
+  /// happens once its capacity reaches @p k.
+  /// @param point a point.
+  /// @param k the number of points to look for.
+  /// @param neighbours the min(k, number of points) nearest points sorted by increasing squared distance. It must
+  /// not be nullptr.
+  /// @throws maliput::common::assertion_error When @p neighbours is nullptr.
+  void KNearest(const Coordinate& point, std::size_t k, std::vector<Neighbour<Coordinate>>* neighbours) const {
+    MALIPUT_THROW_UNLESS(neighbours != nullptr);
+    neighbours->clear();
+    if (k == 0) return;
+    neighbours->reserve(k);
+    KNearest(0, points_.size(), 0, ToArray(point), k, neighbours);
+    details::SortBoundedHeap(neighbours);
+  }
+
+  /// Finds the points in the tree within @p radius of the given point.
+  /// @param point a point.
+  /// @param radius the search radius.
+  /// @return the points within the radius, in no particular order.
+  /// @throws maliput::common::assertion_error When @p radius is negative.
+  std::vector<const Coordinate*> RadiusSearch(const Coordinate& point, double radius) const {
+    std::vector<const Coordinate*> result;
+    RadiusSearch(point, radius, [&result](const Coordinate& coordinate, double) { result.push_back(&coordinate); });
+    return result;
+  }
+
+  /// Finds the points in the tree within @p radius of the given point and reports them to @p visitor, without
+  /// allocating.
+  /// @param point a point.
+  /// @param radius the search radius.
+  /// @param visitor a callable invoked as `visitor(const Coordinate& coordinate, double squared_distance)` for each
+  /// point found, in no particular order.
+  /// @param num_visited_nodes When it is not nullptr, the number of nodes visited by the search is added to it.
+  /// @throws maliput::common::assertion_error When @p radius is negative.
+  template <typename Visitor>
+  void RadiusSearch(const Coordinate& point, double radius, Visitor&& visitor,
+                    std::size_t* num_visited_nodes = nullptr) const {
+    MALIPUT_VALIDATE(radius >= 0, "Radius is negative.");
+    std::size_t visited_nodes{0};
+    RadiusSearch(0, points_.size(), 0, ToArray(point), radius * radius, visitor, &visited_nodes);
+    if (num_visited_nodes != nullptr) {
+      *num_visited_nodes += visited_nodes;
     }
   }
 
-  // Reports the points in the subtree rooted at @p node.
-  // @param node The node to be searched.
-  // @param result The result of the search.
-  void ReportPointsInSubTree(KdTreeBaseNode* node, std::deque<const Coordinate*>& result) const {
-    // TODO(francocipollone): Each node could have a list of references to points located within the region so we don't
-    //                        have to iterate all the nodes for getting the nodes that are contained.
-    if (node == nullptr) return;
-    result.push_back(&(node->get_coordinate()));
-    ReportPointsInSubTree(node->get_left(), result);
-    ReportPointsInSubTree(node->get_right(), result);
+  /// @returns The number of points in the tree.
+  std::size_t size() const { return points_.size(); }
+
+  /// @returns The points in the order that describes the tree. They can be used to restore the tree with the
+  /// LaidOut constructor.
+  const std::vector<Coordinate>& points() const { return points_; }
+
+ protected:
+  // Copies the first Dimension components of @p point.
+  static std::array<double, Dimension> ToArray(const Coordinate& point) {
+    std::array<double, Dimension> result;
+    for (std::size_t i = 0; i < Dimension; ++i) {
+      result[i] = point[i];
+    }
+    return result;
+  }
+
+  // Obtains the squared distance between the point at @p node_index and @p point.
+  double SquaredDistance(std::size_t node_index, const std::array<double, Dimension>& point) const {
+    double dist = 0;
+    for (std::size_t i = 0; i < Dimension; ++i) {
+      const double d = coordinates_[i][node_index] - point[i];
+      dist += d * d;
+    }
+    return dist;
   }
+
+  // Obtains the nearest point in the subtree [begin, end) to the given @p point.
+  // @param begin The start of the subtree range.
+  // @param end The end of the subtree range.
+  // @param index Dimension under evaluation as this method is called recursively.
+  // @param point The point to be evaluated.
+  // @param tolerance The distance under which the search stops.
+  // @param nearest_neighbour_index The index of the nearest neighbour so far.
+  // @param nearest_neighbour_distance The closest distance to the nearest neighbour so far.
+  // @param num_visited_nodes Incremented for every visited node.
+  void nearest_point(std::size_t begin, std::size_t end, std::size_t index, const std::array<double, Dimension>& point,
+                     double tolerance, std::size_t* nearest_neighbour_index, double* nearest_neighbour_distance,
+                     std::size_t* num_visited_nodes) const {
+    if (end <= begin) return;
+    ++*num_visited_nodes;
+    const std::size_t node_index = begin + (end - begin) / 2;
+    const double node_point_distance = SquaredDistance(node_index, point);
+    if (node_point_distance < *nearest_neighbour_distance) {
+      *nearest_neighbour_distance = node_point_distance;
+      *nearest_neighbour_index = node_index;
+    }
+    if (*nearest_neighbour_distance < tolerance) return;
+    const double dx = coordinates_[index][node_index] - point[index];
+    const std::size_t next_index = (index + 1) % Dimension;
+    if (dx > 0) {
+      nearest_point(begin, node_index, next_index, point, tolerance, nearest_neighbour_index,
+                    nearest_neighbour_distance, num_visited_nodes);
+    } else {
+      nearest_point(node_index + 1, end, next_index, point, tolerance, nearest_neighbour_index,
+                    nearest_neighbour_distance, num_visited_nodes);
+    }
+    // When going up in the tree, evaluate if the other's node's quadrant is any closer than the current best.
+    if (dx * dx >= *nearest_neighbour_distance) return;
+    if (dx > 0) {
+      nearest_point(node_index + 1, end, next_index, point, tolerance, nearest_neighbour_index,
+                    nearest_neighbour_distance, num_visited_nodes);
+    } else {
+      nearest_point(begin, node_index, next_index, point, tolerance, nearest_neighbour_index,
+                    nearest_neighbour_distance, num_visited_nodes);
+    }
+  }
+
+  // Collects in @p neighbours the @p k nearest points of the subtree [begin, end) to the given @p point.
+  // @param begin The start of the subtree range.
+  // @param end The end of the subtree range.
+  // @param index Dimension under evaluation as this method is called recursively.
+  // @param point The point to be evaluated.
+  // @param k The number of points to look for.
+  // @param neighbours The bounded max-heap of the nearest points found so far.
+  void KNearest(std::size_t begin, std::size_t end, std::size_t index, const std::array<double, Dimension>& point,
+                std::size_t k, std::vector<Neighbour<Coordinate>>* neighbours) const {
+    if (end <= begin) return;
+    const std::size_t node_index = begin + (end - begin) / 2;
+    details::PushBoundedHeap(&points_[node_index], SquaredDistance(node_index, point), k, neighbours);
+    const double dx = coordinates_[index][node_index] - point[index];
+    const std::size_t next_index = (index + 1) % Dimension;
+    if (dx > 0) {
+      KNearest(begin, node_index, next_index, point, k, neighbours);
+    } else {
+      KNearest(node_index + 1, end, next_index, point, k, neighbours);
+    }
+    if (neighbours->size() == k && dx * dx >= neighbours->front().distance) return;
+    if (dx > 0) {
+      KNearest(node_index + 1, end, next_index, point, k, neighbours);
+    } else {
+      KNearest(begin, node_index, next_index, point, k, neighbours);
+    }
+  }
+
+  // Reports to @p visitor the points of the subtree [begin, end) whose squared distance to @p point is at most
+  // @p squared_radius.
+  // @param begin The start of the subtree range.
+  // @param end The end of the subtree range.
+  // @param index Dimension under evaluation as this method is called recursively.
+  // @param point The point to be evaluated.
+  // @param squared_radius The squared search radius.
+  // @param visitor The callable to report the points to.
+  // @param num_visited_nodes Incremented for every visited node.
+  template <typename Visitor>
+  void RadiusSearch(std::size_t begin, std::size_t end, std::size_t index, const std::array<double, Dimension>& point,
+                    double squared_radius, Visitor& visitor, std::size_t* num_visited_nodes) const {
+    if (end <= begin) return;
+    ++*num_visited_nodes;
+    const std::size_t node_index = begin + (end - begin) / 2;
+    const double distance = SquaredDistance(node_index, point);
+    if (distance <= squared_radius) {
+      visitor(points_[node_index], distance);
+    }
+    const double dx = coordinates_[index][node_index] - point[index];
+    const std::size_t next_index = (index + 1) % Dimension;
+    if (dx > 0 || dx * dx <= squared_radius) {
+      RadiusSearch(begin, node_index, next_index, point, squared_radius, visitor, num_visited_nodes);
+    }
+    if (dx <= 0 || dx * dx <= squared_radius) {
+      RadiusSearch(node_index + 1, end, next_index, point, squared_radius, visitor, num_visited_nodes);
+    }
+  }
+
+  // Points of the tree, laid out as an implicit kd-tree. See details::MakeImplicitKdTree().
+  std::vector<Coordinate> points_;
+  // Coordinates of points_, one contiguous array per dimension. They duplicate the components of points_ to keep
+  // the traversals on contiguous memory, while points_ holds the data returned by the queries. They point either to
+  // owned_coordinates_ or to the arrays given at construction.
+  std::array<const double*, Dimension> coordinates_{};
+
+ private:
+  // Sorts the points using up to @p num_threads threads and fills in the coordinates.
+  void Build(std::size_t num_threads) {
+    MALIPUT_VALIDATE(!points_.empty(), "Empty range");
+    MALIPUT_VALIDATE(num_threads > 0, "Number of threads must be greater than 0.");
+    // Each parallel level doubles the number of concurrent subtree builds.
+    std::size_t parallel_depth = 0;
+    while ((std::size_t{1} << parallel_depth) < num_threads) {
+      ++parallel_depth;
+    }
+    details::MakeImplicitKdTree<Dimension>(0, points_.size(), 0, points_, parallel_depth);
+    FillCoordinates();
+  }
+
+  // Copies the coordinates of points_ into owned_coordinates_ and points coordinates_ to them.
+  void FillCoordinates() {
+    for (std::size_t i = 0; i < Dimension; ++i) {
+      owned_coordinates_[i].resize(points_.size());
+      for (std::size_t j = 0; j < points_.size(); ++j) {
+        owned_coordinates_[i][j] = points_[j][i];
+      }
+      coordinates_[i] = owned_coordinates_[i].data();
+    }
+  }
+
+  // Storage of coordinates_ unless they were given at construction.
+  std::array<std::vector<double>, Dimension> owned_coordinates_;
+};
+
+/// Implicit 3-Dimensional kd-tree.
+/// In addition to ImplicitKDTree queries it provides a RangeSearch method for range queries in the 3D-space.
+/// Unlike KDTree3D, the regions of the nodes are not stored but computed during the traversal.
+/// @code {.cpp}
+///  ImplicitKDTree3D<Vector3> tree{points};
+///  tree.RangeSearch(region_1);
+///  tree.nearest_point(point_1); // NearestNeighbour (NN).
+/// @endcode
+///
+/// @tparam Coordinate Data type being used, must have:
+/// - operator[] for accessing the value in each dimension.
+template <typename Coordinate>
+class ImplicitKDTree3D : public ImplicitKDTree<Coordinate, 3> {
+ public:
+  template <typename Iterator>
+  ImplicitKDTree3D(Iterator begin, Iterator end, std::size_t num_threads = 1)
+      : ImplicitKDTree<Coordinate, 3>(begin, end, num_threads) {}
+
+  /// Constructs an ImplicitKDTree3D taking a collection of points.
+  ///
+  /// @param points Collection of points.
+  /// @param num_threads Number of threads used to build the tree. The resulting tree does not depend on it.
+  /// @tparam Collection type of the collection.
+  /// @throws maliput::common::assertion_error When the range is empty.
+  /// @throws maliput::common::assertion_error When @p num_threads is zero.
+  template <typename Collection>
+  ImplicitKDTree3D(Collection&& points, std::size_t num_threads = 1)
+      : ImplicitKDTree<Coordinate, 3>(std::forward<Collection>(points), num_threads) {}
+
+  /// Constructs an ImplicitKDTree3D from points that are already laid out.
+  /// See ImplicitKDTree::ImplicitKDTree(std::vector<Coordinate>&&, LaidOut).
+  ImplicitKDTree3D(std::vector<Coordinate>&& points, typename ImplicitKDTree<Coordinate, 3>::LaidOut laid_out)
+      : ImplicitKDTree<Coordinate, 3>(std::move(points), laid_out) {}
+
+  /// Constructs an ImplicitKDTree3D from points that are already laid out and the arrays of their components.
+  /// See ImplicitKDTree::ImplicitKDTree(std::vector<Coordinate>&&, const std::array<const double*, Dimension>&,
+  /// LaidOut).
+  ImplicitKDTree3D(std::vector<Coordinate>&& points, const std::array<const double*, 3>& coordinates,
+                   typename ImplicitKDTree<Coordinate, 3>::LaidOut laid_out)
+      : ImplicitKDTree<Coordinate, 3>(std::move(points), coordinates, laid_out) {}
+
+  /// Range search in the 3D-space.
+  /// @param region The region to be searched Coordinates on.
+  /// @returns The Coordinates located in the @p region.
+  std::deque<const Coordinate*> RangeSearch(const AxisAlignedBox& region) const {
+    std::deque<const Coordinate*> result;
+    RangeSearch(region, [&result](const Coordinate& coordinate) { result.push_back(&coordinate); });
+    return result;
+  }
+
+  /// Range search in the 3D-space that reports the Coordinates located in @p region to @p visitor.
+  /// The tree is traversed iteratively with a fixed-size stack, so no allocation happens.
+  /// @param region The region to be searched Coordinates on.
+  /// @param visitor A callable invoked as `visitor(const Coordinate& coordinate)` for each Coordinate located in
+  /// @p region.
+  /// @param num_visited_nodes When it is not nullptr, the number of nodes visited by the search is added to it. The
+  /// nodes of subtrees entirely contained in @p region count as visited.
+  template <typename Visitor>
+  void RangeSearch(const AxisAlignedBox& region, Visitor&& visitor, std::size_t* num_visited_nodes = nullptr) const {
+    // Pending subtrees, with the region they cover.
+    struct Subtree {
+      std::size_t begin;
+      std::size_t end;
+      std::size_t index;
+      std::array<double, 3> min_corner;
+      std::array<double, 3> max_corner;
+    };
+    const double infinity = std::numeric_limits<double>::infinity();
+    std::array<Subtree, kMaxTraversalDepth> stack;
+    std::size_t stack_size{0};
+    std::size_t visited_nodes{0};
+    stack[stack_size++] = {
+        0, this->points_.size(), 0, {-infinity, -infinity, -infinity}, {infinity, infinity, infinity}};
+    while (stack_size > 0) {
+      const Subtree subtree = stack[--stack_size];
+      if (subtree.end <= subtree.begin) continue;
+      const auto overlapping_type = details::GetOverlappingType(region, subtree.min_corner, subtree.max_corner);
+      if (overlapping_type == OverlappingType::kDisjointed) continue;
+      // The whole subtree is contiguous in memory, so it can be reported without further traversal.
+      if (overlapping_type == OverlappingType::kContained) {
+        for (std::size_t i = subtree.begin; i < subtree.end; ++i) {
+          visitor(this->points_[i]);
+        }
+        visited_nodes += subtree.end - subtree.begin;
+        continue;
+      }
+      ++visited_nodes;
+      const std::size_t node_index = subtree.begin + (subtree.end - subtree.begin) / 2;
+      const double split = this->coordinates_[subtree.index][node_index];
+      const Vector3 node{this->coordinates_[0][node_index], this->coordinates_[1][node_index],
+                         this->coordinates_[2][node_index]};
+      if (region.Contains(node)) {
+        visitor(this->points_[node_index]);
+      }
+      const std::size_t next_index = (subtree.index + 1) % 3;
+      // The right subtree is pushed first so the left one is visited first.
+      Subtree right{node_index + 1, subtree.end, next_index, subtree.min_corner, subtree.max_corner};
+      right.min_corner[subtree.index] = split;
+      stack[stack_size++] = right;
+      Subtree left{subtree.begin, node_index, next_index, subtree.min_corner, subtree.max_corner};
+      left.max_corner[subtree.index] = split;
+      stack[stack_size++] = left;
+    }
+    if (num_visited_nodes != nullptr) {
+      *num_visited_nodes += visited_nodes;
+    }
+  }
+
+ private:
+  // Maximum depth of the RangeSearch() stack. The points are laid out by splitting ranges at their median, so the
+  // depth of the tree is bounded by the number of bits of std::size_t.
+  static constexpr std::size_t kMaxTraversalDepth{std::numeric_limits<std::size_t>::digits + 1};
 };
 
 }  // namespace math
@@ -0,0 +1,140 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2023, Woven by Toyota. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <memory>
+
+#include "maliput/api/road_network.h"
+#include "maliput/geometry_base/road_geometry.h"
+
+namespace maliput {
+namespace api {
+namespace test {
+
+/// @file
+/// Procedural generator of large road networks, useful for scaling tests and
+/// benchmarks.
+///
+/// Unlike the fixtures in mock.h and mock_geometry.h, the generated
+/// RoadGeometry has real lane geometry (straight lines and circular arcs, with
+/// a constant grade), so lookups, routing and rule queries can be exercised at
+/// scale. Every lane end is attached to a BranchPoint.
+///
+/// Two layouts are available:
+///
+/// - ProceduralRoadNetworkConfig::Layout::kGridCity: a flat grid of
+///   `num_rows` x `num_columns` signalized four way intersections,
+///   `block_length` apart. Roads between adjacent intersections hold two
+///   one-way Segments, one per direction, of `lanes_per_direction` Lanes each.
+///   Every intersection is a Junction with straight connecting Lanes for each
+///   approach lane, a right turn from the rightmost lane and a left turn from
+///   the leftmost lane.
+/// - ProceduralRoadNetworkConfig::Layout::kHighway: a dual carriageway of
+///   `num_segments` Junctions, `segment_length` long each, whose reference
+///   line alternates between left and right turns of `curvature` and climbs
+///   with `grade`. Every `interchange_spacing` Junctions, an exit ramp diverges
+///   from and an entrance ramp merges into the rightmost lane of the forward
+///   carriageway.
+///
+/// Lane index 0 is always the rightmost lane of a Segment. Lanes are named
+/// after their Segment, suffixed with `_<index>`.
+
+/// Holds the parameters of a procedurally generated road network.
+/// @see CreateProceduralRoadGeometry() and CreateProceduralRoadNetwork().
+struct ProceduralRoadNetworkConfig {
+  /// Road network layouts.
+  enum class Layout { kGridCity, kHighway };
+
+  Layout layout{Layout::kGridCity};
+
+  /// Number of lanes of each one-way Segment. It must be positive.
+  int lanes_per_direction{2};
+  /// Width of every lane. It must be positive.
+  double lane_width{3.5};
+
+  /// kGridCity: number of intersection rows. `num_rows * num_columns` must be at least 2.
+  int num_rows{2};
+  /// kGridCity: number of intersection columns. `num_rows * num_columns` must be at least 2.
+  int num_columns{2};
+  /// kGridCity: distance between the centers of adjacent intersections. It must leave room for the
+  /// intersections, whose side is `2 * (lanes_per_direction + 1) * lane_width`.
+  double block_length{100.};
+
+  /// kHighway: number of Junctions along the highway. It must be positive.
+  int num_segments{8};
+  /// kHighway: length of the reference line of each Junction. It must be positive.
+  double segment_length{200.};
+  /// kHighway: absolute curvature of the reference line. It must keep every lane's radius positive.
+  double curvature{0.};
+  /// kHighway: rate of change of elevation along the reference line.
+  double grade{0.};
+  /// kHighway: number of Junctions between interchanges. Zero disables interchanges.
+  int interchange_spacing{4};
+  /// kHighway: radius of the ramps. They turn a quarter of a circle. It must be positive.
+  double ramp_radius{60.};
+
+  /// Number of consecutive speed limit rules every lane is split into. It must be positive.
+  int speed_limit_zones_per_lane{1};
+  /// Maximum speed of the speed limit rules.
+  double speed_limit{13.9};
+  /// kGridCity: duration of each phase of the intersections' phase rings.
+  double phase_duration{30.};
+
+  /// Linear tolerance of the RoadGeometry, in meters. It bounds the position mismatch allowed at the lane ends that
+  /// meet at a BranchPoint, and is the tolerance of the RoadGeometry's lookups. It must be positive.
+  double linear_tolerance{1e-3};
+  /// Angular tolerance of the RoadGeometry. On graded and curved highways, lanes of different radii climb at
+  /// slightly different pitches, so it must account for that change at the Junction boundaries.
+  double angular_tolerance{1e-2};
+};
+
+/// Builds the RoadGeometry described by @p config. Its lookup strategy is the default one.
+/// @throws maliput::common::assertion_error When @p config is not valid.
+std::unique_ptr<geometry_base::RoadGeometry> CreateProceduralRoadGeometry(const ProceduralRoadNetworkConfig& config);
+
+/// Builds the RoadNetwork described by @p config.
+///
+/// Besides the RoadGeometry from CreateProceduralRoadGeometry(), the RoadNetwork holds:
+/// - A ManualRulebook with, for every lane, `speed_limit_zones_per_lane` speed limit RangeValueRules and one
+///   "WithS" direction usage DiscreteValueRule; and for every connecting lane within an intersection, a
+///   right-of-way DiscreteValueRule that is related to the traffic light of its approach.
+/// - A TrafficLightBook with one TrafficLight per intersection approach, each one with a single BulbGroup of red,
+///   yellow and green bulbs.
+/// - A ManualPhaseRingBook with one PhaseRing per intersection, alternating between a phase where north-south
+///   approaches go and a phase where east-west approaches go.
+/// - An IntersectionBook with one Intersection per grid intersection.
+/// - A RuleRegistry with the right-of-way, direction usage and speed limit rule types.
+///
+/// Highways have neither intersections nor traffic lights.
+/// @throws maliput::common::assertion_error When @p config is not valid.
+std::unique_ptr<RoadNetwork> CreateProceduralRoadNetwork(const ProceduralRoadNetworkConfig& config);
+
+}  // namespace test
+}  // namespace api
+}  // namespace maliput
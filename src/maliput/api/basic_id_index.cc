@@ -29,25 +29,45 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "maliput/api/basic_id_index.h"
 
+#include <limits>
+
 #include "maliput/common/maliput_throw.h"
 
 namespace maliput {
 namespace api {
 
-void BasicIdIndex::AddLane(const Lane* lane) { MALIPUT_THROW_UNLESS(lane_map_.emplace(lane->id(), lane).second); }
+template <typename T>
+void BasicIdIndex::DenseIndex<T>::Add(const T* element) {
+  MALIPUT_THROW_UNLESS(elements.size() < std::numeric_limits<uint32_t>::max());
+  MALIPUT_THROW_UNLESS(indices.emplace(element->id(), static_cast<uint32_t>(elements.size())).second);
+  elements.push_back(element);
+}
 
-void BasicIdIndex::AddSegment(const Segment* segment) {
-  MALIPUT_THROW_UNLESS(segment_map_.emplace(segment->id(), segment).second);
+template <typename T>
+std::optional<uint32_t> BasicIdIndex::DenseIndex<T>::GetIndex(const TypeSpecificIdentifier<T>& id) const {
+  const auto it = indices.find(id);
+  return it == indices.end() ? std::nullopt : std::make_optional(it->second);
 }
 
-void BasicIdIndex::AddJunction(const Junction* junction) {
-  MALIPUT_THROW_UNLESS(junction_map_.emplace(junction->id(), junction).second);
+template <typename T>
+const T* BasicIdIndex::DenseIndex<T>::Get(const TypeSpecificIdentifier<T>& id) const {
+  const auto it = indices.find(id);
+  return it == indices.end() ? nullptr : elements[it->second];
 }
 
-void BasicIdIndex::AddBranchPoint(const BranchPoint* branch_point) {
-  MALIPUT_THROW_UNLESS(branch_point_map_.emplace(branch_point->id(), branch_point).second);
+template <typename T>
+const T* BasicIdIndex::DenseIndex<T>::GetByIndex(uint32_t index) const {
+  return index < elements.size() ? elements[index] : nullptr;
 }
 
+void BasicIdIndex::AddLane(const Lane* lane) { lanes_.Add(lane); }
+
+void BasicIdIndex::AddSegment(const Segment* segment) { segments_.Add(segment); }
+
+void BasicIdIndex::AddJunction(const Junction* junction) { junctions_.Add(junction); }
+
+void BasicIdIndex::AddBranchPoint(const BranchPoint* branch_point) { branch_points_.Add(branch_point); }
+
 void BasicIdIndex::WalkAndAddAll(const RoadGeometry* road_geometry) {
   for (int ji = 0; ji < road_geometry->num_junctions(); ++ji) {
     const Junction* junction = road_geometry->junction(ji);
@@ -65,24 +85,53 @@ void BasicIdIndex::WalkAndAddAll(const RoadGeometry* road_geometry) {
   }
 }
 
-namespace {
-template <typename T, typename U>
-T find_or_nullptr(const std::unordered_map<U, T>& map, const U& id) {
-  auto it = map.find(id);
-  return (it == map.end()) ? nullptr : it->second;
+const Lane* BasicIdIndex::DoGetLane(const LaneId& id) const { return lanes_.Get(id); }
+
+const std::unordered_map<LaneId, const Lane*>& BasicIdIndex::DoGetLanes() const {
+  std::lock_guard<std::mutex> lock(lane_map_mutex_);
+  // Lanes are only appended to `lanes_.elements`, so the map holds a prefix of them.
+  for (std::size_t i = lane_map_.size(); i < lanes_.elements.size(); ++i) {
+    lane_map_.emplace(lanes_.elements[i]->id(), lanes_.elements[i]);
+  }
+  return lane_map_;
 }
-}  // namespace
 
-const Lane* BasicIdIndex::DoGetLane(const LaneId& id) const { return find_or_nullptr(lane_map_, id); }
+const Segment* BasicIdIndex::DoGetSegment(const SegmentId& id) const { return segments_.Get(id); }
+
+const Junction* BasicIdIndex::DoGetJunction(const JunctionId& id) const { return junctions_.Get(id); }
+
+const BranchPoint* BasicIdIndex::DoGetBranchPoint(const BranchPointId& id) const { return branch_points_.Get(id); }
+
+std::optional<uint32_t> BasicIdIndex::DoGetLaneIndex(const LaneId& id) const { return lanes_.GetIndex(id); }
 
-const std::unordered_map<LaneId, const Lane*>& BasicIdIndex::DoGetLanes() const { return lane_map_; }
+const Lane* BasicIdIndex::DoGetLaneByIndex(uint32_t index) const { return lanes_.GetByIndex(index); }
 
-const Segment* BasicIdIndex::DoGetSegment(const SegmentId& id) const { return find_or_nullptr(segment_map_, id); }
+uint32_t BasicIdIndex::do_num_lane_indices() const { return static_cast<uint32_t>(lanes_.elements.size()); }
 
-const Junction* BasicIdIndex::DoGetJunction(const JunctionId& id) const { return find_or_nullptr(junction_map_, id); }
+std::optional<uint32_t> BasicIdIndex::DoGetSegmentIndex(const SegmentId& id) const { return segments_.GetIndex(id); }
+
+const Segment* BasicIdIndex::DoGetSegmentByIndex(uint32_t index) const { return segments_.GetByIndex(index); }
+
+uint32_t BasicIdIndex::do_num_segment_indices() const { return static_cast<uint32_t>(segments_.elements.size()); }
+
+std::optional<uint32_t> BasicIdIndex::DoGetJunctionIndex(const JunctionId& id) const {
+  return junctions_.GetIndex(id);
+}
+
+const Junction* BasicIdIndex::DoGetJunctionByIndex(uint32_t index) const { return junctions_.GetByIndex(index); }
+
+uint32_t BasicIdIndex::do_num_junction_indices() const { return static_cast<uint32_t>(junctions_.elements.size()); }
+
+std::optional<uint32_t> BasicIdIndex::DoGetBranchPointIndex(const BranchPointId& id) const {
+  return branch_points_.GetIndex(id);
+}
+
+const BranchPoint* BasicIdIndex::DoGetBranchPointByIndex(uint32_t index) const {
+  return branch_points_.GetByIndex(index);
+}
 
-const BranchPoint* BasicIdIndex::DoGetBranchPoint(const BranchPointId& id) const {
-  return find_or_nullptr(branch_point_map_, id);
+uint32_t BasicIdIndex::do_num_branch_point_indices() const {
+  return static_cast<uint32_t>(branch_points_.elements.size());
 }
 
 }  // namespace api
@@ -110,6 +110,21 @@ Rotation Lane::GetOrientation(const LanePosition& lane_pos) const {
   return DoGetOrientation(lane_pos);
 }
 
+std::vector<InertialPosition> Lane::ToInertialPositions(const std::vector<LanePosition>& lane_positions) const {
+  MALIPUT_PROFILE_FUNC();
+  return DoToInertialPositions(lane_positions);
+}
+
+std::vector<Rotation> Lane::GetOrientations(const std::vector<LanePosition>& lane_positions) const {
+  MALIPUT_PROFILE_FUNC();
+  return DoGetOrientations(lane_positions);
+}
+
+std::vector<LanePositionResult> Lane::ToLanePositions(const std::vector<InertialPosition>& inertial_positions) const {
+  MALIPUT_PROFILE_FUNC();
+  return DoToLanePositions(inertial_positions);
+}
+
 LanePosition Lane::EvalMotionDerivatives(const LanePosition& position, const IsoLaneVelocity& velocity) const {
   MALIPUT_PROFILE_FUNC();
   return DoEvalMotionDerivatives(position, velocity);
@@ -151,5 +166,32 @@ bool Lane::Contains(const LanePosition& lane_position) const {
          IsWithinRange(h, elevation_bounds.min(), elevation_bounds.max(), linear_tolerance);
 }
 
+std::vector<InertialPosition> Lane::DoToInertialPositions(const std::vector<LanePosition>& lane_positions) const {
+  std::vector<InertialPosition> inertial_positions;
+  inertial_positions.reserve(lane_positions.size());
+  for (const LanePosition& lane_position : lane_positions) {
+    inertial_positions.push_back(DoToInertialPosition(lane_position));
+  }
+  return inertial_positions;
+}
+
+std::vector<Rotation> Lane::DoGetOrientations(const std::vector<LanePosition>& lane_positions) const {
+  std::vector<Rotation> orientations;
+  orientations.reserve(lane_positions.size());
+  for (const LanePosition& lane_position : lane_positions) {
+    orientations.push_back(DoGetOrientation(lane_position));
+  }
+  return orientations;
+}
+
+std::vector<LanePositionResult> Lane::DoToLanePositions(const std::vector<InertialPosition>& inertial_positions) const {
+  std::vector<LanePositionResult> results;
+  results.reserve(inertial_positions.size());
+  for (const InertialPosition& inertial_position : inertial_positions) {
+    results.push_back(DoToLanePosition(inertial_position));
+  }
+  return results;
+}
+
 }  // namespace api
 }  // namespace maliput
@@ -29,10 +29,13 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "maliput/api/road_geometry.h"
 
+#include <algorithm>
 #include <cmath>
 #include <iostream>
+#include <iterator>
 #include <sstream>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "maliput/api/branch_point.h"
@@ -42,6 +45,7 @@
 #include "maliput/api/regions.h"
 #include "maliput/api/segment.h"
 #include "maliput/common/maliput_abort.h"
+#include "maliput/common/parallel_for.h"
 #include "maliput/common/profiler.h"
 
 namespace maliput {
@@ -68,6 +72,129 @@ Rotation OrientationOutFromLane(const LaneEnd& lane_end) {
   MALIPUT_ABORT_MESSAGE("lane_end is neither LaneEnd::kStart nor LaneEnd::kFinish");
 }
 
+// Describes @p lane_end as "<lane id>[start]" or "<lane id>[end]".
+std::string LaneEndName(const LaneEnd& lane_end) {
+  return lane_end.lane->id().string() + ((lane_end.end == LaneEnd::kStart) ? "[start]" : "[end]");
+}
+
+// Reports a violation when @p bp is not owned by @p rg.
+void CheckBranchPointOwnership(const RoadGeometry* rg, const BranchPoint* bp,
+                               std::vector<InvariantViolation>* violations) {
+  if (bp->road_geometry() == rg) return;
+  std::stringstream ss;
+  ss << "BranchPoint " << bp->id().string() << " is owned by " << rg->id().string() << " (" << rg
+     << ") but claims to be owned by " << bp->road_geometry()->id().string() << " (" << bp->road_geometry() << ").";
+  violations->push_back({InvariantViolation::Type::kBranchPointOwnership, bp->id().string(), rg->id().string(),
+                         std::nullopt, std::nullopt, 0., std::nullopt, ss.str()});
+}
+
+// Reports the violations of the back-pointers and indices of @p jnx, its Segments and their Lanes.
+void CheckJunctionHierarchy(const RoadGeometry* rg, const Junction* jnx, std::vector<InvariantViolation>* violations) {
+  if (jnx->road_geometry() != rg) {
+    std::stringstream ss;
+    ss << "Junction " << jnx->id().string() << " is owned by " << rg->id().string() << " (" << rg
+       << ") but claims to be owned by " << jnx->road_geometry()->id().string() << " (" << jnx->road_geometry()
+       << ").";
+    violations->push_back({InvariantViolation::Type::kJunctionOwnership, jnx->id().string(), rg->id().string(),
+                           std::nullopt, std::nullopt, 0., std::nullopt, ss.str()});
+  }
+  for (int si = 0; si < jnx->num_segments(); ++si) {
+    const Segment* seg = jnx->segment(si);
+    if (seg->junction() != jnx) {
+      std::stringstream ss;
+      ss << "Segment " << seg->id().string() << " is owned by " << jnx->id().string() << " (" << jnx
+         << ") but claims to be owned by " << seg->junction()->id().string() << " (" << seg->junction() << ").";
+      violations->push_back({InvariantViolation::Type::kSegmentOwnership, seg->id().string(), jnx->id().string(),
+                             std::nullopt, std::nullopt, 0., std::nullopt, ss.str()});
+    }
+    for (int li = 0; li < seg->num_lanes(); ++li) {
+      const Lane* lane = seg->lane(li);
+      if (lane->segment() != seg) {
+        std::stringstream ss;
+        ss << "Lane " << lane->id().string() << " is owned by " << seg->id().string() << " (" << seg
+           << ") but claims to be owned by " << lane->segment()->id().string() << " (" << lane->segment() << ").";
+        violations->push_back({InvariantViolation::Type::kLaneOwnership, lane->id().string(), seg->id().string(),
+                               std::nullopt, std::nullopt, 0., std::nullopt, ss.str()});
+      }
+      // Currently, only Lane has an index() accessor, because its the only
+      // component for which the index is meaningful (e.g., adjacency of
+      // lanes).
+      if (lane->index() != li) {
+        std::stringstream ss;
+        ss << "Lane " << lane->id().string() << " has index " << li << " but claims to have index " << lane->index()
+           << ".";
+        violations->push_back({InvariantViolation::Type::kLaneIndex, lane->id().string(), "", std::nullopt,
+                               std::nullopt, 0., lane->index(), ss.str()});
+      }
+    }
+  }
+}
+
+// Verifies C1 continuity at @p bp (within declared tolerances):
+//  - all branches should map to same `Inertial`-frame (x,y,z);
+//  - orientation *into* BranchPoint should be the same for all A-side
+//     branches;
+//  - orientation *into* BranchPoint should be the same for all B-side
+//     branches;
+//  - orientation *into* BranchPoint for A-side should be same as
+//     orientation *out of* BranchPoint for B-side.
+void CheckBranchPointContinuity(const BranchPoint* bp, double linear_tolerance, double angular_tolerance,
+                                std::vector<InvariantViolation>* violations) {
+  const LaneEndSet& a_side = *(bp->GetASide());
+  const LaneEndSet& b_side = *(bp->GetBSide());
+  if ((a_side.size() == 0) && (b_side.size() == 0)) {
+    std::stringstream ss;
+    ss << "BranchPoint " << bp->id().string() << " is empty.";
+    violations->push_back({InvariantViolation::Type::kEmptyBranchPoint, bp->id().string(), bp->id().string(),
+                           std::nullopt, std::nullopt, 0., std::nullopt, ss.str()});
+    return;
+  }
+
+  // The pose of every LaneEnd is evaluated once: A-side ends first, then B-side ends.
+  struct LaneEndPose {
+    LaneEnd lane_end;
+    InertialPosition position;
+    Rotation orientation;
+  };
+  std::vector<LaneEndPose> poses;
+  poses.reserve(a_side.size() + b_side.size());
+  for (const LaneEndSet* ends : {&a_side, &b_side}) {
+    for (int bi = 0; bi < ends->size(); ++bi) {
+      const LaneEnd le = ends->get(bi);
+      poses.push_back({le, LaneEndInertialPosition(le), OrientationOutFromLane(le)});
+    }
+  }
+  const auto a_side_poses_end = poses.begin() + a_side.size();
+  const LaneEndPose& reference = poses.front();
+
+  // ...test `Inertial`-frame position similarity.
+  for (const LaneEndPose& pose : poses) {
+    const double d = reference.position.Distance(pose.position);
+    if (d > linear_tolerance) {
+      std::stringstream ss;
+      ss << "Lane " << LaneEndName(pose.lane_end) << " position is off by " << d << " from Lane "
+         << LaneEndName(reference.lane_end);
+      violations->push_back({InvariantViolation::Type::kLaneEndPosition, pose.lane_end.lane->id().string(),
+                             reference.lane_end.lane->id().string(), pose.lane_end.end, reference.lane_end.end, d,
+                             std::nullopt, ss.str()});
+    }
+  }
+  // ...test orientation similarity.
+  const Rotation ref_rot = (a_side.size() > 0) ? reference.orientation : reference.orientation.Reverse();
+  const Rotation ref_rot_reversed = ref_rot.Reverse();
+  for (auto it = poses.begin(); it != poses.end(); ++it) {
+    const double d = (it < a_side_poses_end ? ref_rot : ref_rot_reversed).Distance(it->orientation);
+    if (d > angular_tolerance) {
+      std::stringstream ss;
+      ss << "Lane " << LaneEndName(it->lane_end) << " orientation is off by " << d << " from Lane "
+         << LaneEndName(reference.lane_end);
+      violations->push_back({InvariantViolation::Type::kLaneEndOrientation, it->lane_end.lane->id().string(),
+                             reference.lane_end.lane->id().string(), it->lane_end.end, reference.lane_end.end, d,
+                             std::nullopt, ss.str()});
+    }
+  }
+}
+
 }  // namespace
 
 RoadPositionResult RoadGeometry::ToRoadPosition(const InertialPosition& inertial_position,
@@ -76,6 +203,16 @@ RoadPositionResult RoadGeometry::ToRoadPosition(const InertialPosition& inertial
   return DoToRoadPosition(inertial_position, hint);
 }
 
+std::vector<RoadPositionResult> RoadGeometry::ToRoadPositions(const std::vector<InertialPosition>& inertial_positions,
+                                                              const std::vector<std::optional<RoadPosition>>& hints,
+                                                              std::size_t num_threads) const {
+  MALIPUT_PROFILE_FUNC();
+  MALIPUT_VALIDATE(hints.empty() || hints.size() == inertial_positions.size(),
+                   "hints must be either empty or have the same size as inertial_positions.");
+  MALIPUT_VALIDATE(num_threads > 0, "num_threads must be positive.");
+  return DoToRoadPositions(inertial_positions, hints, num_threads);
+}
+
 std::vector<RoadPositionResult> RoadGeometry::FindRoadPositions(const InertialPosition& inertial_position,
                                                                 double radius) const {
   MALIPUT_PROFILE_FUNC();
@@ -96,118 +233,66 @@ math::Vector3 RoadGeometry::inertial_to_backend_frame_translation() const {
 
 std::vector<std::string> RoadGeometry::CheckInvariants() const {
   MALIPUT_PROFILE_FUNC();
+  const std::vector<InvariantViolation> violations = FindInvariantViolations();
   std::vector<std::string> failures;
-
-  // Verify correctness of back-pointers/indexing in object hierarchy.
-  for (int bpi = 0; bpi < num_branch_points(); ++bpi) {
-    const BranchPoint* bp = branch_point(bpi);
-    if (bp->road_geometry() != this) {
-      std::stringstream ss;
-      ss << "BranchPoint " << bp->id().string() << " is owned by " << this->id().string() << " (" << this
-         << ") but claims to be owned by " << bp->road_geometry()->id().string() << " (" << bp->road_geometry() << ").";
-      failures.push_back(ss.str());
-    }
-  }
-  for (int ji = 0; ji < num_junctions(); ++ji) {
-    const Junction* jnx = junction(ji);
-    if (jnx->road_geometry() != this) {
-      std::stringstream ss;
-      ss << "Junction " << jnx->id().string() << " is owned by " << this->id().string() << " (" << this
-         << ") but claims to be owned by " << jnx->road_geometry()->id().string() << " (" << jnx->road_geometry()
-         << ").";
-      failures.push_back(ss.str());
-    }
-    for (int si = 0; si < jnx->num_segments(); ++si) {
-      const Segment* seg = jnx->segment(si);
-      if (seg->junction() != jnx) {
-        std::stringstream ss;
-        ss << "Segment " << seg->id().string() << " is owned by " << jnx->id().string() << " (" << jnx
-           << ") but claims to be owned by " << seg->junction()->id().string() << " (" << seg->junction() << ").";
-        failures.push_back(ss.str());
-      }
-      for (int li = 0; li < seg->num_lanes(); ++li) {
-        const Lane* lane = seg->lane(li);
-        if (lane->segment() != seg) {
-          std::stringstream ss;
-          ss << "Lane " << lane->id().string() << " is owned by " << seg->id().string() << " (" << seg
-             << ") but claims to be owned by " << lane->segment()->id().string() << " (" << lane->segment() << ").";
-          failures.push_back(ss.str());
-        }
-        // Currently, only Lane has an index() accessor, because its the only
-        // component for which the index is meaningful (e.g., adjacency of
-        // lanes).
-        if (lane->index() != li) {
-          std::stringstream ss;
-          ss << "Lane " << lane->id().string() << " has index " << li << " but claims to have index " << lane->index()
-             << ".";
-          failures.push_back(ss.str());
-        }
-      }
-    }
+  failures.reserve(violations.size());
+  for (const InvariantViolation& violation : violations) {
+    failures.push_back(violation.message);
   }
+  return failures;
+}
 
-  // Verify C1 continuity at branch-points (within declared tolerances).
-  for (int bpi = 0; bpi < num_branch_points(); ++bpi) {
-    const BranchPoint* bp = branch_point(bpi);
-    // For each BranchPoint:
-    //  - all branches should map to same `Inertial`-frame (x,y,z);
-    //  - orientation *into* BranchPoint should be the same for all A-side
-    //     branches;
-    //  - orientation *into* BranchPoint should be the same for all B-side
-    //     branches;
-    //  - orientation *into* BranchPoint for A-side should be same as
-    //     orientation *out of* BranchPoint for B-side.
-    if ((bp->GetASide()->size() == 0) && (bp->GetBSide()->size() == 0)) {
-      std::stringstream ss;
-      ss << "BranchPoint " << bp->id().string() << " is empty.";
-      failures.push_back(ss.str());
-      continue;
-    }
+std::vector<InvariantViolation> RoadGeometry::FindInvariantViolations(std::size_t num_threads) const {
+  MALIPUT_PROFILE_FUNC();
+  MALIPUT_VALIDATE(num_threads > 0, "num_threads must be positive.");
+  // Each chunk reports to its own vectors, which are concatenated in chunk order so the result does not depend on
+  // the number of threads.
+  const std::vector<std::pair<std::size_t, std::size_t>> branch_point_chunks =
+      common::MakeChunks(num_branch_points(), num_threads);
+  const std::vector<std::pair<std::size_t, std::size_t>> junction_chunks =
+      common::MakeChunks(num_junctions(), num_threads);
+  std::vector<std::vector<InvariantViolation>> branch_point_ownership(branch_point_chunks.size());
+  std::vector<std::vector<InvariantViolation>> continuity(branch_point_chunks.size());
+  std::vector<std::vector<InvariantViolation>> hierarchy(junction_chunks.size());
 
-    const LaneEnd ref_end = (bp->GetASide()->size() > 0) ? bp->GetASide()->get(0) : bp->GetBSide()->get(0);
-    // ...test `Inertial`-frame position similarity.
-    const InertialPosition ref_geo = LaneEndInertialPosition(ref_end);
-    const auto test_inertial_position = [&](const LaneEndSet& ends) {
-      for (int bi = 0; bi < ends.size(); ++bi) {
-        const LaneEnd le = ends.get(bi);
-        const double d = ref_geo.Distance(LaneEndInertialPosition(le));
-        if (d > linear_tolerance()) {
-          std::stringstream ss;
-          ss << "Lane " << le.lane->id().string() << ((le.end == LaneEnd::kStart) ? "[start]" : "[end]")
-             << " position is off by " << d << " from Lane " << ref_end.lane->id().string()
-             << ((ref_end.end == LaneEnd::kStart) ? "[start]" : "[end]");
-          failures.push_back(ss.str());
-        }
+  common::ParallelFor(branch_point_chunks.size() + junction_chunks.size(), num_threads, [&](std::size_t i) {
+    if (i < branch_point_chunks.size()) {
+      // Branch points are visited once, checking both their ownership and the continuity of their lane ends.
+      for (std::size_t bpi = branch_point_chunks[i].first; bpi < branch_point_chunks[i].second; ++bpi) {
+        const BranchPoint* bp = branch_point(static_cast<int>(bpi));
+        CheckBranchPointOwnership(this, bp, &branch_point_ownership[i]);
+        CheckBranchPointContinuity(bp, linear_tolerance(), angular_tolerance(), &continuity[i]);
       }
-    };
-    test_inertial_position(*(bp->GetASide()));
-    test_inertial_position(*(bp->GetBSide()));
-    // ...test orientation similarity.
-    const LaneEnd ref_end_rot = (bp->GetASide()->size() > 0) ? bp->GetASide()->get(0) : bp->GetBSide()->get(0);
-    const Rotation ref_rot = (bp->GetASide()->size() > 0) ? OrientationOutFromLane(ref_end_rot)
-                                                          : OrientationOutFromLane(ref_end_rot).Reverse();
-    const auto test_orientation = [&](const LaneEndSet& ends, const Rotation& reference) {
-      for (int bi = 0; bi < ends.size(); ++bi) {
-        const LaneEnd le = ends.get(bi);
-        const double d = reference.Distance(OrientationOutFromLane(le));
-        if (d > angular_tolerance()) {
-          std::stringstream ss;
-          ss << "Lane " << le.lane->id().string() << ((le.end == LaneEnd::kStart) ? "[start]" : "[end]")
-             << " orientation is off by " << d << " from Lane " << ref_end_rot.lane->id().string()
-             << ((ref_end_rot.end == LaneEnd::kStart) ? "[start]" : "[end]");
-          failures.push_back(ss.str());
-        }
+    } else {
+      const std::size_t chunk = i - branch_point_chunks.size();
+      for (std::size_t ji = junction_chunks[chunk].first; ji < junction_chunks[chunk].second; ++ji) {
+        CheckJunctionHierarchy(this, junction(static_cast<int>(ji)), &hierarchy[chunk]);
       }
-    };
-    test_orientation(*(bp->GetASide()), ref_rot);
-    test_orientation(*(bp->GetBSide()), ref_rot.Reverse());
-  }
+    }
+  });
 
   // Check that Lane left/right relationships within a Segment are
   // geometrically sound.
   // TODO(maddog@tri.global)  Implement this.
 
-  return failures;
+  std::vector<InvariantViolation> violations;
+  for (auto* chunks : {&branch_point_ownership, &hierarchy, &continuity}) {
+    for (std::vector<InvariantViolation>& chunk : *chunks) {
+      std::move(chunk.begin(), chunk.end(), std::back_inserter(violations));
+    }
+  }
+  return violations;
+}
+
+std::vector<RoadPositionResult> RoadGeometry::DoToRoadPositions(
+    const std::vector<InertialPosition>& inertial_positions, const std::vector<std::optional<RoadPosition>>& hints,
+    std::size_t) const {
+  std::vector<RoadPositionResult> results;
+  results.reserve(inertial_positions.size());
+  for (std::size_t i = 0; i < inertial_positions.size(); ++i) {
+    results.push_back(DoToRoadPosition(inertial_positions[i], hints.empty() ? std::nullopt : hints[i]));
+  }
+  return results;
 }
 
 std::vector<InertialPosition> RoadGeometry::DoSampleAheadWaypoints(const LaneSRoute& route,
@@ -271,5 +356,37 @@ const BranchPoint* RoadGeometry::IdIndex::GetBranchPoint(const BranchPointId& id
   return DoGetBranchPoint(id);
 }
 
+std::optional<uint32_t> RoadGeometry::IdIndex::GetLaneIndex(const LaneId& id) const { return DoGetLaneIndex(id); }
+
+const Lane* RoadGeometry::IdIndex::GetLaneByIndex(uint32_t index) const { return DoGetLaneByIndex(index); }
+
+uint32_t RoadGeometry::IdIndex::num_lane_indices() const { return do_num_lane_indices(); }
+
+std::optional<uint32_t> RoadGeometry::IdIndex::GetSegmentIndex(const SegmentId& id) const {
+  return DoGetSegmentIndex(id);
+}
+
+const Segment* RoadGeometry::IdIndex::GetSegmentByIndex(uint32_t index) const { return DoGetSegmentByIndex(index); }
+
+uint32_t RoadGeometry::IdIndex::num_segment_indices() const { return do_num_segment_indices(); }
+
+std::optional<uint32_t> RoadGeometry::IdIndex::GetJunctionIndex(const JunctionId& id) const {
+  return DoGetJunctionIndex(id);
+}
+
+const Junction* RoadGeometry::IdIndex::GetJunctionByIndex(uint32_t index) const { return DoGetJunctionByIndex(index); }
+
+uint32_t RoadGeometry::IdIndex::num_junction_indices() const { return do_num_junction_indices(); }
+
+std::optional<uint32_t> RoadGeometry::IdIndex::GetBranchPointIndex(const BranchPointId& id) const {
+  return DoGetBranchPointIndex(id);
+}
+
+const BranchPoint* RoadGeometry::IdIndex::GetBranchPointByIndex(uint32_t index) const {
+  return DoGetBranchPointByIndex(index);
+}
+
+uint32_t RoadGeometry::IdIndex::num_branch_point_indices() const { return do_num_branch_point_indices(); }
+
 }  // namespace api
 }  // namespace maliput
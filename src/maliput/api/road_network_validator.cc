@@ -29,7 +29,13 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "maliput/api/road_network_validator.h"
 
+#include <algorithm>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <map>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "maliput/api/lane.h"
@@ -37,6 +43,7 @@
 #include "maliput/api/rules/right_of_way_rule.h"
 #include "maliput/api/rules/traffic_lights.h"
 #include "maliput/common/maliput_throw.h"
+#include "maliput/common/parallel_for.h"
 
 namespace maliput {
 namespace api {
@@ -45,120 +52,136 @@ namespace {
 using rules::BulbGroup;
 using rules::TrafficLight;
 
+using Violations = std::vector<std::string>;
+
+// Describes @p lane_s_range.
+std::string ToString(const LaneSRange& lane_s_range) {
+  return "LaneSRange(id: " + lane_s_range.lane_id().string() + ", s0:  " + std::to_string(lane_s_range.s_range().s0()) +
+         ", s1: " + std::to_string(lane_s_range.s_range().s1()) + ")";
+}
+
 // Given a `LaneSRoute` this method checks the G1 contiguity
 // between of all its `LaneSRange`.
-void CheckLaneSRouteContiguity(const RoadGeometry* road_geometry, const LaneSRoute& lane_s_route) {
+void CheckLaneSRouteContiguity(const RoadGeometry* road_geometry, const LaneSRoute& lane_s_route,
+                               Violations* violations) {
   // Iterating through the lanes of a rule.
   for (int i = 0; i < static_cast<int>(lane_s_route.ranges().size()) - 1; ++i) {
-    const LaneSRange lane_range_a = lane_s_route.ranges()[i];
-    const LaneSRange lane_range_b = lane_s_route.ranges()[i + 1];
+    const LaneSRange& lane_range_a = lane_s_route.ranges()[i];
+    const LaneSRange& lane_range_b = lane_s_route.ranges()[i + 1];
     if (!IsContiguous(lane_range_a, lane_range_b, road_geometry)) {
-      MALIPUT_THROW_MESSAGE("LaneSRange(id: " + lane_range_a.lane_id().string() +
-                            ", s0:  " + std::to_string(lane_range_a.s_range().s0()) +
-                            ", s1: " + std::to_string(lane_range_a.s_range().s1()) +
-                            ") is not G1 contiguous with "
-                            "LaneSRange(id: " +
-                            lane_range_b.lane_id().string() + ", s0:  " + std::to_string(lane_range_b.s_range().s0()) +
-                            ", s1: " + std::to_string(lane_range_b.s_range().s1()) + ").");
+      violations->push_back(ToString(lane_range_a) + " is not G1 contiguous with " + ToString(lane_range_b) + ".");
     }
   }
 }
 
-// Evaluates G1 contiguity for all rule zones.
-// @throws common::assertion_error When any rule zone is not G1 contiguous.
-void CheckContiguityBetweenLanes(const RoadNetwork& road_network) {
-  const rules::RoadRulebook::QueryResults rules = road_network.rulebook()->Rules();
+// Evaluates G1 contiguity for the rule zones in [begin, end) of @p zones.
+void CheckContiguityBetweenLanes(const RoadNetwork& road_network, const std::vector<const LaneSRoute*>& zones,
+                                 std::size_t begin, std::size_t end, Violations* violations) {
   const RoadGeometry* const road_geometry = road_network.road_geometry();
-  for (const std::pair<rules::DiscreteValueRule::Id, rules::DiscreteValueRule>& key_value :
-       rules.discrete_value_rules) {
-    CheckLaneSRouteContiguity(road_geometry, key_value.second.zone());
-  }
-  for (const std::pair<rules::RangeValueRule::Id, rules::RangeValueRule>& key_value : rules.range_value_rules) {
-    CheckLaneSRouteContiguity(road_geometry, key_value.second.zone());
+  for (std::size_t i = begin; i < end; ++i) {
+    CheckLaneSRouteContiguity(road_geometry, *zones[i], violations);
   }
 }
 
-// Confirms full DirectionUsageRule coverage. This is determined by
+// Confirms DirectionUsageRule coverage of the Lanes in [begin, end) of @p lanes. This is determined by
 // verifying that each Lane within the RoadGeometry has an associated
 // DirectionUsageRule. In the future, this check could be made even more
 // rigorous by confirming that the union of all DirectionUsageRule zones
 // covers the whole RoadGeometry.
-void CheckDirectionUsageRuleCoverage(const RoadNetwork& road_network) {
-  const auto& lanes_map = road_network.road_geometry()->ById().GetLanes();
-  for (const auto& lane_map : lanes_map) {
-    const LaneId lane_id = lane_map.first;
-    const auto results = road_network.rulebook()->FindRules({{lane_id, {0.0, lane_map.second->length()}}}, 0);
-    MALIPUT_THROW_UNLESS(results.direction_usage.size() > 0);
+void CheckDirectionUsageRuleCoverage(const RoadNetwork& road_network, const std::vector<const Lane*>& lanes,
+                                     std::size_t begin, std::size_t end, Violations* violations) {
+  for (std::size_t i = begin; i < end; ++i) {
+    const Lane* lane = lanes[i];
+    const auto results = road_network.rulebook()->FindRules({{lane->id(), {0.0, lane->length()}}}, 0);
+    if (results.direction_usage.empty()) {
+      violations->push_back("Lane(id: " + lane->id().string() + ") is not covered by any DirectionUsageRule.");
+    }
   }
 }
 
-// Calls RoadGeometry::CheckInvariants() and throws when there are violations.
-void ThrowIfThereAreRoadGeometryInvariants(const RoadNetwork& road_network) {
-  const std::vector<std::string> violations = road_network.road_geometry()->CheckInvariants();
-  MALIPUT_THROW_UNLESS(violations.size() == 0);
-}
-
 // Evaluates that Junctions, Segments and BranchPoints are not empty, Lanes
 // have a BranchPoint at each endpoint. Also, IdIndex must contain references to
 // all entities within the RoadGeometry graph.
-void CheckRoadGeometryHierarchyConsistency(const RoadNetwork& road_network) {
+void CheckRoadGeometryHierarchyConsistency(const RoadNetwork& road_network, Violations* violations) {
   const RoadGeometry* rg = road_network.road_geometry();
-  MALIPUT_THROW_UNLESS(rg != nullptr);
+  if (rg == nullptr) {
+    violations->push_back("RoadGeometry is nullptr.");
+    return;
+  }
+  const auto expect = [violations](bool condition, const std::string& message) {
+    if (!condition) {
+      violations->push_back(message);
+    }
+    return condition;
+  };
 
   const RoadGeometry::IdIndex& id_index = rg->ById();
-  MALIPUT_THROW_UNLESS(rg->num_junctions() > 0);
+  expect(rg->num_junctions() > 0, "RoadGeometry has no Junctions.");
   for (int i = 0; i < rg->num_junctions(); ++i) {
     const Junction* junction = rg->junction(i);
-    MALIPUT_THROW_UNLESS(junction != nullptr);
-    MALIPUT_THROW_UNLESS(junction->road_geometry() == rg);
-    MALIPUT_THROW_UNLESS(junction == id_index.GetJunction(junction->id()));
-    MALIPUT_THROW_UNLESS(junction->num_segments() > 0);
+    if (!expect(junction != nullptr, "Junction at index " + std::to_string(i) + " is nullptr.")) continue;
+    const std::string junction_name = "Junction(id: " + junction->id().string() + ")";
+    expect(junction->road_geometry() == rg, junction_name + " does not belong to the RoadGeometry.");
+    expect(junction == id_index.GetJunction(junction->id()), junction_name + " is not indexed.");
+    expect(junction->num_segments() > 0, junction_name + " has no Segments.");
     for (int j = 0; j < junction->num_segments(); ++j) {
       const Segment* segment = junction->segment(j);
-      MALIPUT_THROW_UNLESS(segment != nullptr);
-      MALIPUT_THROW_UNLESS(segment->junction() == junction);
-      MALIPUT_THROW_UNLESS(segment == id_index.GetSegment(segment->id()));
-      MALIPUT_THROW_UNLESS(segment->num_lanes() > 0);
+      if (!expect(segment != nullptr, junction_name + " has a nullptr Segment at index " + std::to_string(j) + ".")) {
+        continue;
+      }
+      const std::string segment_name = "Segment(id: " + segment->id().string() + ")";
+      expect(segment->junction() == junction, segment_name + " does not belong to " + junction_name + ".");
+      expect(segment == id_index.GetSegment(segment->id()), segment_name + " is not indexed.");
+      expect(segment->num_lanes() > 0, segment_name + " has no Lanes.");
       for (int k = 0; k < segment->num_lanes(); ++k) {
         const Lane* lane = segment->lane(k);
-        MALIPUT_THROW_UNLESS(lane != nullptr);
-        MALIPUT_THROW_UNLESS(lane->segment() == segment);
-        MALIPUT_THROW_UNLESS(lane == id_index.GetLane(lane->id()));
-        const BranchPoint* bp_start = lane->GetBranchPoint(LaneEnd::Which::kStart);
-        MALIPUT_THROW_UNLESS(bp_start != nullptr);
-        const BranchPoint* bp_finish = lane->GetBranchPoint(LaneEnd::Which::kFinish);
-        MALIPUT_THROW_UNLESS(bp_finish != nullptr);
+        if (!expect(lane != nullptr, segment_name + " has a nullptr Lane at index " + std::to_string(k) + ".")) {
+          continue;
+        }
+        const std::string lane_name = "Lane(id: " + lane->id().string() + ")";
+        expect(lane->segment() == segment, lane_name + " does not belong to " + segment_name + ".");
+        expect(lane == id_index.GetLane(lane->id()), lane_name + " is not indexed.");
+        expect(lane->GetBranchPoint(LaneEnd::Which::kStart) != nullptr, lane_name + " has no start BranchPoint.");
+        expect(lane->GetBranchPoint(LaneEnd::Which::kFinish) != nullptr, lane_name + " has no finish BranchPoint.");
       }
     }
   }
 
-  MALIPUT_THROW_UNLESS(rg->num_branch_points() >= 2);
+  expect(rg->num_branch_points() >= 2, "RoadGeometry has less than two BranchPoints.");
   for (int i = 0; i < rg->num_branch_points(); ++i) {
     const BranchPoint* bp = rg->branch_point(i);
-    MALIPUT_THROW_UNLESS(bp != nullptr);
-    MALIPUT_THROW_UNLESS(bp->road_geometry() == rg);
-    MALIPUT_THROW_UNLESS(bp == id_index.GetBranchPoint(bp->id()));
-    MALIPUT_THROW_UNLESS(bp->GetASide() != nullptr);
-    MALIPUT_THROW_UNLESS(bp->GetBSide() != nullptr);
-    MALIPUT_THROW_UNLESS(bp->GetASide()->size() != 0 || bp->GetBSide()->size() != 0);
+    if (!expect(bp != nullptr, "BranchPoint at index " + std::to_string(i) + " is nullptr.")) continue;
+    const std::string bp_name = "BranchPoint(id: " + bp->id().string() + ")";
+    expect(bp->road_geometry() == rg, bp_name + " does not belong to the RoadGeometry.");
+    expect(bp == id_index.GetBranchPoint(bp->id()), bp_name + " is not indexed.");
+    const bool has_a_side = expect(bp->GetASide() != nullptr, bp_name + " has a nullptr A-side.");
+    const bool has_b_side = expect(bp->GetBSide() != nullptr, bp_name + " has a nullptr B-side.");
+    if (has_a_side && has_b_side) {
+      expect(bp->GetASide()->size() != 0 || bp->GetBSide()->size() != 0, bp_name + " is empty.");
+    }
   }
 }
 
 // Checks that TrafficLight::Ids and BulbGroup::Ids in RightOfWayRules
 // as RelatedBulbGroups have a supporting entity in TrafficLightBook.
-void CheckRelatedBulbGroups(const RoadNetwork& road_network) {
-  auto evaluate_related_bulb_group_existance = [&](const TrafficLight::Id& traffic_light_id,
-                                                   const BulbGroup::Id& bulb_group_id) {
-    const TrafficLight* traffic_light = road_network.traffic_light_book()->GetTrafficLight(traffic_light_id);
-    MALIPUT_THROW_UNLESS(traffic_light != nullptr);
-    MALIPUT_THROW_UNLESS(traffic_light->GetBulbGroup(bulb_group_id) != nullptr);
-  };
-
-  const rules::RoadRulebook::QueryResults result = road_network.rulebook()->Rules();
-  for (const auto& rule_id_to_rule : result.right_of_way) {
+void CheckRelatedBulbGroups(const RoadNetwork& road_network, const rules::RoadRulebook::QueryResults& rules,
+                            Violations* violations) {
+  for (const auto& rule_id_to_rule : rules.right_of_way) {
     for (const auto& traffic_light_bulb_groups : rule_id_to_rule.second.related_bulb_groups()) {
+      const TrafficLight* traffic_light =
+          road_network.traffic_light_book()->GetTrafficLight(traffic_light_bulb_groups.first);
+      if (traffic_light == nullptr) {
+        violations->push_back("TrafficLight(id: " + traffic_light_bulb_groups.first.string() +
+                              "), which is related to RightOfWayRule(id: " + rule_id_to_rule.first.string() +
+                              ") does not exist in TrafficLightBook.");
+        continue;
+      }
       for (const BulbGroup::Id& bulb_group_id : traffic_light_bulb_groups.second) {
-        evaluate_related_bulb_group_existance(traffic_light_bulb_groups.first, bulb_group_id);
+        if (traffic_light->GetBulbGroup(bulb_group_id) == nullptr) {
+          violations->push_back("BulbGroup(id: " + bulb_group_id.string() +
+                                "), which is related to RightOfWayRule(id: " + rule_id_to_rule.first.string() +
+                                ") does not exist in TrafficLight(id: " + traffic_light->id().string() + ").");
+        }
       }
     }
   }
@@ -167,17 +190,21 @@ void CheckRelatedBulbGroups(const RoadNetwork& road_network) {
 // Walks through all rules::Phases in rules::PhaseRingBook and calls
 // `evaluate_phase`.
 //
-// `evaluate_phase` is a functor that throws if rules::Phase is invalid.
-//
-// @throws common::assertion_error When querying for a rules::PhaseRing to
-// `road_network.phase_ring_book()` returns nullopt.
-void WalkPhases(const RoadNetwork& road_network, std::function<void(const rules::Phase&)> evaluate_phase) {
+// `evaluate_phase` is a functor that reports the violations of a rules::Phase.
+void WalkPhases(const RoadNetwork& road_network, const std::function<void(const rules::Phase&)>& evaluate_phase,
+                Violations* violations) {
   const rules::PhaseRingBook* phase_ring_book = road_network.phase_ring_book();
-  MALIPUT_THROW_UNLESS(phase_ring_book != nullptr);
+  if (phase_ring_book == nullptr) {
+    violations->push_back("PhaseRingBook is nullptr.");
+    return;
+  }
   const std::vector<rules::PhaseRing::Id> phase_ring_ids = phase_ring_book->GetPhaseRings();
   for (const rules::PhaseRing::Id& phase_ring_id : phase_ring_ids) {
     const std::optional<rules::PhaseRing> phase_ring = phase_ring_book->GetPhaseRing(phase_ring_id);
-    MALIPUT_THROW_UNLESS(phase_ring.has_value());
+    if (!phase_ring.has_value()) {
+      violations->push_back("PhaseRing(id: " + phase_ring_id.string() + ") can't be found in PhaseRingBook.");
+      continue;
+    }
     for (const auto& phase_id_phase : phase_ring->phases()) {
       evaluate_phase(phase_id_phase.second);
     }
@@ -187,23 +214,32 @@ void WalkPhases(const RoadNetwork& road_network, std::function<void(const rules:
 // Evaluates that every rules::DiscreteValueRuleStates contained in
 // rules::Phases reference rules::Rules in `road_network.rulebook()` and their
 // values.
-void CheckPhaseDiscreteValueRuleStates(const RoadNetwork& road_network) {
-  auto evaluate_phase = [rulebook = road_network.rulebook()](const rules::Phase& phase) {
+void CheckPhaseDiscreteValueRuleStates(const RoadNetwork& road_network, Violations* violations) {
+  auto evaluate_phase = [rulebook = road_network.rulebook(), violations](const rules::Phase& phase) {
     for (const auto& rule_id_value : phase.discrete_value_rule_states()) {
-      const rules::DiscreteValueRule rule = rulebook->GetDiscreteValueRule(rule_id_value.first);
-      if (std::find(rule.states().begin(), rule.states().end(), rule_id_value.second) == rule.states().end()) {
-        MALIPUT_THROW_MESSAGE("DiscreteValueRuleStates have an unknown DiscreteValue referenced by Rule(id: " +
-                              rule.id().string() + ") in Phase(id: " + phase.id().string() + ")");
+      std::optional<rules::DiscreteValueRule> rule;
+      try {
+        rule = rulebook->GetDiscreteValueRule(rule_id_value.first);
+      } catch (const std::exception&) {
+        violations->push_back("DiscreteValueRule(id: " + rule_id_value.first.string() +
+                              "), which is referenced by Phase(id: " + phase.id().string() +
+                              ") does not exist in RoadRulebook.");
+        continue;
+      }
+      if (std::find(rule->states().begin(), rule->states().end(), rule_id_value.second) == rule->states().end()) {
+        violations->push_back("DiscreteValueRuleStates have an unknown DiscreteValue referenced by Rule(id: " +
+                              rule->id().string() + ") in Phase(id: " + phase.id().string() + ")");
       }
     }
   };
-  WalkPhases(road_network, evaluate_phase);
+  WalkPhases(road_network, evaluate_phase, violations);
 }
 
 // Evaluates that every rules::BulbStates contained in rules::Phases reference
 // rules::Bulbs in `road_network.traffic_light_book()`.
-void CheckPhasesBulbStates(const RoadNetwork& road_network) {
-  auto evaluate_phase = [traffic_light_book = road_network.traffic_light_book()](const rules::Phase& phase) {
+void CheckPhasesBulbStates(const RoadNetwork& road_network, Violations* violations) {
+  auto evaluate_phase = [traffic_light_book = road_network.traffic_light_book(),
+                         violations](const rules::Phase& phase) {
     if (!phase.bulb_states().has_value()) {
       return;
     }
@@ -211,36 +247,39 @@ void CheckPhasesBulbStates(const RoadNetwork& road_network) {
       const rules::TrafficLight* traffic_light =
           traffic_light_book->GetTrafficLight(unique_bulb_id_state.first.traffic_light_id());
       if (traffic_light == nullptr) {
-        MALIPUT_THROW_MESSAGE("TrafficLight(id: " + unique_bulb_id_state.first.traffic_light_id().string() +
+        violations->push_back("TrafficLight(id: " + unique_bulb_id_state.first.traffic_light_id().string() +
                               "), which is referenced by Phase(id: " + phase.id().string() +
                               ") does not exist in TrafficLightBook.");
+        continue;
       }
       const rules::BulbGroup* bulb_group = traffic_light->GetBulbGroup(unique_bulb_id_state.first.bulb_group_id());
       if (bulb_group == nullptr) {
-        MALIPUT_THROW_MESSAGE("BulbGroup(id: " + unique_bulb_id_state.first.bulb_group_id().string() +
+        violations->push_back("BulbGroup(id: " + unique_bulb_id_state.first.bulb_group_id().string() +
                               "), which is referenced by Phase(id: " + phase.id().string() +
                               ") does not exist in TrafficLightBook.");
+        continue;
       }
       const rules::Bulb* bulb = bulb_group->GetBulb(unique_bulb_id_state.first.bulb_id());
       if (bulb == nullptr) {
-        MALIPUT_THROW_MESSAGE("Bulb(id: " + unique_bulb_id_state.first.bulb_id().string() +
+        violations->push_back("Bulb(id: " + unique_bulb_id_state.first.bulb_id().string() +
                               "), which is referenced by Phase(id: " + phase.id().string() +
                               ") does not exist in TrafficLightBook.");
+        continue;
       }
       if (std::find(bulb->states().begin(), bulb->states().end(), unique_bulb_id_state.second) ==
           bulb->states().end()) {
-        MALIPUT_THROW_MESSAGE("BulbStates have an unknown BulbState referenced by UniqueBulbId(id: " +
+        violations->push_back("BulbStates have an unknown BulbState referenced by UniqueBulbId(id: " +
                               unique_bulb_id_state.first.string() + ") in Phase(id: " + phase.id().string() + ")");
       }
     }
   };
-  WalkPhases(road_network, evaluate_phase);
+  WalkPhases(road_network, evaluate_phase, violations);
 }
 
 // Evaluates if `rule_id` is in `discrete_value_rules` or `range_value_rules`.
-bool IsRuleIdIn(const rules::Rule::Id rule_id,
-                const std::map<rules::DiscreteValueRule::Id, rules::DiscreteValueRule> discrete_value_rules,
-                const std::map<rules::RangeValueRule::Id, rules::RangeValueRule> range_value_rules) {
+bool IsRuleIdIn(const rules::Rule::Id& rule_id,
+                const std::map<rules::DiscreteValueRule::Id, rules::DiscreteValueRule>& discrete_value_rules,
+                const std::map<rules::RangeValueRule::Id, rules::RangeValueRule>& range_value_rules) {
   return (discrete_value_rules.find(rule_id) != discrete_value_rules.end()) ||
          (range_value_rules.find(rule_id) != range_value_rules.end());
 }
@@ -248,20 +287,15 @@ bool IsRuleIdIn(const rules::Rule::Id rule_id,
 // Evaluates if rules::DiscreteValueRules and rules::RangeValueRules contain
 // states whose Rule::RelatedRules point to existent rule::Rules in
 // `road_network.rulebook()`.
-void CheckRelatedRues(const RoadNetwork& road_network) {
-  const rules::RoadRulebook::QueryResults rules = road_network.rulebook()->Rules();
-
+void CheckRelatedRules(const rules::RoadRulebook::QueryResults& rules, Violations* violations) {
   for (const auto& kv : rules.discrete_value_rules) {
     for (const auto& value : kv.second.states()) {
       for (const auto& group_related_rule_ids : value.related_rules) {
         for (const auto& related_rule_id : group_related_rule_ids.second) {
           if (!IsRuleIdIn(related_rule_id, rules.discrete_value_rules, rules.range_value_rules)) {
-            MALIPUT_THROW_MESSAGE("DiscreteValueRule(id:" + kv.first.string() +
-                                  ") has a DiscreteValue with a "
-                                  "RelatedRule pointing to id:" +
-                                  related_rule_id.string() +
-                                  " and it does not exist in the "
-                                  "RoadRulebook.");
+            violations->push_back("DiscreteValueRule(id:" + kv.first.string() +
+                                  ") has a DiscreteValue with a RelatedRule pointing to id:" +
+                                  related_rule_id.string() + " and it does not exist in the RoadRulebook.");
           }
         }
       }
@@ -273,10 +307,9 @@ void CheckRelatedRues(const RoadNetwork& road_network) {
       for (const auto& group_related_rule_ids : range.related_rules) {
         for (const auto& related_rule_id : group_related_rule_ids.second) {
           if (!IsRuleIdIn(related_rule_id, rules.discrete_value_rules, rules.range_value_rules)) {
-            MALIPUT_THROW_MESSAGE("RangeValueRule(id:" + kv.first.string() +
-                                  ") has a Range with a related rule "
-                                  "pointing to id:" +
-                                  related_rule_id.string() + " and it does not exist in the RoadRulebook.");
+            violations->push_back("RangeValueRule(id:" + kv.first.string() +
+                                  ") has a Range with a related rule pointing to id:" + related_rule_id.string() +
+                                  " and it does not exist in the RoadRulebook.");
           }
         }
       }
@@ -284,32 +317,159 @@ void CheckRelatedRues(const RoadNetwork& road_network) {
   }
 }
 
+// A unit of work of a check. Every task reports to its own violations, so tasks don't need to synchronize.
+struct Task {
+  std::size_t check_index{};
+  std::function<void(Violations*)> run;
+  Violations violations;
+  std::chrono::duration<double> duration{};
+};
+
+// Runs @p task, turning any exception into a violation.
+void RunTask(Task* task) {
+  const auto start = std::chrono::steady_clock::now();
+  try {
+    task->run(&task->violations);
+  } catch (const std::exception& e) {
+    task->violations.push_back(e.what());
+  } catch (...) {
+    task->violations.push_back("Unknown exception.");
+  }
+  task->duration = std::chrono::steady_clock::now() - start;
+}
+
 }  // namespace
 
-void ValidateRoadNetwork(const RoadNetwork& road_network, const RoadNetworkValidatorOptions& options) {
+bool RoadNetworkValidationReport::is_valid() const {
+  return std::all_of(checks.begin(), checks.end(), [](const auto& check) { return check.violations.empty(); });
+}
+
+std::vector<std::string> RoadNetworkValidationReport::violations() const {
+  std::vector<std::string> result;
+  for (const RoadNetworkCheckResult& check : checks) {
+    for (const std::string& violation : check.violations) {
+      result.push_back(check.name + ": " + violation);
+    }
+  }
+  return result;
+}
+
+RoadNetworkValidationReport CheckRoadNetwork(const RoadNetwork& road_network,
+                                             const RoadNetworkValidatorOptions& options) {
+  MALIPUT_VALIDATE(options.num_threads > 0, "Number of threads must be greater than 0.");
+  const auto start = std::chrono::steady_clock::now();
+  RoadNetworkValidationReport report;
+  std::vector<Task> tasks;
+  const auto add_check = [&report](const std::string& name) {
+    report.checks.push_back({name, {}, {}});
+    return report.checks.size() - 1;
+  };
+  const auto add_task = [&tasks](std::size_t check_index, std::function<void(Violations*)> run) {
+    tasks.push_back({check_index, std::move(run), {}, {}});
+  };
+
+  // Rules() copies the whole rulebook, it is queried once for all the checks that need it.
+  rules::RoadRulebook::QueryResults rules;
+  if (options.check_related_bulb_groups || options.check_contiguity_rule_zones || options.check_related_rules) {
+    rules = road_network.rulebook()->Rules();
+  }
+  // Lanes are sorted by id so the violations are reported in the same order across runs.
+  std::vector<const Lane*> lanes;
   if (options.check_direction_usage_rule_coverage) {
-    CheckDirectionUsageRuleCoverage(road_network);
+    const RoadGeometry::IdIndex& id_index = road_network.road_geometry()->ById();
+    if (id_index.num_lane_indices() > 0) {
+      for (uint32_t i = 0; i < id_index.num_lane_indices(); ++i) {
+        lanes.push_back(id_index.GetLaneByIndex(i));
+      }
+    } else {
+      for (const auto& lane_id_lane : id_index.GetLanes()) {
+        lanes.push_back(lane_id_lane.second);
+      }
+    }
+    std::sort(lanes.begin(), lanes.end(),
+              [](const Lane* lhs, const Lane* rhs) { return lhs->id().string() < rhs->id().string(); });
+  }
+  std::vector<const LaneSRoute*> zones;
+  if (options.check_contiguity_rule_zones) {
+    for (const auto& key_value : rules.discrete_value_rules) {
+      zones.push_back(&key_value.second.zone());
+    }
+    for (const auto& key_value : rules.range_value_rules) {
+      zones.push_back(&key_value.second.zone());
+    }
+  }
+
+  if (options.check_direction_usage_rule_coverage) {
+    const std::size_t index = add_check("check_direction_usage_rule_coverage");
+    for (const auto& [begin, end] : common::MakeChunks(lanes.size(), options.num_threads)) {
+      add_task(index, [&road_network, &lanes, begin = begin, end = end](Violations* violations) {
+        CheckDirectionUsageRuleCoverage(road_network, lanes, begin, end, violations);
+      });
+    }
   }
   if (options.check_road_geometry_invariants) {
-    ThrowIfThereAreRoadGeometryInvariants(road_network);
+    // It is a single task over the whole RoadGeometry, so it is queued first to let the shorter tasks run alongside
+    // it. It runs on the thread of its task rather than fanning out again.
+    add_task(add_check("check_road_geometry_invariants"), [&road_network](Violations* violations) {
+      for (const InvariantViolation& violation : road_network.road_geometry()->FindInvariantViolations(1)) {
+        violations->push_back(violation.message);
+      }
+    });
+    std::rotate(tasks.begin(), tasks.end() - 1, tasks.end());
   }
   if (options.check_road_geometry_hierarchy) {
-    CheckRoadGeometryHierarchyConsistency(road_network);
+    add_task(add_check("check_road_geometry_hierarchy"), [&road_network](Violations* violations) {
+      CheckRoadGeometryHierarchyConsistency(road_network, violations);
+    });
   }
   if (options.check_related_bulb_groups) {
-    CheckRelatedBulbGroups(road_network);
+    add_task(add_check("check_related_bulb_groups"), [&road_network, &rules](Violations* violations) {
+      CheckRelatedBulbGroups(road_network, rules, violations);
+    });
   }
   if (options.check_contiguity_rule_zones) {
-    CheckContiguityBetweenLanes(road_network);
+    const std::size_t index = add_check("check_contiguity_rule_zones");
+    for (const auto& [begin, end] : common::MakeChunks(zones.size(), options.num_threads)) {
+      add_task(index, [&road_network, &zones, begin = begin, end = end](Violations* violations) {
+        CheckContiguityBetweenLanes(road_network, zones, begin, end, violations);
+      });
+    }
   }
   if (options.check_phase_discrete_value_rule_states) {
-    CheckPhaseDiscreteValueRuleStates(road_network);
+    add_task(add_check("check_phase_discrete_value_rule_states"), [&road_network](Violations* violations) {
+      CheckPhaseDiscreteValueRuleStates(road_network, violations);
+    });
   }
   if (options.check_phase_bulb_states) {
-    CheckPhasesBulbStates(road_network);
+    add_task(add_check("check_phase_bulb_states"),
+             [&road_network](Violations* violations) { CheckPhasesBulbStates(road_network, violations); });
   }
   if (options.check_related_rules) {
-    CheckRelatedRues(road_network);
+    add_task(add_check("check_related_rules"),
+             [&rules](Violations* violations) { CheckRelatedRules(rules, violations); });
+  }
+
+  common::ParallelFor(tasks.size(), options.num_threads, [&tasks](std::size_t i) { RunTask(&tasks[i]); });
+
+  // The tasks of every check are merged in the order they were created, so the report does not depend on the number
+  // of threads.
+  for (Task& task : tasks) {
+    RoadNetworkCheckResult& check = report.checks[task.check_index];
+    std::move(task.violations.begin(), task.violations.end(), std::back_inserter(check.violations));
+    check.duration += task.duration;
+  }
+  report.duration = std::chrono::steady_clock::now() - start;
+  return report;
+}
+
+void ValidateRoadNetwork(const RoadNetwork& road_network, const RoadNetworkValidatorOptions& options) {
+  const RoadNetworkValidationReport report = CheckRoadNetwork(road_network, options);
+  if (!report.is_valid()) {
+    std::string message{"RoadNetwork is not valid:"};
+    for (const std::string& violation : report.violations()) {
+      message += "\n  - " + violation;
+    }
+    MALIPUT_THROW_MESSAGE(message);
   }
 }
 
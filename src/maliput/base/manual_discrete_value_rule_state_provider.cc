@@ -33,9 +33,6 @@
 #include <stdexcept>
 #include <string>
 
-#include "maliput/base/rule_filter.h"
-#include "maliput/common/logger.h"
-
 namespace maliput {
 
 void ManualDiscreteValueRuleStateProvider::ValidateRuleState(
@@ -69,36 +66,47 @@ void ManualDiscreteValueRuleStateProvider::SetState(
     state_result.next = {{*next_state, duration_until}};
   }
 
-  states_[id] = state_result;
+  states_.Set(id, state_result);
+}
+
+void ManualDiscreteValueRuleStateProvider::GetAllStates(StatesSnapshot* snapshot) const {
+  states_.GetAllStates([this](auto* states) { DoGetAllStates(states); }, snapshot);
+}
+
+ManualDiscreteValueRuleStateProvider::StatesSnapshot ManualDiscreteValueRuleStateProvider::GetAllStates() const {
+  StatesSnapshot snapshot;
+  GetAllStates(&snapshot);
+  return snapshot;
+}
+
+void ManualDiscreteValueRuleStateProvider::GetStatesChangedSince(std::size_t version, StateChanges* changes) const {
+  states_.GetStatesChangedSince(version, [this](auto* states) { DoGetAllStates(states); }, changes);
+}
+
+void ManualDiscreteValueRuleStateProvider::DoGetAllStates(
+    std::vector<std::optional<api::rules::DiscreteValueRuleStateProvider::StateResult>>* states) const {
+  for (std::size_t i = 0; i < states->size(); ++i) {
+    GetManualState(i, &(*states)[i]);
+  }
 }
 
 std::optional<api::rules::DiscreteValueRuleStateProvider::StateResult> ManualDiscreteValueRuleStateProvider::DoGetState(
     const api::rules::Rule::Id& id) const {
-  const auto it = states_.find(id);
-  if (it == states_.end()) {
+  const api::rules::DiscreteValueRuleStateProvider::StateResult* state = states_.Find(id);
+  if (state == nullptr) {
     return std::nullopt;
   }
-  return it->second;
+  return *state;
 }
 
 std::optional<api::rules::DiscreteValueRuleStateProvider::StateResult> ManualDiscreteValueRuleStateProvider::DoGetState(
     const api::RoadPosition& road_position, const api::rules::Rule::TypeId& rule_type, double tolerance) const {
-  const auto filtered_discrete_value_rules = GetFilteredDiscreteValueRules(road_position, rule_type, tolerance);
-  if (filtered_discrete_value_rules.size() > 1) {
-    maliput::log()->warn("For rule_type: ", rule_type.string(),
-                         " and road_position: [LaneId: ", road_position.lane->id(),
-                         ", LanePos: ", road_position.pos.srh().to_str(), "] there are more than one possible rules: ");
-    for (const auto& rule : filtered_discrete_value_rules) {
-      maliput::log()->warn("\tRule id: ", rule.first.string(), " matches with rule_type: ", rule_type.string(),
-                           " and road_position: [LaneId: ", road_position.lane->id(),
-                           ", LanePos: ", road_position.pos.srh().to_str(), "]");
-    }
-  }
+  const std::optional<api::rules::Rule::Id> rule_id = rule_zone_index_.FindRule(road_position, rule_type, tolerance);
   std::optional<api::rules::DiscreteValueRuleStateProvider::StateResult> current_state{std::nullopt};
-  if (!filtered_discrete_value_rules.empty()) {
-    const auto state = states_.find(filtered_discrete_value_rules.begin()->first);
-    MALIPUT_THROW_UNLESS(state != states_.end());
-    current_state = std::make_optional<>(state->second);
+  if (rule_id.has_value()) {
+    const api::rules::DiscreteValueRuleStateProvider::StateResult* state = states_.Find(*rule_id);
+    MALIPUT_THROW_UNLESS(state != nullptr);
+    current_state = std::make_optional<>(*state);
   }
   return current_state;
 }
@@ -107,18 +115,11 @@ std::map<api::rules::DiscreteValueRule::Id, api::rules::DiscreteValueRule>
 ManualDiscreteValueRuleStateProvider::GetFilteredDiscreteValueRules(const api::RoadPosition& road_position,
                                                                     const api::rules::Rule::TypeId& rule_type,
                                                                     double tolerance) const {
-  MALIPUT_THROW_UNLESS(tolerance >= 0.);
-  const auto query_result_rules = rulebook_->Rules();
-  const DiscreteValueRuleFilter rule_type_filter = [&rule_type](const api::rules::DiscreteValueRule& rule) {
-    return rule.type_id() == rule_type;
-  };
-  const DiscreteValueRuleFilter zone_filter = [&road_position, tolerance](const api::rules::DiscreteValueRule& rule) {
-    const api::LaneSRange lane_s_range{road_position.lane->id(),
-                                       api::SRange{road_position.pos.s(), road_position.pos.s()}};
-    return rule.zone().Intersects(api::LaneSRoute({lane_s_range}), tolerance);
-  };
-  const auto filtered_rules = FilterRules(query_result_rules, {rule_type_filter, zone_filter}, {});
-  return filtered_rules.discrete_value_rules;
+  std::map<api::rules::DiscreteValueRule::Id, api::rules::DiscreteValueRule> result;
+  for (const api::rules::Rule::Id& id : rule_zone_index_.FindRules(road_position, rule_type, tolerance)) {
+    result.emplace(id, rulebook_->GetDiscreteValueRule(id));
+  }
+  return result;
 }
 
 }  // namespace maliput
@@ -43,6 +43,15 @@ using api::rules::PhaseRing;
 using api::rules::RightOfWayRule;
 using api::rules::Rule;
 
+namespace {
+
+// Returns a copy of `ring`, or std::nullopt when it is nullptr.
+std::optional<PhaseRing> ToOptional(const PhaseRing* ring) {
+  return ring != nullptr ? std::make_optional<PhaseRing>(*ring) : std::nullopt;
+}
+
+}  // namespace
+
 class ManualPhaseRingBook::Impl {
  public:
   MALIPUT_NO_COPY_NO_MOVE_NO_ASSIGN(Impl)
@@ -75,7 +84,7 @@ class ManualPhaseRingBook::Impl {
   }
 
   void RemovePhaseRing(const PhaseRing::Id& ring_id) {
-    const std::optional<PhaseRing> ring = DoGetPhaseRing(ring_id);
+    const std::optional<PhaseRing> ring = ToOptional(GetPhaseRingView(ring_id));
     if (ring == std::nullopt) {
       throw std::logic_error("Attempted to remove unknown PhaseRing with ID " + ring_id.string());
     }
@@ -101,28 +110,31 @@ class ManualPhaseRingBook::Impl {
     return result;
   }
 
-  std::optional<PhaseRing> DoGetPhaseRing(const PhaseRing::Id& ring_id) const {
+  const PhaseRing* GetPhaseRingView(const PhaseRing::Id& ring_id) const {
     auto it = ring_book_.find(ring_id);
     if (it == ring_book_.end()) {
-      return std::nullopt;
+      return nullptr;
     }
-    return it->second;
+    return &it->second;
   }
 
-  std::optional<PhaseRing> DoFindPhaseRing(const RightOfWayRule::Id& rule_id) const {
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+  const PhaseRing* FindPhaseRingView(const RightOfWayRule::Id& rule_id) const {
     auto it = right_of_way_rule_book_.find(rule_id);
     if (it == right_of_way_rule_book_.end()) {
-      return std::nullopt;
+      return nullptr;
     }
-    return ring_book_.at(it->second);
+    return &ring_book_.at(it->second);
   }
+#pragma GCC diagnostic pop
 
-  std::optional<PhaseRing> DoFindPhaseRing(const Rule::Id& rule_id) const {
+  const PhaseRing* FindPhaseRingView(const Rule::Id& rule_id) const {
     auto it = rule_book_.find(rule_id);
     if (it == rule_book_.end()) {
-      return std::nullopt;
+      return nullptr;
     }
-    return ring_book_.at(it->second);
+    return &ring_book_.at(it->second);
   }
 
  private:
@@ -141,16 +153,48 @@ void ManualPhaseRingBook::RemovePhaseRing(const PhaseRing::Id& ring_id) { impl_-
 
 std::vector<PhaseRing::Id> ManualPhaseRingBook::DoGetPhaseRings() const { return impl_->DoGetPhaseRings(); }
 
+const PhaseRing* ManualPhaseRingBook::GetPhaseRingView(const PhaseRing::Id& ring_id) const {
+  return impl_->GetPhaseRingView(ring_id);
+}
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+const PhaseRing* ManualPhaseRingBook::FindPhaseRingView(const RightOfWayRule::Id& rule_id) const {
+  return impl_->FindPhaseRingView(rule_id);
+}
+#pragma GCC diagnostic pop
+
+const PhaseRing* ManualPhaseRingBook::FindPhaseRingView(const Rule::Id& rule_id) const {
+  return impl_->FindPhaseRingView(rule_id);
+}
+
 std::optional<PhaseRing> ManualPhaseRingBook::DoGetPhaseRing(const PhaseRing::Id& ring_id) const {
-  return impl_->DoGetPhaseRing(ring_id);
+  return ToOptional(impl_->GetPhaseRingView(ring_id));
 }
 
 std::optional<PhaseRing> ManualPhaseRingBook::DoFindPhaseRing(const RightOfWayRule::Id& rule_id) const {
-  return impl_->DoFindPhaseRing(rule_id);
+  return ToOptional(impl_->FindPhaseRingView(rule_id));
 }
 
 std::optional<PhaseRing> ManualPhaseRingBook::DoFindPhaseRing(const Rule::Id& rule_id) const {
-  return impl_->DoFindPhaseRing(rule_id);
+  return ToOptional(impl_->FindPhaseRingView(rule_id));
+}
+
+const PhaseRing* ManualPhaseRingBook::DoGetPhaseRingView(const PhaseRing::Id& ring_id,
+                                                         std::optional<PhaseRing>*) const {
+  return impl_->GetPhaseRingView(ring_id);
+}
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+const PhaseRing* ManualPhaseRingBook::DoFindPhaseRingView(const RightOfWayRule::Id& rule_id,
+                                                          std::optional<PhaseRing>*) const {
+  return impl_->FindPhaseRingView(rule_id);
+}
+#pragma GCC diagnostic pop
+
+const PhaseRing* ManualPhaseRingBook::DoFindPhaseRingView(const Rule::Id& rule_id, std::optional<PhaseRing>*) const {
+  return impl_->FindPhaseRingView(rule_id);
 }
 
 }  // namespace maliput
@@ -30,7 +30,10 @@
 #include "maliput/base/manual_rulebook.h"
 
 #include <algorithm>
+#include <atomic>
 #include <iterator>
+#include <map>
+#include <mutex>
 #include <optional>
 #include <sstream>
 #include <stdexcept>
@@ -39,7 +42,7 @@
 #include <variant>
 
 #include "maliput/api/rules/rule.h"
-#include "maliput/common/maliput_hash.h"
+#include "maliput/common/interval_tree.h"
 #include "maliput/common/maliput_throw.h"
 
 namespace {
@@ -52,29 +55,6 @@ using IdVariant = std::variant<maliput::api::rules::RightOfWayRule::Id, maliput:
 #pragma GCC diagnostic pop
 }  // namespace
 
-namespace std {
-
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
-template <class HashAlgorithm>
-void hash_append(HashAlgorithm& hasher, const IdVariant& item) noexcept {
-  using maliput::common::hash_append;
-  if (std::get_if<maliput::api::rules::RightOfWayRule::Id>(&item)) {
-    hash_append(hasher, std::get<maliput::api::rules::RightOfWayRule::Id>(item));
-  }
-  if (std::get_if<maliput::api::rules::SpeedLimitRule::Id>(&item)) {
-    hash_append(hasher, std::get<maliput::api::rules::SpeedLimitRule::Id>(item));
-  }
-  if (std::get_if<maliput::api::rules::DirectionUsageRule::Id>(&item)) {
-    hash_append(hasher, std::get<maliput::api::rules::DirectionUsageRule::Id>(item));
-  }
-  if (std::get_if<maliput::api::rules::Rule::Id>(&item)) {
-    hash_append(hasher, std::get<maliput::api::rules::Rule::Id>(item));
-  }
-}
-#pragma GCC diagnostic pop
-
-}  // namespace std
 namespace maliput {
 
 using api::LaneId;
@@ -88,6 +68,7 @@ using api::rules::Rule;
 using api::rules::SpeedLimitRule;
 
 using QueryResults = api::rules::RoadRulebook::QueryResults;
+using QueryResultViews = ManualRulebook::QueryResultViews;
 
 class ManualRulebook::Impl {
  public:
@@ -103,6 +84,7 @@ class ManualRulebook::Impl {
     discrete_value_rules_.clear();
     range_value_rules_.clear();
     index_->RemoveAll();
+    ++revision_;
   }
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
@@ -124,6 +106,7 @@ class ManualRulebook::Impl {
 
     MALIPUT_THROW_UNLESS(discrete_value_rules_.emplace(rule.id(), rule).second);
     index_->AddRule(rule);
+    ++revision_;
   }
 
   void AddRule(const api::rules::RangeValueRule& rule) {
@@ -131,6 +114,7 @@ class ManualRulebook::Impl {
 
     MALIPUT_THROW_UNLESS(range_value_rules_.emplace(rule.id(), rule).second);
     index_->AddRule(rule);
+    ++revision_;
   }
 
   void RemoveRule(const api::rules::Rule::Id& id) {
@@ -147,27 +131,28 @@ class ManualRulebook::Impl {
     } else {
       MALIPUT_THROW_MESSAGE("Unable to remove Rule: Rule::Id: " + id.string() + " cannot be found.");
     }
+    ++revision_;
   }
 
-  QueryResults DoFindRules(const std::vector<LaneSRange>& ranges, double tolerance) const {
-    QueryResults result;
+  void FindRuleViews(const std::vector<LaneSRange>& ranges, double tolerance, QueryResultViews* views) const {
+    views->right_of_way.clear();
+    views->speed_limit.clear();
+    views->direction_usage.clear();
+    views->discrete_value_rules.clear();
+    views->range_value_rules.clear();
     for (const LaneSRange& range : ranges) {
-      for (const IdVariant& id : index_->FindRules(range, tolerance)) {
+      index_->VisitRules(range, tolerance, [&](const IdVariant& id) {
         if (std::get_if<RightOfWayRule::Id>(&id)) {
-          result.right_of_way.emplace(std::get<RightOfWayRule::Id>(id),
-                                      right_of_ways_.at(std::get<RightOfWayRule::Id>(id)));
+          views->right_of_way.push_back(&right_of_ways_.at(std::get<RightOfWayRule::Id>(id)));
         } else if (std::get_if<SpeedLimitRule::Id>(&id)) {
-          result.speed_limit.emplace(std::get<SpeedLimitRule::Id>(id),
-                                     speed_limits_.at(std::get<SpeedLimitRule::Id>(id)));
+          views->speed_limit.push_back(&speed_limits_.at(std::get<SpeedLimitRule::Id>(id)));
         } else if (std::get_if<DirectionUsageRule::Id>(&id)) {
-          result.direction_usage.emplace(std::get<DirectionUsageRule::Id>(id),
-                                         direction_usage_rules_.at(std::get<DirectionUsageRule::Id>(id)));
+          views->direction_usage.push_back(&direction_usage_rules_.at(std::get<DirectionUsageRule::Id>(id)));
         } else if (std::get_if<Rule::Id>(&id)) {
-          if (range_value_rules_.find(std::get<Rule::Id>(id)) != range_value_rules_.end()) {
-            result.range_value_rules.emplace(std::get<Rule::Id>(id), range_value_rules_.at(std::get<Rule::Id>(id)));
-          } else if (discrete_value_rules_.find(std::get<Rule::Id>(id)) != discrete_value_rules_.end()) {
-            result.discrete_value_rules.emplace(std::get<Rule::Id>(id),
-                                                discrete_value_rules_.at(std::get<Rule::Id>(id)));
+          if (const DiscreteValueRule* rule = GetDiscreteValueRuleView(std::get<Rule::Id>(id))) {
+            views->discrete_value_rules.push_back(rule);
+          } else if (const RangeValueRule* rule = GetRangeValueRuleView(std::get<Rule::Id>(id))) {
+            views->range_value_rules.push_back(rule);
           } else {
             throw std::out_of_range("IdVariant::rule:" + std::get<Rule::Id>(id).string() + " could not be found.");
           }
@@ -177,8 +162,47 @@ class ManualRulebook::Impl {
             << ", s0: " << range.s_range().s0() << ", s1: " << range.s_range().s1() << ")";
           throw std::domain_error(s.str());
         }
-      }
+      });
     }
+    // A rule is visited once per range that matches, so it may be repeated.
+    SortAndRemoveDuplicates(&views->right_of_way);
+    SortAndRemoveDuplicates(&views->speed_limit);
+    SortAndRemoveDuplicates(&views->direction_usage);
+    SortAndRemoveDuplicates(&views->discrete_value_rules);
+    SortAndRemoveDuplicates(&views->range_value_rules);
+  }
+
+  QueryResultViews RuleViews() const {
+    QueryResultViews views;
+    CollectViews(right_of_ways_, &views.right_of_way);
+    CollectViews(speed_limits_, &views.speed_limit);
+    CollectViews(direction_usage_rules_, &views.direction_usage);
+    CollectViews(discrete_value_rules_, &views.discrete_value_rules);
+    CollectViews(range_value_rules_, &views.range_value_rules);
+    return views;
+  }
+
+  const DiscreteValueRule* GetDiscreteValueRuleView(const Rule::Id& id) const {
+    const auto it = discrete_value_rules_.find(id);
+    return it != discrete_value_rules_.end() ? &it->second : nullptr;
+  }
+
+  std::size_t revision() const { return revision_; }
+
+  const RangeValueRule* GetRangeValueRuleView(const Rule::Id& id) const {
+    const auto it = range_value_rules_.find(id);
+    return it != range_value_rules_.end() ? &it->second : nullptr;
+  }
+
+  QueryResults DoFindRules(const std::vector<LaneSRange>& ranges, double tolerance) const {
+    QueryResultViews views;
+    FindRuleViews(ranges, tolerance, &views);
+    QueryResults result;
+    CopyViews(views.right_of_way, &result.right_of_way);
+    CopyViews(views.speed_limit, &result.speed_limit);
+    CopyViews(views.direction_usage, &result.direction_usage);
+    CopyViews(views.discrete_value_rules, &result.discrete_value_rules);
+    CopyViews(views.range_value_rules, &result.range_value_rules);
     return result;
   }
 
@@ -207,12 +231,41 @@ class ManualRulebook::Impl {
   RangeValueRule DoGetRangeValueRule(const Rule::Id& id) const { return range_value_rules_.at(id); }
 
  private:
+  // Sorts `rules` by ID and removes the repeated ones.
+  template <class T>
+  static void SortAndRemoveDuplicates(std::vector<const T*>* rules) {
+    std::sort(rules->begin(), rules->end(),
+              [](const T* lhs, const T* rhs) { return lhs->id().string() < rhs->id().string(); });
+    rules->erase(std::unique(rules->begin(), rules->end()), rules->end());
+  }
+
+  // Appends a view of every rule in `map` to `rules`, sorted by ID.
+  template <class T>
+  static void CollectViews(const std::unordered_map<typename T::Id, T>& map, std::vector<const T*>* rules) {
+    rules->reserve(map.size());
+    for (const auto& id_and_rule : map) {
+      rules->push_back(&id_and_rule.second);
+    }
+    SortAndRemoveDuplicates(rules);
+  }
+
+  // Copies the rules in `rules`, which are sorted by ID, into `map`.
+  template <class T>
+  static void CopyViews(const std::vector<const T*>& rules, std::map<typename T::Id, T>* map) {
+    for (const T* rule : rules) {
+      map->emplace_hint(map->end(), rule->id(), *rule);
+    }
+  }
+
   // An index from LaneSRange to collections of rule ID's of all types.
   // RangeIndex indexes rules (by ID) on the LaneSRanges which they affect,
   // facilitating the lookup of rules by LaneSRange.
   class RangeIndex {
    public:
-    void RemoveAll() { map_.clear(); }
+    void RemoveAll() {
+      map_.clear();
+      dirty_.store(false, std::memory_order_release);
+    }
 
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
@@ -261,36 +314,72 @@ class ManualRulebook::Impl {
       }
     }
 
-    std::vector<IdVariant> FindRules(const LaneSRange& range, double tolerance) {
-      std::vector<IdVariant> result;
+    // Calls `visitor` with the ID of every rule whose ranges on `range.lane_id()` intersect `range.s_range()` within
+    // `tolerance`, once per intersecting range.
+    // Runs in O(log(n) + k) for a lane with n ranges, k of them reported.
+    template <typename Visitor>
+    void VisitRules(const LaneSRange& range, double tolerance, Visitor&& visitor) {
       auto it = map_.find(range.lane_id());
       if (it != map_.end()) {
-        for (const auto& id_and_range : it->second) {
-          if (id_and_range.second.Intersects(range.s_range(), tolerance)) {
-            result.emplace_back(id_and_range.first);
+        RebuildIfNeeded();
+        const LaneIntervals& intervals = it->second;
+        // SRange::Intersects() widens the indexed range by `tolerance` on both ends. The lower end is clamped to
+        // zero, which doesn't change the result as s coordinates are non-negative.
+        const double min_s = std::min(range.s_range().s0(), range.s_range().s1()) - tolerance;
+        const double max_s = std::max(range.s_range().s0(), range.s_range().s1()) + tolerance;
+        intervals.Visit(min_s, max_s, [&](const LaneIntervals::Interval& interval) {
+          // Candidates are confirmed with SRange::Intersects() so results are exactly the same as checking every
+          // range.
+          if (interval.value.s_range.Intersects(range.s_range(), tolerance)) {
+            visitor(interval.value.id);
           }
-        }
+        });
       }
-      return result;
     }
 
    private:
+    // A (ID, SRange) association.
+    struct Entry {
+      IdVariant id;
+      SRange s_range;
+    };
+
+    using LaneIntervals = common::IntervalTree<Entry>;
+
     // Add a single (ID, LaneSRange) association.
-    void AddRange(const IdVariant& id, const LaneSRange& range) { map_[range.lane_id()].emplace(id, range.s_range()); }
+    void AddRange(const IdVariant& id, const LaneSRange& range) {
+      const SRange& s_range = range.s_range();
+      map_[range.lane_id()].Insert(std::min(s_range.s0(), s_range.s1()), std::max(s_range.s0(), s_range.s1()),
+                                   Entry{id, s_range});
+      dirty_.store(true, std::memory_order_release);
+    }
 
     // Removes all associations involving `id` and `lane_id`.
     void RemoveRanges(const IdVariant& id, const LaneId& lane_id) {
-      map_.at(lane_id).erase(id);
-      if (map_[lane_id].empty()) {
+      LaneIntervals& intervals = map_.at(lane_id);
+      intervals.RemoveIf([&id](const LaneIntervals::Interval& interval) { return interval.value.id == id; });
+      if (intervals.empty()) {
         map_.erase(lane_id);
+      } else {
+        dirty_.store(true, std::memory_order_release);
       }
     }
 
-    // TODO(maddog@tri.global)  Perhaps this class would benefit from something
-    //                          like boost::interval_map, though if there are
-    //                          not many rules attached to each individual
-    //                          lane_id, this is probably good enough.
-    std::unordered_map<LaneId, std::unordered_multimap<IdVariant, SRange, maliput::common::DefaultHash>> map_;
+    // Trees are rebuilt on the first query after rules are added or removed, so bulk loading a rulebook sorts each
+    // lane once. Concurrent queries are safe: the first one rebuilds while the others wait.
+    void RebuildIfNeeded() {
+      if (!dirty_.load(std::memory_order_acquire)) return;
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (!dirty_.load(std::memory_order_relaxed)) return;
+      for (auto& lane_intervals : map_) {
+        lane_intervals.second.Build();
+      }
+      dirty_.store(false, std::memory_order_release);
+    }
+
+    std::unordered_map<LaneId, LaneIntervals> map_;
+    std::atomic<bool> dirty_{false};
+    std::mutex mutex_;
   };
 
   // ID->Rule indices for each rule type.
@@ -305,6 +394,7 @@ class ManualRulebook::Impl {
     MALIPUT_THROW_UNLESS(map_result.second);
     // Add to index.
     index_->AddRule(rule);
+    ++revision_;
   }
 
   template <class T>
@@ -320,9 +410,11 @@ class ManualRulebook::Impl {
     // Remove from map.
     auto map_result = map->erase(id);
     MALIPUT_THROW_UNLESS(map_result > 0);
+    ++revision_;
   }
 
   std::unique_ptr<RangeIndex> index_;
+  std::size_t revision_{0};
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
   IdIndex<api::rules::RightOfWayRule> right_of_ways_;
@@ -360,12 +452,37 @@ void ManualRulebook::AddRule(const api::rules::RangeValueRule& rule) { impl_->Ad
 
 void ManualRulebook::RemoveRule(const api::rules::Rule::Id& id) { impl_->RemoveRule(id); }
 
+void ManualRulebook::FindRuleViews(const std::vector<LaneSRange>& ranges, double tolerance,
+                                   QueryResultViews* views) const {
+  MALIPUT_THROW_UNLESS(tolerance >= 0.);
+  MALIPUT_THROW_UNLESS(views != nullptr);
+  impl_->FindRuleViews(ranges, tolerance, views);
+}
+
+QueryResultViews ManualRulebook::FindRuleViews(const std::vector<LaneSRange>& ranges, double tolerance) const {
+  QueryResultViews views;
+  FindRuleViews(ranges, tolerance, &views);
+  return views;
+}
+
+QueryResultViews ManualRulebook::RuleViews() const { return impl_->RuleViews(); }
+
+const DiscreteValueRule* ManualRulebook::GetDiscreteValueRuleView(const Rule::Id& id) const {
+  return impl_->GetDiscreteValueRuleView(id);
+}
+
+const RangeValueRule* ManualRulebook::GetRangeValueRuleView(const Rule::Id& id) const {
+  return impl_->GetRangeValueRuleView(id);
+}
+
 QueryResults ManualRulebook::DoFindRules(const std::vector<LaneSRange>& ranges, double tolerance) const {
   return impl_->DoFindRules(ranges, tolerance);
 }
 
 QueryResults ManualRulebook::DoRules() const { return impl_->DoRules(); }
 
+std::optional<std::size_t> ManualRulebook::do_revision() const { return impl_->revision(); }
+
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
 RightOfWayRule ManualRulebook::DoGetRule(const RightOfWayRule::Id& id) const { return impl_->DoGetRule(id); }
@@ -44,29 +44,29 @@ using api::rules::RightOfWayRuleStateProvider;
 
 PhaseBasedRightOfWayRuleStateProvider::PhaseBasedRightOfWayRuleStateProvider(const PhaseRingBook* phase_ring_book,
                                                                              const PhaseProvider* phase_provider)
-    : phase_ring_book_(phase_ring_book), phase_provider_(phase_provider) {
+    : phase_ring_book_(phase_ring_book),
+      phase_provider_(phase_provider) {
   MALIPUT_DEMAND(phase_ring_book_ != nullptr && phase_provider != nullptr);
 }
 
 std::optional<RightOfWayRuleStateProvider::RightOfWayResult> PhaseBasedRightOfWayRuleStateProvider::DoGetState(
     const RightOfWayRule::Id& rule_id) const {
+  std::optional<PhaseRing> ring_storage;
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
-  std::optional<PhaseRing> ring = phase_ring_book_->FindPhaseRing(rule_id);
+  const PhaseRing* ring = phase_ring_book_->FindPhaseRingView(rule_id, &ring_storage);
 #pragma GCC diagnostic pop
-  if (ring.has_value()) {
+  if (ring != nullptr) {
     const std::optional<PhaseProvider::Result> phase_result = phase_provider_->GetPhase(ring->id());
     if (phase_result.has_value()) {
-      const Phase::Id phase_id = phase_result->state;
-      const Phase& phase = ring->phases().at(phase_id);
+      const Phase& phase = ring->phases().at(phase_result->state);
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
       const RightOfWayRule::State::Id state_id = phase.rule_states().at(rule_id);
       std::optional<RightOfWayResult::Next> next = std::nullopt;
 #pragma GCC diagnostic pop
       if (phase_result->next.has_value()) {
-        const Phase::Id next_phase_id = phase_result->next->state;
-        const Phase& next_phase = ring->phases().at(next_phase_id);
+        const Phase& next_phase = ring->phases().at(phase_result->next->state);
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
         const RightOfWayRule::State::Id next_state_id = next_phase.rule_states().at(rule_id);
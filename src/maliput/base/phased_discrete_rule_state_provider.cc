@@ -29,11 +29,12 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "maliput/base/phased_discrete_rule_state_provider.h"
 
+#include <algorithm>
+#include <utility>
+
 #include "maliput/api/rules/discrete_value_rule.h"
 #include "maliput/api/rules/phase.h"
 #include "maliput/api/rules/phase_ring.h"
-#include "maliput/base/rule_filter.h"
-#include "maliput/common/logger.h"
 #include "maliput/common/maliput_abort.h"
 
 namespace maliput {
@@ -82,25 +83,42 @@ PhasedDiscreteRuleStateProvider::PhasedDiscreteRuleStateProvider(const api::rule
       phase_provider_(phase_provider) {
   MALIPUT_THROW_UNLESS(phase_ring_book_ != nullptr);
   MALIPUT_THROW_UNLESS(phase_provider_ != nullptr);
+  // All the phases of a ring govern the same rules. No rule has a state set
+  // yet, so these are the first rules in rule_ids().
+  for (const PhaseRing::Id& ring_id : phase_ring_book_->GetPhaseRings()) {
+    const std::optional<PhaseRing> ring = phase_ring_book_->GetPhaseRing(ring_id);
+    MALIPUT_THROW_UNLESS(ring.has_value());
+    std::vector<Rule::Id> ring_rule_ids;
+    for (const auto& rule_id_value : ring->phases().begin()->second.discrete_value_rule_states()) {
+      ring_rule_ids.push_back(rule_id_value.first);
+    }
+    std::sort(ring_rule_ids.begin(), ring_rule_ids.end(),
+              [](const Rule::Id& lhs, const Rule::Id& rhs) { return lhs.string() < rhs.string(); });
+    std::vector<std::size_t> rule_indices;
+    for (const Rule::Id& rule_id : ring_rule_ids) {
+      rule_indices.push_back(RegisterRule(rule_id));
+    }
+    phase_ring_rule_indices_.emplace_back(ring_id, std::move(rule_indices));
+  }
+  num_phase_ring_rules_ = rule_ids().size();
 }
 
 std::optional<DiscreteValueRuleStateProvider::StateResult> PhasedDiscreteRuleStateProvider::DoGetState(
     const Rule::Id& rule_id) const {
-  std::optional<PhaseRing> ring = phase_ring_book_->FindPhaseRing(rule_id);
-  if (ring.has_value()) {
+  std::optional<PhaseRing> ring_storage;
+  const PhaseRing* ring = phase_ring_book_->FindPhaseRingView(rule_id, &ring_storage);
+  if (ring != nullptr) {
     const std::optional<PhaseProvider::Result> phase_result = phase_provider_->GetPhase(ring->id());
     if (phase_result.has_value()) {
-      const Phase::Id phase_id = phase_result->state;
-      const Phase& phase = ring->phases().at(phase_id);
-      const DiscreteValueRule::DiscreteValue value = phase.discrete_value_rule_states().at(rule_id);
+      const Phase& phase = ring->phases().at(phase_result->state);
+      const DiscreteValueRule::DiscreteValue& value = phase.discrete_value_rule_states().at(rule_id);
       std::optional<DiscreteValueRuleStateProvider::StateResult::Next> next = std::nullopt;
       if (phase_result->next.has_value()) {
-        const Phase::Id next_phase_id = phase_result->next->state;
-        const Phase& next_phase = ring->phases().at(next_phase_id);
-        const DiscreteValueRule::DiscreteValue next_value = next_phase.discrete_value_rule_states().at(rule_id);
-        next = DiscreteValueRuleStateProvider::StateResult::Next{next_value, phase_result->next->duration_until};
+        const Phase& next_phase = ring->phases().at(phase_result->next->state);
+        next = DiscreteValueRuleStateProvider::StateResult::Next{next_phase.discrete_value_rule_states().at(rule_id),
+                                                                 phase_result->next->duration_until};
       }
-      return DiscreteValueRuleStateProvider::StateResult{value, next};
+      return DiscreteValueRuleStateProvider::StateResult{value, std::move(next)};
     }
   }
   return ManualDiscreteValueRuleStateProvider::DoGetState(rule_id);
@@ -108,23 +126,50 @@ std::optional<DiscreteValueRuleStateProvider::StateResult> PhasedDiscreteRuleSta
 
 std::optional<api::rules::DiscreteValueRuleStateProvider::StateResult> PhasedDiscreteRuleStateProvider::DoGetState(
     const api::RoadPosition& road_position, const api::rules::Rule::TypeId& rule_type, double tolerance) const {
-  const auto filtered_discrete_value_rules = GetFilteredDiscreteValueRules(road_position, rule_type, tolerance);
-  if (filtered_discrete_value_rules.empty()) {
+  const std::optional<Rule::Id> rule_id = rule_zone_index_.FindRule(road_position, rule_type, tolerance);
+  if (!rule_id.has_value()) {
     // Returns empty state result if no rule is found.
     return {};
   }
-  if (filtered_discrete_value_rules.size() > 1) {
-    maliput::log()->warn("For rule_type: ", rule_type.string(),
-                         " and road_position: [LaneId: ", road_position.lane->id(),
-                         ", LanePos: ", road_position.pos.srh().to_str(), "] there are more than one possible rules: ");
-    for (const auto& rule : filtered_discrete_value_rules) {
-      maliput::log()->warn("\tRule id: ", rule.first.string(), " matches with rule_type: ", rule_type.string(),
-                           " and road_position: [LaneId: ", road_position.lane->id(),
-                           ", LanePos: ", road_position.pos.srh().to_str(), "]");
+  // Once we have the rule id we can leverage DoGetState(const Rule::Id& rule_id) method.
+  return DoGetState(*rule_id);
+}
+
+void PhasedDiscreteRuleStateProvider::DoGetAllStates(
+    std::vector<std::optional<DiscreteValueRuleStateProvider::StateResult>>* states) const {
+  for (std::size_t i = num_phase_ring_rules_; i < states->size(); ++i) {
+    GetManualState(i, &(*states)[i]);
+  }
+  std::optional<PhaseRing> ring_storage;
+  for (const auto& ring_id_rule_indices : phase_ring_rule_indices_) {
+    const PhaseRing::Id& ring_id = ring_id_rule_indices.first;
+    const std::vector<std::size_t>& rule_indices = ring_id_rule_indices.second;
+    const PhaseRing* ring = phase_ring_book_->GetPhaseRingView(ring_id, &ring_storage);
+    const std::optional<PhaseProvider::Result> phase_result =
+        ring != nullptr ? phase_provider_->GetPhase(ring_id) : std::nullopt;
+    if (!phase_result.has_value()) {
+      // Nothing can be told about the rules based on the phase.
+      for (const std::size_t index : rule_indices) {
+        GetManualState(index, &(*states)[index]);
+      }
+      continue;
+    }
+    const Phase& phase = ring->phases().at(phase_result->state);
+    const Phase* next_phase = phase_result->next.has_value() ? &ring->phases().at(phase_result->next->state) : nullptr;
+    for (const std::size_t index : rule_indices) {
+      const Rule::Id& rule_id = rule_ids()[index];
+      const auto value_it = phase.discrete_value_rule_states().find(rule_id);
+      if (value_it == phase.discrete_value_rule_states().end()) {
+        // The ring was replaced in `phase_ring_book_` after construction and no longer governs the rule.
+        GetManualState(index, &(*states)[index]);
+        continue;
+      }
+      const DiscreteValueRule::DiscreteValue* next_value =
+          next_phase != nullptr ? &next_phase->discrete_value_rule_states().at(rule_id) : nullptr;
+      UpdateRuleState(value_it->second, next_value,
+                      next_phase != nullptr ? phase_result->next->duration_until : std::nullopt, &(*states)[index]);
     }
   }
-  // Once we have the rule id we can leverage DoGetState(const Rule::Id& rule_id) method.
-  return DoGetState(filtered_discrete_value_rules.begin()->first);
 }
 
 }  // namespace maliput
@@ -0,0 +1,1070 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2023, Woven by Toyota. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "maliput/base/road_network_snapshot.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <map>
+#include <optional>
+#include <ostream>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "maliput/api/intersection.h"
+#include "maliput/api/intersection_book.h"
+#include "maliput/api/lane_data.h"
+#include "maliput/api/regions.h"
+#include "maliput/api/rules/phase.h"
+#include "maliput/api/rules/phase_ring.h"
+#include "maliput/api/rules/road_rulebook.h"
+#include "maliput/api/rules/rule_registry.h"
+#include "maliput/api/rules/traffic_lights.h"
+#include "maliput/base/intersection.h"
+#include "maliput/base/intersection_book.h"
+#include "maliput/base/manual_phase_provider.h"
+#include "maliput/base/manual_phase_ring_book.h"
+#include "maliput/base/manual_range_value_rule_state_provider.h"
+#include "maliput/base/manual_rulebook.h"
+#include "maliput/base/phase_based_right_of_way_rule_state_provider.h"
+#include "maliput/base/phased_discrete_rule_state_provider.h"
+#include "maliput/base/traffic_light_book.h"
+#include "maliput/common/mapped_file.h"
+#include "maliput/common/maliput_throw.h"
+#include "maliput/common/profiler.h"
+#include "maliput/math/quaternion.h"
+
+namespace maliput {
+
+using api::InertialPosition;
+using api::LaneId;
+using api::LaneSRange;
+using api::LaneSRoute;
+using api::Rotation;
+using api::SRange;
+using api::UniqueId;
+using api::rules::Bulb;
+using api::rules::BulbGroup;
+using api::rules::BulbState;
+using api::rules::DiscreteValueRule;
+using api::rules::Phase;
+using api::rules::PhaseRing;
+using api::rules::RangeValueRule;
+using api::rules::Rule;
+using api::rules::TrafficLight;
+
+namespace {
+
+// Identifies road network snapshot files.
+constexpr std::array<char, 8> kSnapshotMagic{'M', 'L', 'P', 'R', 'N', 'S', 'N', 'P'};
+// Must be increased whenever the snapshot layout changes.
+constexpr std::uint32_t kSnapshotVersion{1};
+// Detects snapshots written in a machine with a different byte order.
+constexpr std::uint32_t kSnapshotByteOrderMark{0x01020304};
+
+// Header of the snapshot file. It is followed by `num_sections` SectionEntry and then by the sections, each of them
+// padded to 8 bytes.
+struct SnapshotHeader {
+  std::array<char, 8> magic;
+  std::uint32_t version;
+  std::uint32_t byte_order_mark;
+  // Index of the id of the RoadGeometry in the string table.
+  std::uint32_t road_geometry_id;
+  std::uint32_t num_sections;
+};
+static_assert(std::is_trivially_copyable_v<SnapshotHeader>, "SnapshotHeader must be trivially copyable.");
+
+// Kinds of sections. Values are part of the file format.
+enum class SectionType : std::uint32_t {
+  // The number of strings, followed by their end offsets as std::uint32_t and by their characters.
+  kStrings = 0,
+  kRuleRegistry = 1,
+  kRulebook = 2,
+  kTrafficLights = 3,
+  kPhaseRings = 4,
+  kPhaseProvider = 5,
+  kIntersections = 6,
+  // Bytes produced by a RoadGeometrySerializer. Optional.
+  kRoadGeometry = 7,
+};
+
+// Locates a section within the snapshot file.
+struct SectionEntry {
+  std::uint32_t type;
+  std::uint32_t reserved;
+  std::uint64_t offset;
+  std::uint64_t size;
+};
+static_assert(std::is_trivially_copyable_v<SectionEntry>, "SectionEntry must be trivially copyable.");
+
+constexpr char kMalformedSnapshot[]{"RoadNetwork snapshot is malformed."};
+
+// @returns @p size rounded up to a multiple of 8.
+std::size_t Padded(std::size_t size) { return (size + 7) & ~std::size_t{7}; }
+
+// @returns The elements of @p map sorted by key, so snapshots of equal road networks are equal byte by byte.
+template <typename Map>
+std::vector<std::pair<typename Map::key_type, typename Map::mapped_type>> SortedById(const Map& map) {
+  std::vector<std::pair<typename Map::key_type, typename Map::mapped_type>> sorted(map.begin(), map.end());
+  std::sort(sorted.begin(), sorted.end(),
+            [](const auto& lhs, const auto& rhs) { return lhs.first.string() < rhs.first.string(); });
+  return sorted;
+}
+
+// Deduplicates the strings of a snapshot.
+class StringTableWriter {
+ public:
+  // @returns The index of @p string in the table.
+  std::uint32_t Add(const std::string& string) {
+    const auto it = indices_.find(string);
+    if (it != indices_.end()) return it->second;
+    MALIPUT_VALIDATE(strings_.size() < std::numeric_limits<std::uint32_t>::max(), "Too many strings in snapshot.");
+    const auto index = static_cast<std::uint32_t>(strings_.size());
+    strings_.push_back(string);
+    indices_.emplace(string, index);
+    return index;
+  }
+
+  // @returns The kStrings section.
+  std::string Serialize() const {
+    std::string section;
+    const auto append = [&section](std::uint32_t value) {
+      section.append(reinterpret_cast<const char*>(&value), sizeof(value));
+    };
+    append(static_cast<std::uint32_t>(strings_.size()));
+    std::size_t end{0};
+    for (const std::string& string : strings_) {
+      end += string.size();
+      MALIPUT_VALIDATE(end <= std::numeric_limits<std::uint32_t>::max(), "Too many characters in snapshot.");
+      append(static_cast<std::uint32_t>(end));
+    }
+    for (const std::string& string : strings_) {
+      section += string;
+    }
+    return section;
+  }
+
+ private:
+  std::vector<std::string> strings_;
+  std::unordered_map<std::string, std::uint32_t> indices_;
+};
+
+// Serializes the entities of a section. Values are written in the byte order of the host, strings are replaced by
+// their index in the string table.
+class SectionWriter {
+ public:
+  explicit SectionWriter(StringTableWriter* strings) : strings_(strings) {}
+
+  void WriteUint32(std::uint32_t value) { Write(value); }
+  void WriteInt32(std::int32_t value) { Write(value); }
+  void WriteDouble(double value) { Write(value); }
+  void WriteBool(bool value) { Write(static_cast<std::uint8_t>(value)); }
+  void WriteSize(std::size_t size) {
+    MALIPUT_VALIDATE(size <= std::numeric_limits<std::uint32_t>::max(), "Too many elements in snapshot.");
+    WriteUint32(static_cast<std::uint32_t>(size));
+  }
+  template <typename Enum>
+  void WriteEnum(Enum value) {
+    WriteUint32(static_cast<std::uint32_t>(value));
+  }
+  void WriteString(const std::string& string) { WriteUint32(strings_->Add(string)); }
+  void WriteOptionalDouble(const std::optional<double>& value) {
+    WriteBool(value.has_value());
+    if (value.has_value()) WriteDouble(*value);
+  }
+
+  const std::string& buffer() const { return buffer_; }
+
+ private:
+  template <typename T>
+  void Write(T value) {
+    buffer_.append(reinterpret_cast<const char*>(&value), sizeof(T));
+  }
+
+  StringTableWriter* strings_{};
+  std::string buffer_;
+};
+
+// Deserializes the entities of a section written by SectionWriter. Every read is bounds checked.
+class SectionReader {
+ public:
+  SectionReader(const char* data, std::size_t size, const std::vector<std::string_view>* strings)
+      : data_(data), size_(size), strings_(strings) {}
+
+  std::uint32_t ReadUint32() { return Read<std::uint32_t>(); }
+  std::int32_t ReadInt32() { return Read<std::int32_t>(); }
+  double ReadDouble() { return Read<double>(); }
+  bool ReadBool() {
+    const std::uint8_t value = Read<std::uint8_t>();
+    MALIPUT_VALIDATE(value <= 1, kMalformedSnapshot);
+    return value == 1;
+  }
+  // Every element takes at least @p min_element_size bytes, so sizes whose elements can't fit in the remaining bytes
+  // are rejected before anything is allocated for them.
+  std::size_t ReadSize(std::size_t min_element_size = 1) {
+    const std::size_t size = ReadUint32();
+    MALIPUT_VALIDATE(size <= (size_ - offset_) / min_element_size, kMalformedSnapshot);
+    return size;
+  }
+  template <typename Enum>
+  Enum ReadEnum(Enum last) {
+    const std::uint32_t value = ReadUint32();
+    MALIPUT_VALIDATE(value <= static_cast<std::uint32_t>(last), kMalformedSnapshot);
+    return static_cast<Enum>(value);
+  }
+  std::string ReadString() {
+    const std::uint32_t index = ReadUint32();
+    MALIPUT_VALIDATE(index < strings_->size(), kMalformedSnapshot);
+    return std::string((*strings_)[index]);
+  }
+  std::optional<double> ReadOptionalDouble() {
+    return ReadBool() ? std::make_optional(ReadDouble()) : std::nullopt;
+  }
+
+  // @throws maliput::common::assertion_error When there are bytes left.
+  void ExpectEnd() const { MALIPUT_VALIDATE(offset_ == size_, kMalformedSnapshot); }
+
+ private:
+  template <typename T>
+  T Read() {
+    MALIPUT_VALIDATE(sizeof(T) <= size_ - offset_, kMalformedSnapshot);
+    T value;
+    std::memcpy(&value, data_ + offset_, sizeof(T));
+    offset_ += sizeof(T);
+    return value;
+  }
+
+  const char* data_{};
+  std::size_t size_{};
+  std::size_t offset_{0};
+  const std::vector<std::string_view>* strings_{};
+};
+
+void WriteInertialPosition(const InertialPosition& position, SectionWriter* writer) {
+  writer->WriteDouble(position.x());
+  writer->WriteDouble(position.y());
+  writer->WriteDouble(position.z());
+}
+
+InertialPosition ReadInertialPosition(SectionReader* reader) {
+  const double x = reader->ReadDouble();
+  const double y = reader->ReadDouble();
+  const double z = reader->ReadDouble();
+  return InertialPosition(x, y, z);
+}
+
+void WriteVector3(const math::Vector3& vector, SectionWriter* writer) {
+  writer->WriteDouble(vector.x());
+  writer->WriteDouble(vector.y());
+  writer->WriteDouble(vector.z());
+}
+
+math::Vector3 ReadVector3(SectionReader* reader) {
+  const double x = reader->ReadDouble();
+  const double y = reader->ReadDouble();
+  const double z = reader->ReadDouble();
+  return math::Vector3(x, y, z);
+}
+
+void WriteRotation(const Rotation& rotation, SectionWriter* writer) {
+  writer->WriteDouble(rotation.quat().w());
+  writer->WriteDouble(rotation.quat().x());
+  writer->WriteDouble(rotation.quat().y());
+  writer->WriteDouble(rotation.quat().z());
+}
+
+Rotation ReadRotation(SectionReader* reader) {
+  const double w = reader->ReadDouble();
+  const double x = reader->ReadDouble();
+  const double y = reader->ReadDouble();
+  const double z = reader->ReadDouble();
+  return Rotation::FromQuat(math::Quaternion(w, x, y, z));
+}
+
+void WriteLaneSRange(const LaneSRange& range, SectionWriter* writer) {
+  writer->WriteString(range.lane_id().string());
+  writer->WriteDouble(range.s_range().s0());
+  writer->WriteDouble(range.s_range().s1());
+}
+
+// Serialized size of a LaneSRange: the string index of the lane id and the s range.
+constexpr std::size_t kLaneSRangeSize{sizeof(std::uint32_t) + 2 * sizeof(double)};
+
+LaneSRange ReadLaneSRange(SectionReader* reader) {
+  const LaneId lane_id(reader->ReadString());
+  const double s0 = reader->ReadDouble();
+  const double s1 = reader->ReadDouble();
+  return LaneSRange(lane_id, SRange(s0, s1));
+}
+
+void WriteLaneSRanges(const std::vector<LaneSRange>& ranges, SectionWriter* writer) {
+  writer->WriteSize(ranges.size());
+  for (const LaneSRange& range : ranges) {
+    WriteLaneSRange(range, writer);
+  }
+}
+
+std::vector<LaneSRange> ReadLaneSRanges(SectionReader* reader) {
+  std::vector<LaneSRange> ranges;
+  const std::size_t num_ranges = reader->ReadSize(kLaneSRangeSize);
+  ranges.reserve(num_ranges);
+  for (std::size_t i = 0; i < num_ranges; ++i) {
+    ranges.push_back(ReadLaneSRange(reader));
+  }
+  return ranges;
+}
+
+// Writes the severity, related rules and related unique ids of @p state.
+void WriteRuleState(const Rule::State& state, SectionWriter* writer) {
+  writer->WriteInt32(state.severity);
+  writer->WriteSize(state.related_rules.size());
+  for (const auto& related_rules : state.related_rules) {
+    writer->WriteString(related_rules.first);
+    writer->WriteSize(related_rules.second.size());
+    for (const Rule::Id& rule_id : related_rules.second) {
+      writer->WriteString(rule_id.string());
+    }
+  }
+  writer->WriteSize(state.related_unique_ids.size());
+  for (const auto& related_unique_ids : state.related_unique_ids) {
+    writer->WriteString(related_unique_ids.first);
+    writer->WriteSize(related_unique_ids.second.size());
+    for (const UniqueId& unique_id : related_unique_ids.second) {
+      writer->WriteString(unique_id.string());
+    }
+  }
+}
+
+// Minimum serialized size of a Rule::State: the severity and the sizes of its related rules and unique ids.
+constexpr std::size_t kMinRuleStateSize{3 * sizeof(std::uint32_t)};
+
+Rule::State ReadRuleState(SectionReader* reader) {
+  Rule::State state;
+  state.severity = reader->ReadInt32();
+  const std::size_t num_related_rules = reader->ReadSize();
+  for (std::size_t i = 0; i < num_related_rules; ++i) {
+    std::vector<Rule::Id>& rule_ids = state.related_rules[reader->ReadString()];
+    const std::size_t num_rule_ids = reader->ReadSize();
+    for (std::size_t j = 0; j < num_rule_ids; ++j) {
+      rule_ids.emplace_back(reader->ReadString());
+    }
+  }
+  const std::size_t num_related_unique_ids = reader->ReadSize();
+  for (std::size_t i = 0; i < num_related_unique_ids; ++i) {
+    std::vector<UniqueId>& unique_ids = state.related_unique_ids[reader->ReadString()];
+    const std::size_t num_unique_ids = reader->ReadSize();
+    for (std::size_t j = 0; j < num_unique_ids; ++j) {
+      unique_ids.emplace_back(reader->ReadString());
+    }
+  }
+  return state;
+}
+
+void WriteDiscreteValue(const DiscreteValueRule::DiscreteValue& value, SectionWriter* writer) {
+  WriteRuleState(value, writer);
+  writer->WriteString(value.value);
+}
+
+DiscreteValueRule::DiscreteValue ReadDiscreteValue(SectionReader* reader) {
+  const Rule::State state = ReadRuleState(reader);
+  return DiscreteValueRule::DiscreteValue(state.severity, state.related_rules, state.related_unique_ids,
+                                          reader->ReadString());
+}
+
+void WriteDiscreteValues(const std::vector<DiscreteValueRule::DiscreteValue>& values, SectionWriter* writer) {
+  writer->WriteSize(values.size());
+  for (const DiscreteValueRule::DiscreteValue& value : values) {
+    WriteDiscreteValue(value, writer);
+  }
+}
+
+std::vector<DiscreteValueRule::DiscreteValue> ReadDiscreteValues(SectionReader* reader) {
+  std::vector<DiscreteValueRule::DiscreteValue> values;
+  // Every value is a Rule::State followed by the string index of the value.
+  const std::size_t num_values = reader->ReadSize(kMinRuleStateSize + sizeof(std::uint32_t));
+  values.reserve(num_values);
+  for (std::size_t i = 0; i < num_values; ++i) {
+    values.push_back(ReadDiscreteValue(reader));
+  }
+  return values;
+}
+
+void WriteRanges(const std::vector<RangeValueRule::Range>& ranges, SectionWriter* writer) {
+  writer->WriteSize(ranges.size());
+  for (const RangeValueRule::Range& range : ranges) {
+    WriteRuleState(range, writer);
+    writer->WriteString(range.description);
+    writer->WriteDouble(range.min);
+    writer->WriteDouble(range.max);
+  }
+}
+
+std::vector<RangeValueRule::Range> ReadRanges(SectionReader* reader) {
+  std::vector<RangeValueRule::Range> ranges;
+  // Every range is a Rule::State followed by the string index of the description and the limits.
+  const std::size_t num_ranges = reader->ReadSize(kMinRuleStateSize + sizeof(std::uint32_t) + 2 * sizeof(double));
+  ranges.reserve(num_ranges);
+  for (std::size_t i = 0; i < num_ranges; ++i) {
+    const Rule::State state = ReadRuleState(reader);
+    const std::string description = reader->ReadString();
+    const double min = reader->ReadDouble();
+    const double max = reader->ReadDouble();
+    ranges.emplace_back(state.severity, state.related_rules, state.related_unique_ids, description, min, max);
+  }
+  return ranges;
+}
+
+void WriteRuleRegistry(const api::rules::RuleRegistry& rule_registry, SectionWriter* writer) {
+  writer->WriteSize(rule_registry.DiscreteValueRuleTypes().size());
+  for (const auto& rule_type : rule_registry.DiscreteValueRuleTypes()) {
+    writer->WriteString(rule_type.first.string());
+    WriteDiscreteValues(rule_type.second, writer);
+  }
+  writer->WriteSize(rule_registry.RangeValueRuleTypes().size());
+  for (const auto& rule_type : rule_registry.RangeValueRuleTypes()) {
+    writer->WriteString(rule_type.first.string());
+    WriteRanges(rule_type.second, writer);
+  }
+}
+
+std::unique_ptr<api::rules::RuleRegistry> ReadRuleRegistry(SectionReader* reader) {
+  auto rule_registry = std::make_unique<api::rules::RuleRegistry>();
+  const std::size_t num_discrete_value_rule_types = reader->ReadSize();
+  for (std::size_t i = 0; i < num_discrete_value_rule_types; ++i) {
+    const Rule::TypeId type_id(reader->ReadString());
+    rule_registry->RegisterDiscreteValueRule(type_id, ReadDiscreteValues(reader));
+  }
+  const std::size_t num_range_value_rule_types = reader->ReadSize();
+  for (std::size_t i = 0; i < num_range_value_rule_types; ++i) {
+    const Rule::TypeId type_id(reader->ReadString());
+    rule_registry->RegisterRangeValueRule(type_id, ReadRanges(reader));
+  }
+  return rule_registry;
+}
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+using api::rules::DirectionUsageRule;
+using api::rules::RightOfWayRule;
+using api::rules::SpeedLimitRule;
+
+void WriteRulebook(const api::rules::RoadRulebook& rulebook, SectionWriter* writer) {
+  const api::rules::RoadRulebook::QueryResults rules = rulebook.Rules();
+  writer->WriteSize(rules.discrete_value_rules.size());
+  for (const auto& rule : rules.discrete_value_rules) {
+    writer->WriteString(rule.first.string());
+    writer->WriteString(rule.second.type_id().string());
+    WriteLaneSRanges(rule.second.zone().ranges(), writer);
+    WriteDiscreteValues(rule.second.states(), writer);
+  }
+  writer->WriteSize(rules.range_value_rules.size());
+  for (const auto& rule : rules.range_value_rules) {
+    writer->WriteString(rule.first.string());
+    writer->WriteString(rule.second.type_id().string());
+    WriteLaneSRanges(rule.second.zone().ranges(), writer);
+    WriteRanges(rule.second.states(), writer);
+  }
+
+  writer->WriteSize(rules.right_of_way.size());
+  for (const auto& rule : rules.right_of_way) {
+    writer->WriteString(rule.first.string());
+    WriteLaneSRanges(rule.second.zone().ranges(), writer);
+    writer->WriteEnum(rule.second.zone_type());
+    const auto states = SortedById(rule.second.states());
+    writer->WriteSize(states.size());
+    for (const auto& state : states) {
+      writer->WriteString(state.first.string());
+      writer->WriteEnum(state.second.type());
+      writer->WriteSize(state.second.yield_to().size());
+      for (const RightOfWayRule::Id& yield_to : state.second.yield_to()) {
+        writer->WriteString(yield_to.string());
+      }
+    }
+    const auto related_bulb_groups = SortedById(rule.second.related_bulb_groups());
+    writer->WriteSize(related_bulb_groups.size());
+    for (const auto& traffic_light_bulb_groups : related_bulb_groups) {
+      writer->WriteString(traffic_light_bulb_groups.first.string());
+      writer->WriteSize(traffic_light_bulb_groups.second.size());
+      for (const BulbGroup::Id& bulb_group_id : traffic_light_bulb_groups.second) {
+        writer->WriteString(bulb_group_id.string());
+      }
+    }
+  }
+  writer->WriteSize(rules.speed_limit.size());
+  for (const auto& rule : rules.speed_limit) {
+    writer->WriteString(rule.first.string());
+    WriteLaneSRange(rule.second.zone(), writer);
+    writer->WriteEnum(rule.second.severity());
+    writer->WriteDouble(rule.second.min());
+    writer->WriteDouble(rule.second.max());
+  }
+  writer->WriteSize(rules.direction_usage.size());
+  for (const auto& rule : rules.direction_usage) {
+    writer->WriteString(rule.first.string());
+    WriteLaneSRange(rule.second.zone(), writer);
+    const auto states = SortedById(rule.second.states());
+    writer->WriteSize(states.size());
+    for (const auto& state : states) {
+      writer->WriteString(state.first.string());
+      writer->WriteEnum(state.second.type());
+      writer->WriteEnum(state.second.severity());
+    }
+  }
+}
+
+std::unique_ptr<ManualRulebook> ReadRulebook(SectionReader* reader) {
+  auto rulebook = std::make_unique<ManualRulebook>();
+  const std::size_t num_discrete_value_rules = reader->ReadSize();
+  for (std::size_t i = 0; i < num_discrete_value_rules; ++i) {
+    const Rule::Id id(reader->ReadString());
+    const Rule::TypeId type_id(reader->ReadString());
+    const LaneSRoute zone(ReadLaneSRanges(reader));
+    rulebook->AddRule(DiscreteValueRule(id, type_id, zone, ReadDiscreteValues(reader)));
+  }
+  const std::size_t num_range_value_rules = reader->ReadSize();
+  for (std::size_t i = 0; i < num_range_value_rules; ++i) {
+    const Rule::Id id(reader->ReadString());
+    const Rule::TypeId type_id(reader->ReadString());
+    const LaneSRoute zone(ReadLaneSRanges(reader));
+    rulebook->AddRule(RangeValueRule(id, type_id, zone, ReadRanges(reader)));
+  }
+
+  const std::size_t num_right_of_way_rules = reader->ReadSize();
+  for (std::size_t i = 0; i < num_right_of_way_rules; ++i) {
+    const RightOfWayRule::Id id(reader->ReadString());
+    const LaneSRoute zone(ReadLaneSRanges(reader));
+    const auto zone_type = reader->ReadEnum(RightOfWayRule::ZoneType::kStopAllowed);
+    std::vector<RightOfWayRule::State> states;
+    const std::size_t num_states = reader->ReadSize();
+    for (std::size_t j = 0; j < num_states; ++j) {
+      const RightOfWayRule::State::Id state_id(reader->ReadString());
+      const auto type = reader->ReadEnum(RightOfWayRule::State::Type::kStopThenGo);
+      RightOfWayRule::State::YieldGroup yield_to;
+      const std::size_t num_yield_to = reader->ReadSize();
+      for (std::size_t k = 0; k < num_yield_to; ++k) {
+        yield_to.emplace_back(reader->ReadString());
+      }
+      states.emplace_back(state_id, type, yield_to);
+    }
+    RightOfWayRule::RelatedBulbGroups related_bulb_groups;
+    const std::size_t num_traffic_lights = reader->ReadSize();
+    for (std::size_t j = 0; j < num_traffic_lights; ++j) {
+      std::vector<BulbGroup::Id>& bulb_group_ids = related_bulb_groups[TrafficLight::Id(reader->ReadString())];
+      const std::size_t num_bulb_groups = reader->ReadSize();
+      for (std::size_t k = 0; k < num_bulb_groups; ++k) {
+        bulb_group_ids.emplace_back(reader->ReadString());
+      }
+    }
+    rulebook->AddRule(RightOfWayRule(id, zone, zone_type, states, related_bulb_groups));
+  }
+  const std::size_t num_speed_limit_rules = reader->ReadSize();
+  for (std::size_t i = 0; i < num_speed_limit_rules; ++i) {
+    const SpeedLimitRule::Id id(reader->ReadString());
+    const LaneSRange zone = ReadLaneSRange(reader);
+    const auto severity = reader->ReadEnum(SpeedLimitRule::Severity::kAdvisory);
+    const double min = reader->ReadDouble();
+    const double max = reader->ReadDouble();
+    rulebook->AddRule(SpeedLimitRule(id, zone, severity, min, max));
+  }
+  const std::size_t num_direction_usage_rules = reader->ReadSize();
+  for (std::size_t i = 0; i < num_direction_usage_rules; ++i) {
+    const DirectionUsageRule::Id id(reader->ReadString());
+    const LaneSRange zone = ReadLaneSRange(reader);
+    std::vector<DirectionUsageRule::State> states;
+    const std::size_t num_states = reader->ReadSize();
+    for (std::size_t j = 0; j < num_states; ++j) {
+      const DirectionUsageRule::State::Id state_id(reader->ReadString());
+      const auto type = reader->ReadEnum(DirectionUsageRule::State::Type::kUndefined);
+      const auto severity = reader->ReadEnum(DirectionUsageRule::State::Severity::kPreferred);
+      states.emplace_back(state_id, type, severity);
+    }
+    rulebook->AddRule(DirectionUsageRule(id, zone, states));
+  }
+  return rulebook;
+}
+#pragma GCC diagnostic pop
+
+void WriteTrafficLights(const api::rules::TrafficLightBook& traffic_light_book, SectionWriter* writer) {
+  std::vector<const TrafficLight*> traffic_lights = traffic_light_book.TrafficLights();
+  std::sort(traffic_lights.begin(), traffic_lights.end(),
+            [](const TrafficLight* lhs, const TrafficLight* rhs) { return lhs->id().string() < rhs->id().string(); });
+  writer->WriteSize(traffic_lights.size());
+  for (const TrafficLight* traffic_light : traffic_lights) {
+    writer->WriteString(traffic_light->id().string());
+    WriteInertialPosition(traffic_light->position_road_network(), writer);
+    WriteRotation(traffic_light->orientation_road_network(), writer);
+    const std::vector<const BulbGroup*> bulb_groups = traffic_light->bulb_groups();
+    writer->WriteSize(bulb_groups.size());
+    for (const BulbGroup* bulb_group : bulb_groups) {
+      writer->WriteString(bulb_group->id().string());
+      WriteInertialPosition(bulb_group->position_traffic_light(), writer);
+      WriteRotation(bulb_group->orientation_traffic_light(), writer);
+      const std::vector<const Bulb*> bulbs = bulb_group->bulbs();
+      writer->WriteSize(bulbs.size());
+      for (const Bulb* bulb : bulbs) {
+        writer->WriteString(bulb->id().string());
+        WriteInertialPosition(bulb->position_bulb_group(), writer);
+        WriteRotation(bulb->orientation_bulb_group(), writer);
+        writer->WriteEnum(bulb->color());
+        writer->WriteEnum(bulb->type());
+        writer->WriteOptionalDouble(bulb->arrow_orientation_rad());
+        writer->WriteSize(bulb->states().size());
+        for (const BulbState state : bulb->states()) {
+          writer->WriteEnum(state);
+        }
+        WriteVector3(bulb->bounding_box().p_BMin, writer);
+        WriteVector3(bulb->bounding_box().p_BMax, writer);
+      }
+    }
+  }
+}
+
+std::unique_ptr<TrafficLightBook> ReadTrafficLights(SectionReader* reader) {
+  auto traffic_light_book = std::make_unique<TrafficLightBook>();
+  const std::size_t num_traffic_lights = reader->ReadSize();
+  for (std::size_t i = 0; i < num_traffic_lights; ++i) {
+    const TrafficLight::Id traffic_light_id(reader->ReadString());
+    const InertialPosition traffic_light_position = ReadInertialPosition(reader);
+    const Rotation traffic_light_orientation = ReadRotation(reader);
+    std::vector<std::unique_ptr<BulbGroup>> bulb_groups;
+    const std::size_t num_bulb_groups = reader->ReadSize();
+    for (std::size_t j = 0; j < num_bulb_groups; ++j) {
+      const BulbGroup::Id bulb_group_id(reader->ReadString());
+      const InertialPosition bulb_group_position = ReadInertialPosition(reader);
+      const Rotation bulb_group_orientation = ReadRotation(reader);
+      std::vector<std::unique_ptr<Bulb>> bulbs;
+      const std::size_t num_bulbs = reader->ReadSize();
+      for (std::size_t k = 0; k < num_bulbs; ++k) {
+        const Bulb::Id bulb_id(reader->ReadString());
+        const InertialPosition bulb_position = ReadInertialPosition(reader);
+        const Rotation bulb_orientation = ReadRotation(reader);
+        const auto color = reader->ReadEnum(api::rules::BulbColor::kGreen);
+        const auto type = reader->ReadEnum(api::rules::BulbType::kArrow);
+        const std::optional<double> arrow_orientation_rad = reader->ReadOptionalDouble();
+        std::vector<BulbState> states;
+        const std::size_t num_states = reader->ReadSize();
+        for (std::size_t l = 0; l < num_states; ++l) {
+          states.push_back(reader->ReadEnum(BulbState::kBlinking));
+        }
+        Bulb::BoundingBox bounding_box;
+        bounding_box.p_BMin = ReadVector3(reader);
+        bounding_box.p_BMax = ReadVector3(reader);
+        bulbs.push_back(std::make_unique<Bulb>(bulb_id, bulb_position, bulb_orientation, color, type,
+                                               arrow_orientation_rad, states, bounding_box));
+      }
+      bulb_groups.push_back(
+          std::make_unique<BulbGroup>(bulb_group_id, bulb_group_position, bulb_group_orientation, std::move(bulbs)));
+    }
+    traffic_light_book->AddTrafficLight(std::make_unique<TrafficLight>(
+        traffic_light_id, traffic_light_position, traffic_light_orientation, std::move(bulb_groups)));
+  }
+  return traffic_light_book;
+}
+
+// @returns The ids of the PhaseRings in @p phase_ring_book, sorted.
+std::vector<PhaseRing::Id> GetSortedPhaseRingIds(const api::rules::PhaseRingBook& phase_ring_book) {
+  std::vector<PhaseRing::Id> ids = phase_ring_book.GetPhaseRings();
+  std::sort(ids.begin(), ids.end(),
+            [](const PhaseRing::Id& lhs, const PhaseRing::Id& rhs) { return lhs.string() < rhs.string(); });
+  return ids;
+}
+
+void WritePhaseRings(const api::rules::PhaseRingBook& phase_ring_book, SectionWriter* writer) {
+  const std::vector<PhaseRing::Id> ring_ids = GetSortedPhaseRingIds(phase_ring_book);
+  writer->WriteSize(ring_ids.size());
+  for (const PhaseRing::Id& ring_id : ring_ids) {
+    const std::optional<PhaseRing> ring = phase_ring_book.GetPhaseRing(ring_id);
+    MALIPUT_THROW_UNLESS(ring.has_value());
+    writer->WriteString(ring_id.string());
+    const auto phases = SortedById(ring->phases());
+    writer->WriteSize(phases.size());
+    for (const auto& phase : phases) {
+      writer->WriteString(phase.first.string());
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+      const auto rule_states = SortedById(phase.second.rule_states());
+#pragma GCC diagnostic pop
+      writer->WriteSize(rule_states.size());
+      for (const auto& rule_state : rule_states) {
+        writer->WriteString(rule_state.first.string());
+        writer->WriteString(rule_state.second.string());
+      }
+      const auto discrete_value_rule_states = SortedById(phase.second.discrete_value_rule_states());
+      writer->WriteSize(discrete_value_rule_states.size());
+      for (const auto& rule_state : discrete_value_rule_states) {
+        writer->WriteString(rule_state.first.string());
+        WriteDiscreteValue(rule_state.second, writer);
+      }
+      writer->WriteBool(phase.second.bulb_states().has_value());
+      if (phase.second.bulb_states().has_value()) {
+        const auto bulb_states = SortedById(*phase.second.bulb_states());
+        writer->WriteSize(bulb_states.size());
+        for (const auto& bulb_state : bulb_states) {
+          writer->WriteString(bulb_state.first.traffic_light_id().string());
+          writer->WriteString(bulb_state.first.bulb_group_id().string());
+          writer->WriteString(bulb_state.first.bulb_id().string());
+          writer->WriteEnum(bulb_state.second);
+        }
+      }
+    }
+    const auto next_phases = SortedById(ring->next_phases());
+    writer->WriteSize(next_phases.size());
+    for (const auto& next_phase : next_phases) {
+      writer->WriteString(next_phase.first.string());
+      writer->WriteSize(next_phase.second.size());
+      for (const PhaseRing::NextPhase& next : next_phase.second) {
+        writer->WriteString(next.id.string());
+        writer->WriteOptionalDouble(next.duration_until);
+      }
+    }
+  }
+}
+
+std::unique_ptr<ManualPhaseRingBook> ReadPhaseRings(SectionReader* reader) {
+  auto phase_ring_book = std::make_unique<ManualPhaseRingBook>();
+  const std::size_t num_rings = reader->ReadSize();
+  for (std::size_t i = 0; i < num_rings; ++i) {
+    const PhaseRing::Id ring_id(reader->ReadString());
+    std::vector<Phase> phases;
+    const std::size_t num_phases = reader->ReadSize();
+    for (std::size_t j = 0; j < num_phases; ++j) {
+      const Phase::Id phase_id(reader->ReadString());
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+      api::rules::RuleStates rule_states;
+      const std::size_t num_rule_states = reader->ReadSize();
+      for (std::size_t k = 0; k < num_rule_states; ++k) {
+        const RightOfWayRule::Id rule_id(reader->ReadString());
+        rule_states.emplace(rule_id, RightOfWayRule::State::Id(reader->ReadString()));
+      }
+#pragma GCC diagnostic pop
+      api::rules::DiscreteValueRuleStates discrete_value_rule_states;
+      const std::size_t num_discrete_value_rule_states = reader->ReadSize();
+      for (std::size_t k = 0; k < num_discrete_value_rule_states; ++k) {
+        const Rule::Id rule_id(reader->ReadString());
+        discrete_value_rule_states.emplace(rule_id, ReadDiscreteValue(reader));
+      }
+      std::optional<api::rules::BulbStates> bulb_states;
+      if (reader->ReadBool()) {
+        bulb_states.emplace();
+        const std::size_t num_bulb_states = reader->ReadSize();
+        for (std::size_t k = 0; k < num_bulb_states; ++k) {
+          const TrafficLight::Id traffic_light_id(reader->ReadString());
+          const BulbGroup::Id bulb_group_id(reader->ReadString());
+          const Bulb::Id bulb_id(reader->ReadString());
+          bulb_states->emplace(api::rules::UniqueBulbId(traffic_light_id, bulb_group_id, bulb_id),
+                               reader->ReadEnum(BulbState::kBlinking));
+        }
+      }
+      phases.emplace_back(phase_id, rule_states, discrete_value_rule_states, bulb_states);
+    }
+    std::unordered_map<Phase::Id, std::vector<PhaseRing::NextPhase>> next_phases;
+    const std::size_t num_next_phases = reader->ReadSize();
+    for (std::size_t j = 0; j < num_next_phases; ++j) {
+      std::vector<PhaseRing::NextPhase>& next = next_phases[Phase::Id(reader->ReadString())];
+      const std::size_t num_next = reader->ReadSize();
+      for (std::size_t k = 0; k < num_next; ++k) {
+        const Phase::Id next_id(reader->ReadString());
+        next.push_back(PhaseRing::NextPhase{next_id, reader->ReadOptionalDouble()});
+      }
+    }
+    phase_ring_book->AddPhaseRing(PhaseRing(ring_id, phases, next_phases));
+  }
+  return phase_ring_book;
+}
+
+void WritePhaseProvider(const api::rules::PhaseRingBook& phase_ring_book, const api::rules::PhaseProvider& provider,
+                        SectionWriter* writer) {
+  std::vector<std::pair<PhaseRing::Id, api::rules::PhaseProvider::Result>> phases;
+  for (const PhaseRing::Id& ring_id : GetSortedPhaseRingIds(phase_ring_book)) {
+    const std::optional<api::rules::PhaseProvider::Result> result = provider.GetPhase(ring_id);
+    if (result.has_value()) {
+      phases.emplace_back(ring_id, *result);
+    }
+  }
+  writer->WriteSize(phases.size());
+  for (const auto& phase : phases) {
+    writer->WriteString(phase.first.string());
+    writer->WriteString(phase.second.state.string());
+    writer->WriteBool(phase.second.next.has_value());
+    if (phase.second.next.has_value()) {
+      writer->WriteString(phase.second.next->state.string());
+      writer->WriteOptionalDouble(phase.second.next->duration_until);
+    }
+  }
+}
+
+std::unique_ptr<ManualPhaseProvider> ReadPhaseProvider(SectionReader* reader) {
+  auto phase_provider = std::make_unique<ManualPhaseProvider>();
+  const std::size_t num_phases = reader->ReadSize();
+  for (std::size_t i = 0; i < num_phases; ++i) {
+    const PhaseRing::Id ring_id(reader->ReadString());
+    const Phase::Id phase_id(reader->ReadString());
+    std::optional<Phase::Id> next_phase_id;
+    std::optional<double> duration_until;
+    if (reader->ReadBool()) {
+      next_phase_id.emplace(reader->ReadString());
+      duration_until = reader->ReadOptionalDouble();
+    }
+    phase_provider->AddPhaseRing(ring_id, phase_id, next_phase_id, duration_until);
+  }
+  return phase_provider;
+}
+
+void WriteIntersections(api::IntersectionBook* intersection_book, SectionWriter* writer) {
+  std::vector<api::Intersection*> intersections = intersection_book->GetIntersections();
+  std::sort(intersections.begin(), intersections.end(), [](const api::Intersection* lhs, const api::Intersection* rhs) {
+    return lhs->id().string() < rhs->id().string();
+  });
+  writer->WriteSize(intersections.size());
+  for (const api::Intersection* intersection : intersections) {
+    writer->WriteString(intersection->id().string());
+    writer->WriteString(intersection->ring_id().string());
+    WriteLaneSRanges(intersection->region(), writer);
+  }
+}
+
+std::unique_ptr<IntersectionBook> ReadIntersections(const api::RoadGeometry* road_geometry,
+                                                    const api::rules::PhaseRingBook& phase_ring_book,
+                                                    ManualPhaseProvider* phase_provider, SectionReader* reader) {
+  auto intersection_book = std::make_unique<IntersectionBook>(road_geometry);
+  const std::size_t num_intersections = reader->ReadSize();
+  for (std::size_t i = 0; i < num_intersections; ++i) {
+    const api::Intersection::Id id(reader->ReadString());
+    const PhaseRing::Id ring_id(reader->ReadString());
+    const std::vector<LaneSRange> region = ReadLaneSRanges(reader);
+    const std::optional<PhaseRing> ring = phase_ring_book.GetPhaseRing(ring_id);
+    MALIPUT_VALIDATE(ring.has_value(), kMalformedSnapshot);
+    intersection_book->AddIntersection(std::make_unique<Intersection>(id, region, *ring, phase_provider));
+  }
+  return intersection_book;
+}
+
+// Validated view of the sections of a mapped snapshot file.
+class SnapshotReader {
+ public:
+  // @throws maliput::common::assertion_error When @p file is not a valid snapshot.
+  explicit SnapshotReader(const common::MappedFile& file) : file_(file) {
+    MALIPUT_VALIDATE(file.size() >= sizeof(SnapshotHeader), kMalformedSnapshot);
+    SnapshotHeader header;
+    std::memcpy(&header, file.data(), sizeof(SnapshotHeader));
+    MALIPUT_VALIDATE(header.magic == kSnapshotMagic, "File is not a RoadNetwork snapshot.");
+    MALIPUT_VALIDATE(header.version == kSnapshotVersion, "RoadNetwork snapshot version is not supported.");
+    MALIPUT_VALIDATE(header.byte_order_mark == kSnapshotByteOrderMark,
+                     "RoadNetwork snapshot was written with a different byte order.");
+    MALIPUT_VALIDATE(header.num_sections <= (file.size() - sizeof(SnapshotHeader)) / sizeof(SectionEntry),
+                     kMalformedSnapshot);
+    // Sections are padded, the last one ends at the end of the file.
+    std::size_t end = Padded(sizeof(SnapshotHeader) + header.num_sections * sizeof(SectionEntry));
+    for (std::uint32_t i = 0; i < header.num_sections; ++i) {
+      SectionEntry entry;
+      std::memcpy(&entry, file.data() + sizeof(SnapshotHeader) + i * sizeof(SectionEntry), sizeof(SectionEntry));
+      MALIPUT_VALIDATE(entry.offset <= file.size() && entry.size <= file.size() - entry.offset, kMalformedSnapshot);
+      end = std::max(end, static_cast<std::size_t>(entry.offset + Padded(entry.size)));
+      // Unknown sections are skipped.
+      sections_.emplace(static_cast<SectionType>(entry.type), entry);
+    }
+    MALIPUT_VALIDATE(end == file.size(), kMalformedSnapshot);
+    ReadStrings();
+    MALIPUT_VALIDATE(header.road_geometry_id < strings_.size(), kMalformedSnapshot);
+    road_geometry_id_ = std::string(strings_[header.road_geometry_id]);
+  }
+
+  const std::string& road_geometry_id() const { return road_geometry_id_; }
+
+  bool has_section(SectionType type) const { return sections_.find(type) != sections_.end(); }
+
+  // @throws maliput::common::assertion_error When there is no section of @p type.
+  SectionReader section(SectionType type) const {
+    const auto it = sections_.find(type);
+    MALIPUT_VALIDATE(it != sections_.end(), kMalformedSnapshot);
+    return SectionReader(file_.data() + it->second.offset, it->second.size, &strings_);
+  }
+
+  // @returns The pointer to and the size of the raw bytes of the section of @p type.
+  std::pair<const char*, std::size_t> raw_section(SectionType type) const {
+    const auto it = sections_.find(type);
+    MALIPUT_VALIDATE(it != sections_.end(), kMalformedSnapshot);
+    return {file_.data() + it->second.offset, it->second.size};
+  }
+
+ private:
+  // Builds views of the strings in the kStrings section, they point into the mapped file.
+  void ReadStrings() {
+    const auto [data, size] = raw_section(SectionType::kStrings);
+    SectionReader reader(data, size, &strings_);
+    const std::size_t num_strings = reader.ReadUint32();
+    MALIPUT_VALIDATE(num_strings <= (size - sizeof(std::uint32_t)) / sizeof(std::uint32_t), kMalformedSnapshot);
+    const char* characters = data + sizeof(std::uint32_t) * (num_strings + 1);
+    const std::size_t num_characters = size - sizeof(std::uint32_t) * (num_strings + 1);
+    strings_.reserve(num_strings);
+    std::size_t begin{0};
+    for (std::size_t i = 0; i < num_strings; ++i) {
+      const std::size_t end = reader.ReadUint32();
+      MALIPUT_VALIDATE(begin <= end && end <= num_characters, kMalformedSnapshot);
+      strings_.emplace_back(characters + begin, end - begin);
+      begin = end;
+    }
+  }
+
+  const common::MappedFile& file_;
+  std::map<SectionType, SectionEntry> sections_;
+  std::vector<std::string_view> strings_;
+  std::string road_geometry_id_;
+};
+
+// Restores the RoadNetwork in @p filename. When @p road_geometry is nullptr, the RoadGeometry is restored from the
+// snapshot with @p road_geometry_serializer.
+std::unique_ptr<api::RoadNetwork> LoadSnapshot(const std::string& filename,
+                                               std::unique_ptr<const api::RoadGeometry> road_geometry,
+                                               const RoadGeometrySerializer* road_geometry_serializer) {
+  MALIPUT_PROFILE_FUNC();
+  const common::MappedFile file(filename);
+  MALIPUT_VALIDATE(file.data() != nullptr, "RoadNetwork snapshot " + filename + " can't be read.");
+  const SnapshotReader snapshot(file);
+  if (road_geometry == nullptr) {
+    MALIPUT_VALIDATE(snapshot.has_section(SectionType::kRoadGeometry),
+                     "RoadNetwork snapshot " + filename + " doesn't hold a RoadGeometry.");
+    const auto [data, size] = snapshot.raw_section(SectionType::kRoadGeometry);
+    road_geometry = road_geometry_serializer->Deserialize(data, size);
+    MALIPUT_VALIDATE(road_geometry != nullptr, "RoadGeometry could not be restored from " + filename);
+  }
+  MALIPUT_VALIDATE(road_geometry->id().string() == snapshot.road_geometry_id(),
+                   "RoadGeometry " + road_geometry->id().string() + " doesn't match the RoadGeometry " +
+                       snapshot.road_geometry_id() + " of the snapshot.");
+
+  const auto read = [&snapshot](SectionType type, auto read_section) {
+    SectionReader reader = snapshot.section(type);
+    auto result = read_section(&reader);
+    reader.ExpectEnd();
+    return result;
+  };
+  auto rule_registry = read(SectionType::kRuleRegistry, ReadRuleRegistry);
+  auto rulebook = read(SectionType::kRulebook, ReadRulebook);
+  auto traffic_light_book = read(SectionType::kTrafficLights, ReadTrafficLights);
+  auto phase_ring_book = read(SectionType::kPhaseRings, ReadPhaseRings);
+  auto phase_provider = read(SectionType::kPhaseProvider, ReadPhaseProvider);
+  auto intersection_book = read(SectionType::kIntersections, [&](SectionReader* reader) {
+    return ReadIntersections(road_geometry.get(), *phase_ring_book, phase_provider.get(), reader);
+  });
+
+  auto discrete_value_rule_state_provider = PhasedDiscreteRuleStateProvider::GetDefaultPhasedDiscreteRuleStateProvider(
+      rulebook.get(), phase_ring_book.get(), phase_provider.get());
+  auto range_value_rule_state_provider =
+      ManualRangeValueRuleStateProvider::GetDefaultManualRangeValueRuleStateProvider(rulebook.get());
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+  auto right_of_way_rule_state_provider =
+      std::make_unique<PhaseBasedRightOfWayRuleStateProvider>(phase_ring_book.get(), phase_provider.get());
+  return std::make_unique<api::RoadNetwork>(
+      std::move(road_geometry), std::move(rulebook), std::move(traffic_light_book), std::move(intersection_book),
+      std::move(phase_ring_book), std::move(right_of_way_rule_state_provider), std::move(phase_provider),
+      std::move(rule_registry), std::move(discrete_value_rule_state_provider),
+      std::move(range_value_rule_state_provider));
+#pragma GCC diagnostic pop
+}
+
+}  // namespace
+
+void SaveRoadNetworkSnapshot(api::RoadNetwork* road_network, const std::string& filename,
+                             const RoadGeometrySerializer* road_geometry_serializer) {
+  MALIPUT_PROFILE_FUNC();
+  MALIPUT_THROW_UNLESS(road_network != nullptr);
+  StringTableWriter strings;
+  std::vector<std::pair<SectionType, std::string>> sections;
+  const auto write = [&strings, &sections](SectionType type, auto write_section) {
+    SectionWriter writer(&strings);
+    write_section(&writer);
+    sections.emplace_back(type, writer.buffer());
+  };
+  write(SectionType::kRuleRegistry,
+        [&](SectionWriter* writer) { WriteRuleRegistry(*road_network->rule_registry(), writer); });
+  write(SectionType::kRulebook, [&](SectionWriter* writer) { WriteRulebook(*road_network->rulebook(), writer); });
+  write(SectionType::kTrafficLights,
+        [&](SectionWriter* writer) { WriteTrafficLights(*road_network->traffic_light_book(), writer); });
+  write(SectionType::kPhaseRings,
+        [&](SectionWriter* writer) { WritePhaseRings(*road_network->phase_ring_book(), writer); });
+  write(SectionType::kPhaseProvider, [&](SectionWriter* writer) {
+    WritePhaseProvider(*road_network->phase_ring_book(), *road_network->phase_provider(), writer);
+  });
+  write(SectionType::kIntersections,
+        [&](SectionWriter* writer) { WriteIntersections(road_network->intersection_book(), writer); });
+  if (road_geometry_serializer != nullptr) {
+    sections.emplace_back(SectionType::kRoadGeometry,
+                          road_geometry_serializer->Serialize(*road_network->road_geometry()));
+  }
+
+  SnapshotHeader header{};
+  header.magic = kSnapshotMagic;
+  header.version = kSnapshotVersion;
+  header.byte_order_mark = kSnapshotByteOrderMark;
+  header.road_geometry_id = strings.Add(road_network->road_geometry()->id().string());
+  // The string table is complete once every other section was written.
+  sections.emplace_back(SectionType::kStrings, strings.Serialize());
+  header.num_sections = static_cast<std::uint32_t>(sections.size());
+
+  std::vector<SectionEntry> entries;
+  std::uint64_t offset = Padded(sizeof(SnapshotHeader) + sections.size() * sizeof(SectionEntry));
+  for (const auto& section : sections) {
+    entries.push_back(SectionEntry{static_cast<std::uint32_t>(section.first), 0, offset, section.second.size()});
+    offset += Padded(section.second.size());
+  }
+
+  // The snapshot is written to a temporary file and then renamed so readers never map a partially written file.
+  static constexpr std::array<char, 8> kZeros{};
+  const bool saved = common::WriteFileAtomically(filename, [&](std::ostream* os) {
+    os->write(reinterpret_cast<const char*>(&header), sizeof(SnapshotHeader));
+    os->write(reinterpret_cast<const char*>(entries.data()), entries.size() * sizeof(SectionEntry));
+    const std::size_t table_size = sizeof(SnapshotHeader) + entries.size() * sizeof(SectionEntry);
+    os->write(kZeros.data(), Padded(table_size) - table_size);
+    for (const auto& section : sections) {
+      os->write(section.second.data(), section.second.size());
+      os->write(kZeros.data(), Padded(section.second.size()) - section.second.size());
+    }
+  });
+  MALIPUT_VALIDATE(saved, "RoadNetwork snapshot could not be saved to " + filename);
+}
+
+std::unique_ptr<api::RoadNetwork> LoadRoadNetworkSnapshot(const std::string& filename,
+                                                          std::unique_ptr<const api::RoadGeometry> road_geometry) {
+  MALIPUT_THROW_UNLESS(road_geometry != nullptr);
+  return LoadSnapshot(filename, std::move(road_geometry), nullptr);
+}
+
+std::unique_ptr<api::RoadNetwork> LoadRoadNetworkSnapshot(const std::string& filename,
+                                                          const RoadGeometrySerializer& road_geometry_serializer) {
+  return LoadSnapshot(filename, nullptr, &road_geometry_serializer);
+}
+
+}  // namespace maliput
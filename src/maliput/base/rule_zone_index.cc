@@ -0,0 +1,176 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2023, Woven by Toyota. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "maliput/base/rule_zone_index.h"
+
+#include <algorithm>
+#include <map>
+#include <optional>
+
+#include "maliput/api/lane.h"
+#include "maliput/api/rules/discrete_value_rule.h"
+#include "maliput/api/rules/range_value_rule.h"
+#include "maliput/common/logger.h"
+#include "maliput/common/maliput_throw.h"
+
+namespace maliput {
+
+using api::rules::DiscreteValueRule;
+using api::rules::RangeValueRule;
+using api::rules::RoadRulebook;
+using api::rules::Rule;
+
+namespace {
+
+// Returns the `RuleT` rules in `rules`.
+const std::map<Rule::Id, DiscreteValueRule>& GetRules(const RoadRulebook::QueryResults& rules,
+                                                      const DiscreteValueRule*) {
+  return rules.discrete_value_rules;
+}
+
+const std::map<Rule::Id, RangeValueRule>& GetRules(const RoadRulebook::QueryResults& rules, const RangeValueRule*) {
+  return rules.range_value_rules;
+}
+
+}  // namespace
+
+template <typename RuleT>
+RuleZoneIndex<RuleT>::RuleZoneIndex(const RoadRulebook* rulebook) : rulebook_(rulebook) {
+  MALIPUT_THROW_UNLESS(rulebook_ != nullptr);
+  const std::optional<std::size_t> revision = rulebook_->revision();
+  // Rulebooks that don't track their revision are never indexed.
+  if (revision.has_value()) {
+    revision_ = *revision;
+    Build();
+  }
+}
+
+template <typename RuleT>
+std::optional<Rule::Id> RuleZoneIndex<RuleT>::FindRule(const api::RoadPosition& road_position,
+                                                       const Rule::TypeId& rule_type, double tolerance) const {
+  std::optional<Rule::Id> result;
+  bool is_ambiguous{false};
+  Visit(road_position, rule_type, tolerance, [&result, &is_ambiguous](const Rule::Id& id) {
+    if (!result.has_value()) {
+      result = id;
+    } else if (id != *result) {
+      is_ambiguous = true;
+      if (id.string() < result->string()) {
+        result = id;
+      }
+    }
+  });
+  if (is_ambiguous) {
+    maliput::log()->warn("For rule_type: ", rule_type.string(),
+                         " and road_position: [LaneId: ", road_position.lane->id(),
+                         ", LanePos: ", road_position.pos.srh().to_str(), "] there are more than one possible rules: ");
+    for (const Rule::Id& id : FindRules(road_position, rule_type, tolerance)) {
+      maliput::log()->warn("\tRule id: ", id.string(), " matches with rule_type: ", rule_type.string(),
+                           " and road_position: [LaneId: ", road_position.lane->id(),
+                           ", LanePos: ", road_position.pos.srh().to_str(), "]");
+    }
+  }
+  return result;
+}
+
+template <typename RuleT>
+std::vector<Rule::Id> RuleZoneIndex<RuleT>::FindRules(const api::RoadPosition& road_position,
+                                                      const Rule::TypeId& rule_type, double tolerance) const {
+  std::vector<Rule::Id> result;
+  Visit(road_position, rule_type, tolerance, [&result](const Rule::Id& id) { result.push_back(id); });
+  std::sort(result.begin(), result.end(),
+            [](const Rule::Id& lhs, const Rule::Id& rhs) { return lhs.string() < rhs.string(); });
+  result.erase(std::unique(result.begin(), result.end()), result.end());
+  return result;
+}
+
+template <typename RuleT>
+template <typename Visitor>
+void RuleZoneIndex<RuleT>::Visit(const api::RoadPosition& road_position, const Rule::TypeId& rule_type,
+                                 double tolerance, Visitor&& visitor) const {
+  MALIPUT_THROW_UNLESS(tolerance >= 0.);
+  const std::optional<std::size_t> revision = rulebook_->revision();
+  if (!revision.has_value()) {
+    // Matches the rules as the index does, without relying on how the rulebook implements FindRules().
+    const double s = road_position.pos.s();
+    const api::LaneSRoute route({api::LaneSRange(road_position.lane->id(), api::SRange(s, s))});
+    const RoadRulebook::QueryResults rules = rulebook_->Rules();
+    for (const auto& id_and_rule : GetRules(rules, static_cast<const RuleT*>(nullptr))) {
+      if (id_and_rule.second.type_id() == rule_type && id_and_rule.second.zone().Intersects(route, tolerance)) {
+        visitor(id_and_rule.first);
+      }
+    }
+    return;
+  }
+  RebuildIfNeeded(*revision);
+  const auto lane_it = index_.find(road_position.lane->id());
+  if (lane_it == index_.end()) return;
+  const auto type_it = lane_it->second.find(rule_type);
+  if (type_it == lane_it->second.end()) return;
+  const double s = road_position.pos.s();
+  const api::SRange s_range(s, s);
+  type_it->second.Visit(s - tolerance, s + tolerance, [&](const typename Intervals::Interval& interval) {
+    // Candidates are confirmed with SRange::Intersects(), as api::LaneSRoute::Intersects() does.
+    if (interval.value.s_range.Intersects(s_range, tolerance)) {
+      visitor(interval.value.id);
+    }
+  });
+}
+
+template <typename RuleT>
+void RuleZoneIndex<RuleT>::RebuildIfNeeded(std::size_t revision) const {
+  if (revision_.load(std::memory_order_acquire) == revision) return;
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (revision_.load(std::memory_order_relaxed) == revision) return;
+  Build();
+  revision_.store(revision, std::memory_order_release);
+}
+
+template <typename RuleT>
+void RuleZoneIndex<RuleT>::Build() const {
+  index_.clear();
+  const RoadRulebook::QueryResults rules = rulebook_->Rules();
+  for (const auto& id_and_rule : GetRules(rules, static_cast<const RuleT*>(nullptr))) {
+    for (const api::LaneSRange& range : id_and_rule.second.zone().ranges()) {
+      const api::SRange& s_range = range.s_range();
+      index_[range.lane_id()][id_and_rule.second.type_id()].Insert(std::min(s_range.s0(), s_range.s1()),
+                                                                   std::max(s_range.s0(), s_range.s1()),
+                                                                   Entry{id_and_rule.first, s_range});
+    }
+  }
+  for (auto& lane_and_types : index_) {
+    for (auto& type_and_intervals : lane_and_types.second) {
+      type_and_intervals.second.Build();
+    }
+  }
+}
+
+template class RuleZoneIndex<DiscreteValueRule>;
+template class RuleZoneIndex<RangeValueRule>;
+
+}  // namespace maliput
@@ -0,0 +1,482 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2023, Woven by Toyota. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "maliput/common/builtin_profiler.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#include <x86intrin.h>
+#define MALIPUT_BUILTIN_PROFILER_USE_TSC 1
+#else
+#define MALIPUT_BUILTIN_PROFILER_USE_TSC 0
+#endif
+
+#include "maliput/common/maliput_never_destroyed.h"
+
+namespace maliput {
+namespace common {
+namespace profiler {
+namespace internal {
+
+std::atomic<bool> enabled{false};
+
+}  // namespace internal
+namespace {
+
+// Reads the time stamp counter, or the steady clock in nanoseconds when the
+// former is unavailable.
+inline uint64_t ReadTicks() {
+#if MALIPUT_BUILTIN_PROFILER_USE_TSC
+  return __rdtsc();
+#else
+  return static_cast<uint64_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+          .count());
+#endif
+}
+
+// Relates ticks to nanoseconds.
+struct Clock {
+  uint64_t origin_ticks{0};
+  double ns_per_tick{1.};
+};
+
+// Measures the tick rate against the steady clock. It spins for about a
+// millisecond when the time stamp counter is used.
+Clock Calibrate() {
+  Clock clock;
+#if MALIPUT_BUILTIN_PROFILER_USE_TSC
+  const auto start = std::chrono::steady_clock::now();
+  const uint64_t start_ticks = ReadTicks();
+  std::chrono::steady_clock::time_point end;
+  do {
+    end = std::chrono::steady_clock::now();
+  } while (end - start < std::chrono::milliseconds(1));
+  const uint64_t end_ticks = ReadTicks();
+  const double elapsed_ns = std::chrono::duration<double, std::nano>(end - start).count();
+  clock.ns_per_tick = elapsed_ns / static_cast<double>(std::max<uint64_t>(end_ticks - start_ticks, 1));
+#endif
+  clock.origin_ticks = ReadTicks();
+  return clock;
+}
+
+// Incremented by Reset(). Each thread discards its statistics when it sees a
+// new generation, see ThreadState::ApplyReset().
+std::atomic<uint64_t> reset_generation{0};
+
+std::once_flag calibration_flag;
+std::atomic<double> ns_per_tick{1.};
+std::atomic<uint64_t> origin_ticks{0};
+
+void CalibrateOnce() {
+  std::call_once(calibration_flag, []() {
+    const Clock clock = Calibrate();
+    ns_per_tick.store(clock.ns_per_tick, std::memory_order_relaxed);
+    origin_ticks.store(clock.origin_ticks, std::memory_order_relaxed);
+  });
+}
+
+// A buffered event. Begin events carry the scope name, end events a nullptr.
+struct Event {
+  std::atomic<const char*> name{nullptr};
+  std::atomic<uint64_t> ticks{0};
+};
+
+// Statistics of a scope name. Only the owner thread writes them, including
+// when they are reset.
+struct ScopeSlot {
+  std::atomic<const char*> name{nullptr};
+  std::atomic<int64_t> calls{0};
+  std::atomic<double> total_ns{0.};
+  std::atomic<double> max_ns{0.};
+  std::array<std::atomic<int64_t>, kNumHistogramBuckets> histogram{};
+};
+
+// The recording state of a thread. The owner thread is its only writer, so
+// it uses relaxed stores of atomics which readers may load at any time.
+struct ThreadState {
+  // Adds @p event to the ring buffer.
+  void Push(const char* name, uint64_t ticks) {
+    const uint64_t index = head.load(std::memory_order_relaxed);
+    Event& event = events[index % kEventBufferSize];
+    event.name.store(name, std::memory_order_relaxed);
+    event.ticks.store(ticks, std::memory_order_relaxed);
+    head.store(index + 1, std::memory_order_release);
+  }
+
+  // Finds or inserts the statistics of @p name. Returns nullptr when the
+  // table is full.
+  ScopeSlot* FindSlot(const char* name) {
+    const std::size_t hash = std::hash<const char*>{}(name);
+    for (std::size_t probe = 0; probe < kMaxScopeNames; ++probe) {
+      ScopeSlot& slot = slots[(hash + probe) % kMaxScopeNames];
+      const char* slot_name = slot.name.load(std::memory_order_relaxed);
+      if (slot_name == name) {
+        return &slot;
+      }
+      if (slot_name == nullptr) {
+        slot.name.store(name, std::memory_order_release);
+        return &slot;
+      }
+    }
+    return nullptr;
+  }
+
+  // Discards the statistics when Reset() was called since the last time.
+  void ApplyReset() {
+    const uint64_t current = reset_generation.load(std::memory_order_relaxed);
+    if (generation.load(std::memory_order_relaxed) == current) {
+      return;
+    }
+    for (ScopeSlot& slot : slots) {
+      slot.calls.store(0, std::memory_order_relaxed);
+      slot.total_ns.store(0., std::memory_order_relaxed);
+      slot.max_ns.store(0., std::memory_order_relaxed);
+      for (std::atomic<int64_t>& count : slot.histogram) {
+        count.store(0, std::memory_order_relaxed);
+      }
+    }
+    generation.store(current, std::memory_order_release);
+  }
+
+  // Accumulates a scope of @p duration_ns nanoseconds.
+  void Record(const char* name, double duration_ns) {
+    ApplyReset();
+    ScopeSlot* slot = FindSlot(name);
+    if (slot == nullptr) {
+      return;
+    }
+    slot->calls.store(slot->calls.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    slot->total_ns.store(slot->total_ns.load(std::memory_order_relaxed) + duration_ns, std::memory_order_relaxed);
+    if (duration_ns > slot->max_ns.load(std::memory_order_relaxed)) {
+      slot->max_ns.store(duration_ns, std::memory_order_relaxed);
+    }
+    const int exponent = duration_ns < 1. ? 0 : std::ilogb(duration_ns);
+    const std::size_t bucket = std::min(static_cast<std::size_t>(exponent), kNumHistogramBuckets - 1);
+    std::atomic<int64_t>& count = slot->histogram[bucket];
+    count.store(count.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+  }
+
+  // Number of events ever pushed.
+  std::atomic<uint64_t> head{0};
+  // Index of the first event to report.
+  std::atomic<uint64_t> first{0};
+  std::array<Event, kEventBufferSize> events{};
+  std::array<ScopeSlot, kMaxScopeNames> slots{};
+  // The reset_generation the statistics belong to. Statistics of an older
+  // generation are stale and readers ignore them.
+  std::atomic<uint64_t> generation{0};
+
+  // Open scopes; only accessed by the owner thread.
+  struct OpenScope {
+    const char* name;
+    uint64_t ticks;
+  };
+  std::array<OpenScope, kMaxScopeDepth> stack{};
+  std::size_t depth{0};
+
+  // The following members are guarded by Registry::mutex.
+  int tid{0};
+  std::string thread_name;
+  bool in_use{false};
+};
+
+// Owns the states of all threads. States are never freed: the state of an
+// exited thread keeps its statistics and is handed to the next new thread.
+struct Registry {
+  ThreadState* Acquire() {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = std::find_if(states.begin(), states.end(), [](const auto& state) { return !state->in_use; });
+    ThreadState* state{};
+    if (it == states.end()) {
+      states.push_back(std::make_unique<ThreadState>());
+      state = states.back().get();
+    } else {
+      state = it->get();
+      state->first.store(state->head.load(std::memory_order_relaxed), std::memory_order_relaxed);
+      state->depth = 0;
+      state->thread_name.clear();
+    }
+    state->tid = next_tid++;
+    state->in_use = true;
+    return state;
+  }
+
+  void Release(ThreadState* state) {
+    std::lock_guard<std::mutex> lock(mutex);
+    state->in_use = false;
+  }
+
+  std::mutex mutex;
+  std::vector<std::unique_ptr<ThreadState>> states;
+  int next_tid{1};
+};
+
+Registry& GetRegistry() {
+  static never_destroyed<Registry> registry;
+  return registry.access();
+}
+
+// Binds a ThreadState to the calling thread for its lifetime.
+class ThreadHandle {
+ public:
+  ThreadHandle() : state_(GetRegistry().Acquire()) {}
+  ~ThreadHandle() { GetRegistry().Release(state_); }
+  ThreadState* state() const { return state_; }
+
+ private:
+  ThreadState* const state_;
+};
+
+ThreadState* GetThreadState() {
+  thread_local ThreadHandle handle;
+  return handle.state();
+}
+
+// Whether each open sample of a thread began a scope, see BeginSample().
+struct SampleStack {
+  std::array<bool, kMaxScopeDepth> began;
+  std::size_t depth;
+};
+
+// Constant initialized, so it does not allocate the ThreadState of threads that never record.
+thread_local SampleStack sample_stack{};
+
+// Writes @p text as a JSON string.
+void WriteJsonString(const std::string& text, std::ostream* os) {
+  *os << '"';
+  for (const char c : text) {
+    switch (c) {
+      case '"':
+        *os << "\\\"";
+        break;
+      case '\\':
+        *os << "\\\\";
+        break;
+      case '\n':
+        *os << "\\n";
+        break;
+      default:
+        if (static_cast<unsigned char>(c) >= 0x20) {
+          *os << c;
+        }
+    }
+  }
+  *os << '"';
+}
+
+}  // namespace
+
+void SetEnabled(bool enabled) {
+  if (enabled) {
+    CalibrateOnce();
+  }
+  internal::enabled.store(enabled, std::memory_order_relaxed);
+}
+
+void SetThreadName(const std::string& name) {
+  ThreadState* state = GetThreadState();
+  std::lock_guard<std::mutex> lock(GetRegistry().mutex);
+  state->thread_name = name;
+}
+
+bool Begin(const char* name) {
+  if (!IsEnabled()) {
+    return false;
+  }
+  ThreadState* state = GetThreadState();
+  const uint64_t ticks = ReadTicks();
+  if (state->depth < kMaxScopeDepth) {
+    state->stack[state->depth] = {name, ticks};
+  }
+  ++state->depth;
+  state->Push(name, ticks);
+  return true;
+}
+
+void End() {
+  ThreadState* state = GetThreadState();
+  if (state->depth == 0) {
+    return;
+  }
+  const uint64_t ticks = ReadTicks();
+  --state->depth;
+  state->Push(nullptr, ticks);
+  if (state->depth < kMaxScopeDepth) {
+    const ThreadState::OpenScope& scope = state->stack[state->depth];
+    state->Record(scope.name, static_cast<double>(ticks - scope.ticks) * ns_per_tick.load(std::memory_order_relaxed));
+  }
+}
+
+void BeginSample(const char* name) {
+  const bool began = Begin(name);
+  if (sample_stack.depth < kMaxScopeDepth) {
+    sample_stack.began[sample_stack.depth] = began;
+  }
+  ++sample_stack.depth;
+}
+
+void EndSample() {
+  if (sample_stack.depth == 0) {
+    return;
+  }
+  --sample_stack.depth;
+  // Samples nested deeper than the stack are assumed to have begun; End() ignores unbalanced calls.
+  if (sample_stack.depth >= kMaxScopeDepth || sample_stack.began[sample_stack.depth]) {
+    End();
+  }
+}
+
+std::vector<ScopeStatistics> GetStatistics() {
+  std::map<std::string, ScopeStatistics> merged;
+  Registry& registry = GetRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  const uint64_t current_generation = reset_generation.load(std::memory_order_relaxed);
+  for (const auto& state : registry.states) {
+    if (state->generation.load(std::memory_order_acquire) != current_generation) {
+      continue;
+    }
+    for (const ScopeSlot& slot : state->slots) {
+      const char* name = slot.name.load(std::memory_order_acquire);
+      if (name == nullptr) {
+        continue;
+      }
+      const int64_t calls = slot.calls.load(std::memory_order_relaxed);
+      if (calls == 0) {
+        continue;
+      }
+      ScopeStatistics& statistics = merged[name];
+      statistics.name = name;
+      statistics.calls += calls;
+      statistics.total_ns += slot.total_ns.load(std::memory_order_relaxed);
+      statistics.max_ns = std::max(statistics.max_ns, slot.max_ns.load(std::memory_order_relaxed));
+      for (std::size_t i = 0; i < kNumHistogramBuckets; ++i) {
+        statistics.histogram[i] += slot.histogram[i].load(std::memory_order_relaxed);
+      }
+    }
+  }
+  std::vector<ScopeStatistics> result;
+  result.reserve(merged.size());
+  for (auto& name_statistics : merged) {
+    result.push_back(std::move(name_statistics.second));
+  }
+  std::sort(result.begin(), result.end(),
+            [](const ScopeStatistics& lhs, const ScopeStatistics& rhs) { return lhs.total_ns > rhs.total_ns; });
+  return result;
+}
+
+void WriteChromeTrace(std::ostream& os) {
+  const double ns_per_tick_value = ns_per_tick.load(std::memory_order_relaxed);
+  const uint64_t origin = origin_ticks.load(std::memory_order_relaxed);
+  Registry& registry = GetRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  // Timestamps are written in fixed notation; the caller's flags are restored afterwards.
+  const std::ios_base::fmtflags flags = os.flags();
+  os.setf(std::ios_base::fixed, std::ios_base::floatfield);
+  os << "{\"traceEvents\":[";
+  bool first_event = true;
+  const auto separator = [&os, &first_event]() {
+    if (!first_event) {
+      os << ",";
+    }
+    first_event = false;
+    os << "\n";
+  };
+  for (const auto& state : registry.states) {
+    if (!state->thread_name.empty()) {
+      separator();
+      os << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << state->tid << ",\"args\":{\"name\":";
+      WriteJsonString(state->thread_name, &os);
+      os << "}}";
+    }
+    const uint64_t head = state->head.load(std::memory_order_acquire);
+    const uint64_t begin =
+        std::max(state->first.load(std::memory_order_relaxed), head > kEventBufferSize ? head - kEventBufferSize : 0);
+    struct Copy {
+      const char* name;
+      uint64_t ticks;
+    };
+    std::vector<Copy> copies;
+    copies.reserve(head - begin);
+    for (uint64_t i = begin; i < head; ++i) {
+      const Event& event = state->events[i % kEventBufferSize];
+      copies.push_back({event.name.load(std::memory_order_relaxed), event.ticks.load(std::memory_order_relaxed)});
+    }
+    // Events may have been overwritten by the owner thread while copying. Besides the published ones, the event
+    // at `new_head` may be being written, over the slot of the event at `new_head - kEventBufferSize`.
+    const uint64_t new_head = state->head.load(std::memory_order_acquire);
+    const uint64_t valid_begin = new_head >= kEventBufferSize ? new_head - kEventBufferSize + 1 : 0;
+    // End events whose begin event is no longer buffered are skipped.
+    std::size_t depth{0};
+    for (uint64_t i = std::max(begin, valid_begin); i < head; ++i) {
+      const Copy& copy = copies[i - begin];
+      if (copy.name == nullptr) {
+        if (depth == 0) {
+          continue;
+        }
+        --depth;
+      } else {
+        ++depth;
+      }
+      const double ts_us = static_cast<double>(static_cast<int64_t>(copy.ticks - origin)) * ns_per_tick_value * 1e-3;
+      separator();
+      if (copy.name != nullptr) {
+        os << "{\"name\":";
+        WriteJsonString(copy.name, &os);
+        os << ",\"ph\":\"B\"";
+      } else {
+        os << "{\"ph\":\"E\"";
+      }
+      os << ",\"pid\":1,\"tid\":" << state->tid << ",\"ts\":" << ts_us << "}";
+    }
+  }
+  os << "\n],\"displayTimeUnit\":\"ns\"}\n";
+  os.flags(flags);
+}
+
+void Reset() {
+  Registry& registry = GetRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  // The statistics are only written by their owner threads, which discard them the next time they record a scope.
+  // Until then, GetStatistics() ignores them.
+  reset_generation.fetch_add(1, std::memory_order_relaxed);
+  for (const auto& state : registry.states) {
+    state->first.store(state->head.load(std::memory_order_acquire), std::memory_order_relaxed);
+  }
+}
+
+}  // namespace profiler
+}  // namespace common
+}  // namespace maliput
@@ -0,0 +1,96 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2023, Woven by Toyota. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "maliput/common/mapped_file.h"
+
+#include <cstdio>
+#include <fstream>
+#include <vector>
+
+extern "C" {
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+}
+
+namespace maliput {
+namespace common {
+
+MappedFile::MappedFile(const std::string& path) {
+  const int fd = ::open(path.c_str(), O_RDONLY);
+  if (fd < 0) return;
+  struct stat file_stat {};
+  if (::fstat(fd, &file_stat) == 0 && file_stat.st_size > 0) {
+    void* data = ::mmap(nullptr, static_cast<std::size_t>(file_stat.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    if (data != MAP_FAILED) {
+      data_ = static_cast<const char*>(data);
+      size_ = static_cast<std::size_t>(file_stat.st_size);
+    }
+  }
+  ::close(fd);
+}
+
+MappedFile::~MappedFile() {
+  if (data_ != nullptr) {
+    ::munmap(const_cast<char*>(data_), size_);
+  }
+}
+
+bool WriteFileAtomically(const std::string& path, const std::function<void(std::ostream*)>& write) {
+  // mkstemp() replaces the trailing Xs in place and creates the file exclusively.
+  const std::string name_template = path + ".tmp.XXXXXX";
+  std::vector<char> temporary_path(name_template.begin(), name_template.end());
+  temporary_path.push_back('\0');
+  const int fd = ::mkstemp(temporary_path.data());
+  if (fd < 0) return false;
+  // mkstemp() creates the file only readable by its owner, while the file at `path` is meant to be shared.
+  const bool created = ::fchmod(fd, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH) == 0;
+  ::close(fd);
+  if (created) {
+    std::ofstream os(temporary_path.data(), std::ios::binary | std::ios::trunc);
+    if (os) {
+      try {
+        write(&os);
+      } catch (...) {
+        os.close();
+        std::remove(temporary_path.data());
+        throw;
+      }
+      os.close();
+      if (os && std::rename(temporary_path.data(), path.c_str()) == 0) {
+        return true;
+      }
+    }
+  }
+  std::remove(temporary_path.data());
+  return false;
+}
+
+}  // namespace common
+}  // namespace maliput
@@ -0,0 +1,173 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2023, Woven by Toyota. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "maliput/common/shared_string.h"
+
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+
+#include "maliput/common/maliput_hash.h"
+#include "maliput/common/maliput_never_destroyed.h"
+
+namespace maliput {
+namespace common {
+
+struct SharedString::Node {
+  Node(std::string string_in, std::size_t hash_in, bool interned_in)
+      : string(std::move(string_in)), hash(hash_in), interned(interned_in) {}
+
+  const std::string string;
+  const std::size_t hash{};
+  const bool interned{};
+  std::atomic<std::size_t> references{1};
+};
+
+namespace {
+
+// The table is split in shards, each one with its own mutex, so threads interning different strings rarely
+// contend.
+constexpr std::size_t kNumShards{16};
+
+template <typename Node>
+struct Shard {
+  std::mutex mutex;
+  // Keys view the strings of their values. The table holds no references: nodes remove themselves when they are
+  // released for the last time.
+  std::unordered_map<std::string_view, Node*> nodes;
+};
+
+template <typename Node>
+Shard<Node>& GetShard(std::size_t hash) {
+  static never_destroyed<std::array<Shard<Node>, kNumShards>> shards;
+  return shards.access()[hash % kNumShards];
+}
+
+const std::string& EmptyString() {
+  static const never_destroyed<std::string> empty;
+  return empty.access();
+}
+
+}  // namespace
+
+SharedString::SharedString(std::string string) {
+  const std::size_t hash = DefaultHash{}(string);
+  node_ = new Node(std::move(string), hash, false);
+}
+
+SharedString::SharedString(const SharedString& other) noexcept : node_(other.node_) {
+  if (node_ != nullptr) {
+    node_->references.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+SharedString& SharedString::operator=(const SharedString& other) noexcept {
+  if (node_ != other.node_) {
+    SharedString copy(other);
+    std::swap(node_, copy.node_);
+  }
+  return *this;
+}
+
+SharedString::SharedString(SharedString&& other) noexcept : node_(std::exchange(other.node_, nullptr)) {}
+
+SharedString& SharedString::operator=(SharedString&& other) noexcept {
+  if (this != &other) {
+    Release();
+    node_ = std::exchange(other.node_, nullptr);
+  }
+  return *this;
+}
+
+SharedString::~SharedString() { Release(); }
+
+SharedString SharedString::Intern(std::string string) {
+  const std::size_t hash = DefaultHash{}(string);
+  Shard<Node>& shard = GetShard<Node>(hash);
+  const std::lock_guard<std::mutex> lock(shard.mutex);
+  const auto it = shard.nodes.find(string);
+  if (it != shard.nodes.end()) {
+    // References of interned nodes only drop to zero under the lock, so the node is alive.
+    it->second->references.fetch_add(1, std::memory_order_relaxed);
+    return SharedString(it->second);
+  }
+  Node* node = new Node(std::move(string), hash, true);
+  shard.nodes.emplace(std::string_view(node->string), node);
+  return SharedString(node);
+}
+
+std::size_t SharedString::table_size() {
+  std::size_t size{0};
+  for (std::size_t i = 0; i < kNumShards; ++i) {
+    Shard<Node>& shard = GetShard<Node>(i);
+    const std::lock_guard<std::mutex> lock(shard.mutex);
+    size += shard.nodes.size();
+  }
+  return size;
+}
+
+const std::string& SharedString::string() const { return node_ == nullptr ? EmptyString() : node_->string; }
+
+std::size_t SharedString::hash() const {
+  static const std::size_t kEmptyHash = DefaultHash{}(std::string());
+  return node_ == nullptr ? kEmptyHash : node_->hash;
+}
+
+bool SharedString::is_interned() const { return node_ != nullptr && node_->interned; }
+
+void SharedString::Release() {
+  Node* node = std::exchange(node_, nullptr);
+  if (node == nullptr) return;
+  if (!node->interned) {
+    if (node->references.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      delete node;
+    }
+    return;
+  }
+  // Releasing a reference other than the last one doesn't need the lock. The last one is released under the lock,
+  // so Intern() can't find the node while it is being removed from the table.
+  std::size_t references = node->references.load(std::memory_order_relaxed);
+  while (references > 1) {
+    if (node->references.compare_exchange_weak(references, references - 1, std::memory_order_acq_rel,
+                                               std::memory_order_relaxed)) {
+      return;
+    }
+  }
+  Shard<Node>& shard = GetShard<Node>(node->hash);
+  const std::lock_guard<std::mutex> lock(shard.mutex);
+  if (node->references.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+    shard.nodes.erase(std::string_view(node->string));
+    delete node;
+  }
+}
+
+}  // namespace common
+}  // namespace maliput
@@ -48,6 +48,9 @@ maliput::api::RoadPositionResult BruteForceStrategy::DoToRoadPosition(
   if (hint.has_value()) {
     MALIPUT_THROW_UNLESS(hint->lane != nullptr);
     const maliput::api::LanePositionResult lane_pos = hint->lane->ToLanePosition(inertial_pos);
+    if (statistics_enabled()) {
+      RecordStatistics(HintedQueryStatistics(lane_pos));
+    }
     result = maliput::api::RoadPositionResult{
         {hint->lane, lane_pos.lane_position}, lane_pos.nearest_position, lane_pos.distance};
   } else {
@@ -83,6 +86,7 @@ std::vector<maliput::api::RoadPositionResult> BruteForceStrategy::DoFindRoadPosi
   MALIPUT_THROW_UNLESS(radius >= 0.);
 
   std::vector<maliput::api::RoadPositionResult> road_position_results;
+  int64_t num_lanes{0};
 
   for (int i = 0; i < rg->num_junctions(); ++i) {
     const maliput::api::Junction* junction = rg->junction(i);
@@ -95,6 +99,7 @@ std::vector<maliput::api::RoadPositionResult> BruteForceStrategy::DoFindRoadPosi
         MALIPUT_THROW_UNLESS(lane != nullptr);
         maliput::api::InertialPosition nearest_position;
         const maliput::api::LanePositionResult result = lane->ToLanePosition(inertial_position);
+        ++num_lanes;
         if (radius == std::numeric_limits<double>::infinity() || result.distance <= radius) {
           road_position_results.push_back(
               {api::RoadPosition(lane, result.lane_position), result.nearest_position, result.distance});
@@ -102,6 +107,13 @@ std::vector<maliput::api::RoadPositionResult> BruteForceStrategy::DoFindRoadPosi
       }
     }
   }
+  if (statistics_enabled()) {
+    // Every lane is a candidate.
+    StrategyStatistics statistics;
+    statistics.num_candidate_lanes = num_lanes;
+    statistics.num_to_lane_position_calls = num_lanes;
+    RecordStatistics(statistics);
+  }
 
   return road_position_results;
 }
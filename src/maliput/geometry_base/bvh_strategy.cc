@@ -0,0 +1,206 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2023, Woven by Toyota. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "maliput/geometry_base/bvh_strategy.h"
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <queue>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+
+#include "lane_chunk_sampling.h"
+#include "maliput/common/maliput_throw.h"
+
+namespace maliput {
+namespace geometry_base {
+namespace {
+
+// An element of the best-first traversal queue: either a node or a primitive,
+// along with the distance from the query point to its volume.
+struct Candidate {
+  double distance{};
+  std::size_t index{};
+  bool is_primitive{};
+
+  bool operator>(const Candidate& other) const { return distance > other.distance; }
+};
+
+}  // namespace
+
+BVHStrategy::BVHStrategy(const api::RoadGeometry* rg, double chunk_length)
+    : StrategyBase(rg), chunk_length_(chunk_length) {
+  MALIPUT_THROW_UNLESS(chunk_length_ > 0.);
+  for (const api::Lane* lane : internal::GetLanes(get_road_geometry())) {
+    AddLanePrimitives(lane);
+  }
+  if (!primitives_.empty()) {
+    nodes_.reserve(2 * primitives_.size());
+    BuildNode(0, primitives_.size());
+  }
+}
+
+void BVHStrategy::AddLanePrimitives(const api::Lane* lane) {
+  internal::VisitLaneChunkBoxes(lane, chunk_length_, get_road_geometry()->linear_tolerance(),
+                                [this, lane](const math::AxisAlignedBox& box) { primitives_.push_back({box, lane}); });
+}
+
+std::size_t BVHStrategy::BuildNode(std::size_t begin, std::size_t end) {
+  math::AxisAlignedBox box = primitives_[begin].box;
+  for (std::size_t i = begin + 1; i < end; ++i) {
+    box = box.GetUnion(primitives_[i].box);
+  }
+  const std::size_t node_index = nodes_.size();
+  nodes_.push_back(Node{box, std::nullopt, std::nullopt, begin, end});
+  if (end - begin <= kMaxPrimitivesPerLeaf) {
+    return node_index;
+  }
+  // Splits the primitives by the median of their centers along the largest dimension of the box.
+  const math::Vector3 extent = box.max_corner() - box.min_corner();
+  int axis = extent.x() >= extent.y() ? 0 : 1;
+  axis = extent[axis] >= extent.z() ? axis : 2;
+  const std::size_t middle = begin + (end - begin) / 2;
+  std::nth_element(primitives_.begin() + begin, primitives_.begin() + middle, primitives_.begin() + end,
+                   [axis](const Primitive& lhs, const Primitive& rhs) {
+                     return lhs.box.position()[axis] < rhs.box.position()[axis];
+                   });
+  // nodes_ may be reallocated while building the children, so it is indexed afterwards.
+  const std::size_t left = BuildNode(begin, middle);
+  const std::size_t right = BuildNode(middle, end);
+  nodes_[node_index].left = left;
+  nodes_[node_index].right = right;
+  return node_index;
+}
+
+api::RoadPositionResult BVHStrategy::DoToRoadPosition(const api::InertialPosition& inertial_position,
+                                                      const std::optional<api::RoadPosition>& hint) const {
+  if (hint.has_value()) {
+    return internal::ToRoadPositionOnHint(inertial_position, hint.value());
+  }
+  MALIPUT_VALIDATE(!nodes_.empty(), "The RoadGeometry has no lanes.");
+
+  const math::Vector3& xyz = inertial_position.xyz();
+  std::priority_queue<Candidate, std::vector<Candidate>, std::greater<Candidate>> queue;
+  queue.push({nodes_.front().box.Distance(xyz), 0, false});
+  std::unordered_set<const api::Lane*> evaluated_lanes;
+  std::optional<api::RoadPositionResult> result;
+  while (!queue.empty()) {
+    const Candidate candidate = queue.top();
+    queue.pop();
+    // The remaining volumes are farther than the current result.
+    if (result.has_value() && candidate.distance > result->distance + internal::kTieTolerance) {
+      break;
+    }
+    if (candidate.is_primitive) {
+      const api::Lane* lane = primitives_[candidate.index].lane;
+      if (!evaluated_lanes.insert(lane).second) {
+        continue;
+      }
+      const api::LanePositionResult lane_position = lane->ToLanePosition(inertial_position);
+      const api::RoadPositionResult road_position{
+          {lane, lane_position.lane_position}, lane_position.nearest_position, lane_position.distance};
+      if (!result.has_value() || IsNewRoadPositionResultCloser(road_position, result.value())) {
+        result = road_position;
+      }
+      continue;
+    }
+    const Node& node = nodes_[candidate.index];
+    if (node.left.has_value()) {
+      queue.push({nodes_[node.left.value()].box.Distance(xyz), node.left.value(), false});
+      queue.push({nodes_[node.right.value()].box.Distance(xyz), node.right.value(), false});
+    } else {
+      for (std::size_t i = node.begin; i < node.end; ++i) {
+        queue.push({primitives_[i].box.Distance(xyz), i, true});
+      }
+    }
+  }
+  MALIPUT_THROW_UNLESS(result.has_value());
+  return result.value();
+}
+
+std::vector<api::RoadPositionResult> BVHStrategy::DoFindRoadPositions(const api::InertialPosition& inertial_position,
+                                                                      double radius) const {
+  MALIPUT_THROW_UNLESS(radius >= 0.);
+  std::vector<api::RoadPositionResult> road_positions;
+  for (const api::Lane* lane : FindCandidateLanes(inertial_position.xyz(), radius)) {
+    const api::LanePositionResult lane_position = lane->ToLanePosition(inertial_position);
+    if (lane_position.distance <= radius) {
+      road_positions.push_back(
+          {{lane, lane_position.lane_position}, lane_position.nearest_position, lane_position.distance});
+    }
+  }
+  return road_positions;
+}
+
+std::vector<const api::Lane*> BVHStrategy::FindCandidateLanes(const math::Vector3& inertial_position,
+                                                              double radius) const {
+  // Holds the distinct lanes, in traversal order, along with the distance to their closest volume.
+  std::vector<std::pair<double, const api::Lane*>> candidates;
+  std::unordered_map<const api::Lane*, std::size_t> candidate_indices;
+  std::vector<std::size_t> stack;
+  if (!nodes_.empty()) {
+    stack.push_back(0);
+  }
+  while (!stack.empty()) {
+    const Node& node = nodes_[stack.back()];
+    stack.pop_back();
+    if (node.box.Distance(inertial_position) > radius) {
+      continue;
+    }
+    if (node.left.has_value()) {
+      stack.push_back(node.right.value());
+      stack.push_back(node.left.value());
+      continue;
+    }
+    for (std::size_t i = node.begin; i < node.end; ++i) {
+      const double distance = primitives_[i].box.Distance(inertial_position);
+      if (distance > radius) {
+        continue;
+      }
+      const auto it = candidate_indices.find(primitives_[i].lane);
+      if (it == candidate_indices.end()) {
+        candidate_indices.emplace(primitives_[i].lane, candidates.size());
+        candidates.emplace_back(distance, primitives_[i].lane);
+      } else {
+        candidates[it->second].first = std::min(candidates[it->second].first, distance);
+      }
+    }
+  }
+  std::stable_sort(candidates.begin(), candidates.end(),
+                   [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+  std::vector<const api::Lane*> lanes;
+  lanes.reserve(candidates.size());
+  std::transform(candidates.begin(), candidates.end(), std::back_inserter(lanes),
+                 [](const auto& candidate) { return candidate.second; });
+  return lanes;
+}
+
+}  // namespace geometry_base
+}  // namespace maliput
@@ -0,0 +1,149 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2023, Woven by Toyota. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "maliput/geometry_base/cached_lane.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "maliput/common/maliput_hash.h"
+#include "maliput/common/maliput_throw.h"
+#include "maliput/geometry_base/cached_road_geometry.h"
+
+namespace maliput {
+namespace geometry_base {
+namespace {
+
+// @returns @p lane.
+// @throws maliput::common::assertion_error When @p lane is nullptr.
+const api::Lane* ValidateLane(const api::Lane* lane) {
+  MALIPUT_THROW_UNLESS(lane != nullptr);
+  return lane;
+}
+
+}  // namespace
+
+template <std::size_t N>
+std::size_t CachedLane::KeyHash<N>::operator()(const std::array<int64_t, N>& key) const {
+  common::DefaultHasher hasher;
+  for (const int64_t value : key) {
+    common::hash_append(hasher, value);
+  }
+  return static_cast<std::size_t>(hasher);
+}
+
+CachedLane::CachedLane(const api::Lane* lane, double quantum, std::size_t capacity)
+    : CachedLane(lane, quantum, capacity, nullptr) {}
+
+CachedLane::CachedLane(const api::Lane* lane, double quantum, std::size_t capacity,
+                       const CachedRoadGeometry* road_geometry)
+    : lane_(ValidateLane(lane)),
+      road_geometry_(road_geometry),
+      quantum_(quantum),
+      length_(lane_->length()),
+      lane_bounds_(capacity),
+      segment_bounds_(capacity),
+      elevation_bounds_(capacity),
+      inertial_positions_(capacity) {
+  MALIPUT_THROW_UNLESS(quantum_ > 0.);
+}
+
+CachedLane::Statistics CachedLane::statistics() const {
+  return {lane_bounds_.statistics(), segment_bounds_.statistics(), elevation_bounds_.statistics(),
+          inertial_positions_.statistics()};
+}
+
+int64_t CachedLane::Quantize(double value) const { return std::llround(value / quantum_); }
+
+double CachedLane::QuantizedS(int64_t key) const { return std::clamp(key * quantum_, 0., length_); }
+
+const api::Segment* CachedLane::do_segment() const {
+  const api::Segment* segment = lane_->segment();
+  return road_geometry_ == nullptr ? segment : road_geometry_->GetCachedSegment(segment);
+}
+
+const api::Lane* CachedLane::do_to_left() const {
+  const api::Lane* lane = lane_->to_left();
+  return road_geometry_ == nullptr ? lane : road_geometry_->GetCachedLane(lane);
+}
+
+const api::Lane* CachedLane::do_to_right() const {
+  const api::Lane* lane = lane_->to_right();
+  return road_geometry_ == nullptr ? lane : road_geometry_->GetCachedLane(lane);
+}
+
+const api::BranchPoint* CachedLane::DoGetBranchPoint(const api::LaneEnd::Which which_end) const {
+  const api::BranchPoint* branch_point = lane_->GetBranchPoint(which_end);
+  return road_geometry_ == nullptr ? branch_point : road_geometry_->GetCachedBranchPoint(branch_point);
+}
+
+// The branch queries of a decorated lane are answered by its decorated BranchPoint, which holds the decorated
+// LaneEndSets.
+const api::LaneEndSet* CachedLane::DoGetConfluentBranches(const api::LaneEnd::Which which_end) const {
+  if (road_geometry_ == nullptr) return lane_->GetConfluentBranches(which_end);
+  const api::BranchPoint* branch_point = DoGetBranchPoint(which_end);
+  return branch_point == nullptr ? nullptr : branch_point->GetConfluentBranches({this, which_end});
+}
+
+const api::LaneEndSet* CachedLane::DoGetOngoingBranches(const api::LaneEnd::Which which_end) const {
+  if (road_geometry_ == nullptr) return lane_->GetOngoingBranches(which_end);
+  const api::BranchPoint* branch_point = DoGetBranchPoint(which_end);
+  return branch_point == nullptr ? nullptr : branch_point->GetOngoingBranches({this, which_end});
+}
+
+std::optional<api::LaneEnd> CachedLane::DoGetDefaultBranch(const api::LaneEnd::Which which_end) const {
+  if (road_geometry_ == nullptr) return lane_->GetDefaultBranch(which_end);
+  const api::BranchPoint* branch_point = DoGetBranchPoint(which_end);
+  return branch_point == nullptr ? std::nullopt : branch_point->GetDefaultBranch({this, which_end});
+}
+
+api::RBounds CachedLane::do_lane_bounds(double s) const {
+  const Key1 key = Quantize(s);
+  return lane_bounds_.GetOrCompute(key, [this, key]() { return lane_->lane_bounds(QuantizedS(key)); });
+}
+
+api::RBounds CachedLane::do_segment_bounds(double s) const {
+  const Key1 key = Quantize(s);
+  return segment_bounds_.GetOrCompute(key, [this, key]() { return lane_->segment_bounds(QuantizedS(key)); });
+}
+
+api::HBounds CachedLane::do_elevation_bounds(double s, double r) const {
+  const Key2 key{Quantize(s), Quantize(r)};
+  return elevation_bounds_.GetOrCompute(
+      key, [this, &key]() { return lane_->elevation_bounds(QuantizedS(key[0]), key[1] * quantum_); });
+}
+
+api::InertialPosition CachedLane::DoToInertialPosition(const api::LanePosition& lane_pos) const {
+  const Key3 key{Quantize(lane_pos.s()), Quantize(lane_pos.r()), Quantize(lane_pos.h())};
+  return inertial_positions_.GetOrCompute(key, [this, &key]() {
+    return lane_->ToInertialPosition({QuantizedS(key[0]), key[1] * quantum_, key[2] * quantum_});
+  });
+}
+
+}  // namespace geometry_base
+}  // namespace maliput
@@ -0,0 +1,309 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2023, Woven by Toyota. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "maliput/geometry_base/cached_road_geometry.h"
+
+#include <utility>
+
+#include "maliput/api/branch_point.h"
+#include "maliput/api/junction.h"
+#include "maliput/api/segment.h"
+#include "maliput/common/maliput_throw.h"
+
+namespace maliput {
+namespace geometry_base {
+namespace {
+
+// @returns The sum of @p a and @p b.
+CacheStatistics Add(const CacheStatistics& a, const CacheStatistics& b) {
+  return {a.hits + b.hits, a.misses + b.misses};
+}
+
+}  // namespace
+
+// Forwards to the IdIndex of the decorated api::RoadGeometry, returning CachedLanes.
+class CachedRoadGeometry::CachedJunction final : public api::Junction {
+ public:
+  MALIPUT_NO_COPY_NO_MOVE_NO_ASSIGN(CachedJunction);
+
+  CachedJunction(const api::Junction* junction, const CachedRoadGeometry* road_geometry)
+      : junction_(junction), road_geometry_(road_geometry) {}
+
+ private:
+  api::JunctionId do_id() const override { return junction_->id(); }
+  const api::RoadGeometry* do_road_geometry() const override { return road_geometry_; }
+  int do_num_segments() const override { return junction_->num_segments(); }
+  const api::Segment* do_segment(int index) const override {
+    return road_geometry_->GetCachedSegment(junction_->segment(index));
+  }
+
+  const api::Junction* junction_{};
+  const CachedRoadGeometry* road_geometry_{};
+};
+
+class CachedRoadGeometry::CachedSegment final : public api::Segment {
+ public:
+  MALIPUT_NO_COPY_NO_MOVE_NO_ASSIGN(CachedSegment);
+
+  CachedSegment(const api::Segment* segment, const CachedRoadGeometry* road_geometry)
+      : segment_(segment), road_geometry_(road_geometry) {}
+
+ private:
+  api::SegmentId do_id() const override { return segment_->id(); }
+  const api::Junction* do_junction() const override { return road_geometry_->GetCachedJunction(segment_->junction()); }
+  int do_num_lanes() const override { return segment_->num_lanes(); }
+  const api::Lane* do_lane(int index) const override { return road_geometry_->GetCachedLane(segment_->lane(index)); }
+
+  const api::Segment* segment_{};
+  const CachedRoadGeometry* road_geometry_{};
+};
+
+// A copy of a LaneEndSet whose lanes are replaced by their CachedLanes.
+class CachedRoadGeometry::CachedLaneEndSet final : public api::LaneEndSet {
+ public:
+  MALIPUT_NO_COPY_NO_MOVE_NO_ASSIGN(CachedLaneEndSet);
+
+  CachedLaneEndSet(const api::LaneEndSet* lane_end_set, const CachedRoadGeometry* road_geometry) {
+    MALIPUT_THROW_UNLESS(lane_end_set != nullptr);
+    lane_ends_.reserve(lane_end_set->size());
+    for (int i = 0; i < lane_end_set->size(); ++i) {
+      const api::LaneEnd& lane_end = lane_end_set->get(i);
+      lane_ends_.emplace_back(road_geometry->GetCachedLane(lane_end.lane), lane_end.end);
+    }
+  }
+
+ private:
+  int do_size() const override { return static_cast<int>(lane_ends_.size()); }
+  const api::LaneEnd& do_get(int index) const override { return lane_ends_.at(index); }
+
+  std::vector<api::LaneEnd> lane_ends_;
+};
+
+// The sides are copied at construction. Branch queries select the side by looking the LaneEnd up in the A side of
+// the wrapped BranchPoint, so they don't rely on the wrapped BranchPoint returning its sides from them.
+class CachedRoadGeometry::CachedBranchPoint final : public api::BranchPoint {
+ public:
+  MALIPUT_NO_COPY_NO_MOVE_NO_ASSIGN(CachedBranchPoint);
+
+  CachedBranchPoint(const api::BranchPoint* branch_point, const CachedRoadGeometry* road_geometry)
+      : branch_point_(branch_point),
+        road_geometry_(road_geometry),
+        a_side_(branch_point->GetASide(), road_geometry),
+        b_side_(branch_point->GetBSide(), road_geometry) {}
+
+ private:
+  // @returns True when @p end, whose lane may be a CachedLane, is on the A side.
+  bool IsOnASide(const api::LaneEnd& end) const {
+    const api::Lane* lane = Unwrap(end.lane);
+    const api::LaneEndSet* a_side = branch_point_->GetASide();
+    for (int i = 0; i < a_side->size(); ++i) {
+      if (a_side->get(i).lane == lane && a_side->get(i).end == end.end) return true;
+    }
+    return false;
+  }
+
+  api::BranchPointId do_id() const override { return branch_point_->id(); }
+  const api::RoadGeometry* do_road_geometry() const override { return road_geometry_; }
+  const api::LaneEndSet* DoGetConfluentBranches(const api::LaneEnd& end) const override {
+    return IsOnASide(end) ? &a_side_ : &b_side_;
+  }
+  const api::LaneEndSet* DoGetOngoingBranches(const api::LaneEnd& end) const override {
+    return IsOnASide(end) ? &b_side_ : &a_side_;
+  }
+  std::optional<api::LaneEnd> DoGetDefaultBranch(const api::LaneEnd& end) const override {
+    std::optional<api::LaneEnd> default_branch = branch_point_->GetDefaultBranch({Unwrap(end.lane), end.end});
+    if (default_branch.has_value()) {
+      default_branch->lane = road_geometry_->GetCachedLane(default_branch->lane);
+    }
+    return default_branch;
+  }
+  const api::LaneEndSet* DoGetASide() const override { return &a_side_; }
+  const api::LaneEndSet* DoGetBSide() const override { return &b_side_; }
+
+  const api::BranchPoint* branch_point_{};
+  const CachedRoadGeometry* road_geometry_{};
+  const CachedLaneEndSet a_side_;
+  const CachedLaneEndSet b_side_;
+};
+
+class CachedRoadGeometry::CachedIdIndex final : public api::RoadGeometry::IdIndex {
+ public:
+  MALIPUT_NO_COPY_NO_MOVE_NO_ASSIGN(CachedIdIndex);
+
+  explicit CachedIdIndex(const CachedRoadGeometry* road_geometry)
+      : road_geometry_(road_geometry), id_index_(road_geometry->road_geometry()->ById()) {
+    for (const auto& [id, lane] : id_index_.GetLanes()) {
+      lanes_.emplace(id, road_geometry_->GetCachedLane(lane));
+    }
+  }
+
+ private:
+  const api::Lane* DoGetLane(const api::LaneId& id) const override {
+    const auto it = lanes_.find(id);
+    return it == lanes_.end() ? nullptr : it->second;
+  }
+  const std::unordered_map<api::LaneId, const api::Lane*>& DoGetLanes() const override { return lanes_; }
+  const api::Segment* DoGetSegment(const api::SegmentId& id) const override {
+    return road_geometry_->GetCachedSegment(id_index_.GetSegment(id));
+  }
+  const api::Junction* DoGetJunction(const api::JunctionId& id) const override {
+    return road_geometry_->GetCachedJunction(id_index_.GetJunction(id));
+  }
+  const api::BranchPoint* DoGetBranchPoint(const api::BranchPointId& id) const override {
+    return road_geometry_->GetCachedBranchPoint(id_index_.GetBranchPoint(id));
+  }
+  std::optional<uint32_t> DoGetLaneIndex(const api::LaneId& id) const override { return id_index_.GetLaneIndex(id); }
+  const api::Lane* DoGetLaneByIndex(uint32_t index) const override {
+    return road_geometry_->GetCachedLane(id_index_.GetLaneByIndex(index));
+  }
+  uint32_t do_num_lane_indices() const override { return id_index_.num_lane_indices(); }
+  std::optional<uint32_t> DoGetSegmentIndex(const api::SegmentId& id) const override {
+    return id_index_.GetSegmentIndex(id);
+  }
+  const api::Segment* DoGetSegmentByIndex(uint32_t index) const override {
+    return road_geometry_->GetCachedSegment(id_index_.GetSegmentByIndex(index));
+  }
+  uint32_t do_num_segment_indices() const override { return id_index_.num_segment_indices(); }
+  std::optional<uint32_t> DoGetJunctionIndex(const api::JunctionId& id) const override {
+    return id_index_.GetJunctionIndex(id);
+  }
+  const api::Junction* DoGetJunctionByIndex(uint32_t index) const override {
+    return road_geometry_->GetCachedJunction(id_index_.GetJunctionByIndex(index));
+  }
+  uint32_t do_num_junction_indices() const override { return id_index_.num_junction_indices(); }
+  std::optional<uint32_t> DoGetBranchPointIndex(const api::BranchPointId& id) const override {
+    return id_index_.GetBranchPointIndex(id);
+  }
+  const api::BranchPoint* DoGetBranchPointByIndex(uint32_t index) const override {
+    return road_geometry_->GetCachedBranchPoint(id_index_.GetBranchPointByIndex(index));
+  }
+  uint32_t do_num_branch_point_indices() const override { return id_index_.num_branch_point_indices(); }
+
+  const CachedRoadGeometry* road_geometry_{};
+  const api::RoadGeometry::IdIndex& id_index_;
+  std::unordered_map<api::LaneId, const api::Lane*> lanes_;
+};
+
+CachedRoadGeometry::CachedRoadGeometry(const api::RoadGeometry* road_geometry, double quantum, std::size_t capacity)
+    : road_geometry_(road_geometry) {
+  MALIPUT_THROW_UNLESS(road_geometry_ != nullptr);
+  // The decorators look each other up lazily, so they can be created in any order.
+  for (const auto& [id, lane] : road_geometry_->ById().GetLanes()) {
+    cached_lanes_.emplace(lane, std::unique_ptr<CachedLane>(new CachedLane(lane, quantum, capacity, this)));
+  }
+  for (int i = 0; i < road_geometry_->num_junctions(); ++i) {
+    const api::Junction* junction = road_geometry_->junction(i);
+    cached_junctions_.emplace(junction, std::make_unique<CachedJunction>(junction, this));
+    for (int j = 0; j < junction->num_segments(); ++j) {
+      const api::Segment* segment = junction->segment(j);
+      cached_segments_.emplace(segment, std::make_unique<CachedSegment>(segment, this));
+    }
+  }
+  for (int i = 0; i < road_geometry_->num_branch_points(); ++i) {
+    const api::BranchPoint* branch_point = road_geometry_->branch_point(i);
+    cached_branch_points_.emplace(branch_point, std::make_unique<CachedBranchPoint>(branch_point, this));
+  }
+  id_index_ = std::make_unique<CachedIdIndex>(this);
+}
+
+CachedRoadGeometry::~CachedRoadGeometry() = default;
+
+const CachedLane* CachedRoadGeometry::GetCachedLane(const api::Lane* lane) const {
+  const auto it = cached_lanes_.find(Unwrap(lane));
+  return it == cached_lanes_.end() ? nullptr : it->second.get();
+}
+
+const api::Junction* CachedRoadGeometry::GetCachedJunction(const api::Junction* junction) const {
+  const auto it = cached_junctions_.find(junction);
+  return it == cached_junctions_.end() ? nullptr : it->second.get();
+}
+
+const api::Segment* CachedRoadGeometry::GetCachedSegment(const api::Segment* segment) const {
+  const auto it = cached_segments_.find(segment);
+  return it == cached_segments_.end() ? nullptr : it->second.get();
+}
+
+const api::BranchPoint* CachedRoadGeometry::GetCachedBranchPoint(const api::BranchPoint* branch_point) const {
+  const auto it = cached_branch_points_.find(branch_point);
+  return it == cached_branch_points_.end() ? nullptr : it->second.get();
+}
+
+CachedLane::Statistics CachedRoadGeometry::statistics() const {
+  CachedLane::Statistics result;
+  for (const auto& [lane, cached_lane] : cached_lanes_) {
+    const CachedLane::Statistics statistics = cached_lane->statistics();
+    result.lane_bounds = Add(result.lane_bounds, statistics.lane_bounds);
+    result.segment_bounds = Add(result.segment_bounds, statistics.segment_bounds);
+    result.elevation_bounds = Add(result.elevation_bounds, statistics.elevation_bounds);
+    result.to_inertial_position = Add(result.to_inertial_position, statistics.to_inertial_position);
+  }
+  return result;
+}
+
+const api::Lane* CachedRoadGeometry::Unwrap(const api::Lane* lane) {
+  const auto cached_lane = dynamic_cast<const CachedLane*>(lane);
+  return cached_lane == nullptr ? lane : cached_lane->lane();
+}
+
+std::vector<api::RoadPositionResult> CachedRoadGeometry::Wrap(std::vector<api::RoadPositionResult> results) const {
+  for (api::RoadPositionResult& result : results) {
+    result.road_position.lane = GetCachedLane(result.road_position.lane);
+  }
+  return results;
+}
+
+const api::RoadGeometry::IdIndex& CachedRoadGeometry::DoById() const { return *id_index_; }
+
+api::RoadPositionResult CachedRoadGeometry::DoToRoadPosition(const api::InertialPosition& inertial_position,
+                                                             const std::optional<api::RoadPosition>& hint) const {
+  std::optional<api::RoadPosition> wrapped_hint = hint;
+  if (wrapped_hint.has_value()) {
+    wrapped_hint->lane = Unwrap(wrapped_hint->lane);
+  }
+  return Wrap({road_geometry_->ToRoadPosition(inertial_position, wrapped_hint)}).front();
+}
+
+std::vector<api::RoadPositionResult> CachedRoadGeometry::DoToRoadPositions(
+    const std::vector<api::InertialPosition>& inertial_positions,
+    const std::vector<std::optional<api::RoadPosition>>& hints, std::size_t num_threads) const {
+  std::vector<std::optional<api::RoadPosition>> wrapped_hints = hints;
+  for (std::optional<api::RoadPosition>& hint : wrapped_hints) {
+    if (hint.has_value()) {
+      hint->lane = Unwrap(hint->lane);
+    }
+  }
+  return Wrap(road_geometry_->ToRoadPositions(inertial_positions, wrapped_hints, num_threads));
+}
+
+std::vector<api::RoadPositionResult> CachedRoadGeometry::DoFindRoadPositions(
+    const api::InertialPosition& inertial_position, double radius) const {
+  return Wrap(road_geometry_->FindRoadPositions(inertial_position, radius));
+}
+
+}  // namespace geometry_base
+}  // namespace maliput
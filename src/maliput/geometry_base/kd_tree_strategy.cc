@@ -31,28 +31,358 @@
 #include "maliput/geometry_base/kd_tree_strategy.h"
 
 #include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
 #include <cstdlib>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <ostream>
+#include <type_traits>
 
+#include "maliput/common/logger.h"
+#include "maliput/common/maliput_copyable.h"
+#include "maliput/common/mapped_file.h"
+#include "maliput/common/parallel_for.h"
 #include "maliput/math/kd_tree.h"
 
 namespace maliput {
 namespace geometry_base {
 
-KDTreeStrategy::KDTreeStrategy(const api::RoadGeometry* rg, const double sampling_step)
+namespace {
+
+// Identifies KDTreeStrategy cache files.
+constexpr std::array<char, 8> kCacheMagic{'M', 'L', 'P', 'K', 'D', 'T', 'R', 'E'};
+// Must be increased whenever the cache layout or the sampling changes.
+constexpr std::uint32_t kCacheVersion{2};
+// Detects caches written in a machine with a different byte order.
+constexpr std::uint32_t kCacheByteOrderMark{0x01020304};
+
+// Header of the cache file. It is followed by these sections, each of them padded to 8 bytes:
+// - The road geometry id.
+// - The ids of the lanes, sorted and separated by '\0'.
+// - The x, y and z coordinates of the laid out kd-tree points, one array of doubles per coordinate.
+// - The index of the lane of each point, one std::uint32_t per point.
+struct CacheHeader {
+  std::array<char, 8> magic;
+  std::uint32_t version;
+  std::uint32_t byte_order_mark;
+  double sampling_step;
+  double max_elevation;
+  std::uint64_t content_hash;
+  std::uint64_t road_geometry_id_size;
+  std::uint64_t lane_ids_size;
+  std::uint64_t num_lanes;
+  std::uint64_t num_points;
+};
+static_assert(std::is_trivially_copyable_v<CacheHeader>, "CacheHeader must be trivially copyable.");
+
+// @returns @p size rounded up to a multiple of 8.
+std::size_t Padded(std::size_t size) { return (size + 7) & ~std::size_t{7}; }
+
+// @returns True when @p size is the size of a cache file described by @p header. Every section is checked against
+// @p size before adding it up, so corrupted headers can't overflow the computation.
+bool HasCacheSize(const CacheHeader& header, std::size_t size) {
+  static constexpr std::size_t kPointSize{3 * sizeof(double) + sizeof(std::uint32_t)};
+  if (header.road_geometry_id_size > size || header.lane_ids_size > size || header.num_points > size / kPointSize) {
+    return false;
+  }
+  return sizeof(CacheHeader) + Padded(header.road_geometry_id_size) + Padded(header.lane_ids_size) +
+             3 * header.num_points * sizeof(double) + Padded(header.num_points * sizeof(std::uint32_t)) ==
+         size;
+}
+
+// Writes @p size bytes of @p data to @p os followed by zeros up to the next multiple of 8 bytes.
+void WritePadded(std::ostream& os, const void* data, std::size_t size) {
+  static constexpr std::array<char, 8> kZeros{};
+  os.write(static_cast<const char*>(data), size);
+  os.write(kZeros.data(), Padded(size) - size);
+}
+
+// @returns The lanes of @p rg sorted by id, so the order is the same in every process.
+std::vector<const api::Lane*> GetSortedLanes(const api::RoadGeometry* rg) {
+  std::vector<const api::Lane*> lanes;
+  for (const auto& lane : rg->ById().GetLanes()) {
+    lanes.push_back(lane.second);
+  }
+  std::sort(lanes.begin(), lanes.end(),
+            [](const api::Lane* lhs, const api::Lane* rhs) { return lhs->id().string() < rhs->id().string(); });
+  return lanes;
+}
+
+// Computes a FNV-1a hash of the ids and lengths of @p lanes, and of their lane bounds and centerline positions every
+// @p sampling_step along s and at their end. These are the stations the index samples, so any change of the lane
+// bounds or the centerline that moves the samples is detected, at a fraction of the cost of sampling them.
+std::uint64_t ComputeContentHash(const std::vector<const api::Lane*>& lanes, double sampling_step) {
+  std::uint64_t hash{14695981039346656037ull};
+  const auto add = [&hash](const void* data, std::size_t size) {
+    const auto* bytes = static_cast<const unsigned char*>(data);
+    for (std::size_t i = 0; i < size; ++i) {
+      hash = (hash ^ bytes[i]) * 1099511628211ull;
+    }
+  };
+  const auto add_double = [&add](double value) { add(&value, sizeof(value)); };
+  for (const api::Lane* lane : lanes) {
+    const std::string id = lane->id().string();
+    add(id.data(), id.size() + 1 /* Includes the null terminator to separate ids. */);
+    const double length = lane->length();
+    add_double(length);
+    const auto add_station = [&add_double, lane](double s) {
+      const api::RBounds lane_bounds = lane->lane_bounds(s);
+      add_double(lane_bounds.min());
+      add_double(lane_bounds.max());
+      const math::Vector3 xyz = lane->ToInertialPosition({s, 0., 0.}).xyz();
+      add_double(xyz.x());
+      add_double(xyz.y());
+      add_double(xyz.z());
+    };
+    for (double s = 0.; s < length; s += sampling_step) {
+      add_station(s);
+    }
+    add_station(length);
+  }
+  return hash;
+}
+
+}  // namespace
+
+// Collects the distinct lanes of the samples reported by a kd-tree search, in the order they are first reported.
+// Lanes are deduplicated by MaliputPoint::lane_index(): a lane was already added when its stamp matches the epoch of
+// the search, so every reported sample costs O(1) and starting a search doesn't need to clear the stamps.
+// The storage is lent by the calling thread and reused by later searches, so they don't allocate once it has grown
+// enough. Every nested search on the thread, e.g. one issued from the api::Lane::ToLanePosition() of a candidate lane,
+// borrows its own storage.
+class KDTreeStrategy::CandidateLanes {
+ public:
+  MALIPUT_NO_COPY_NO_MOVE_NO_ASSIGN(CandidateLanes);
+
+  // @param num_lanes Bound of the lane indices of the samples to be added.
+  explicit CandidateLanes(std::size_t num_lanes) {
+    Pool& pool = GetPool();
+    if (pool.depth == pool.storages.size()) {
+      pool.storages.push_back(std::make_unique<Storage>());
+    }
+    storage_ = pool.storages[pool.depth++].get();
+    storage_->lanes.clear();
+    if (storage_->stamps.size() < num_lanes) {
+      storage_->stamps.resize(num_lanes, 0);
+    }
+    if (++storage_->epoch == 0) {
+      // The epoch wrapped around, so stamps of old searches could match it.
+      std::fill(storage_->stamps.begin(), storage_->stamps.end(), 0);
+      storage_->epoch = 1;
+    }
+  }
+
+  ~CandidateLanes() { --GetPool().depth; }
+
+  // Adds the lane of @p point unless it was already added.
+  void Add(const MaliputPoint& point) {
+    std::uint32_t& stamp = storage_->stamps[point.lane_index()];
+    if (stamp == storage_->epoch) return;
+    stamp = storage_->epoch;
+    storage_->lanes.push_back(point.get_lane().value());
+  }
+
+  // @returns True when the lane of @p point was added.
+  bool Contains(const MaliputPoint& point) const {
+    return storage_->stamps[point.lane_index()] == storage_->epoch;
+  }
+
+  // @returns The lanes added so far.
+  const std::vector<const api::Lane*>& lanes() const { return storage_->lanes; }
+
+ private:
+  struct Storage {
+    std::vector<const api::Lane*> lanes;
+    // Epoch of the last search that added each lane, indexed by lane index.
+    std::vector<std::uint32_t> stamps;
+    std::uint32_t epoch{0};
+  };
+
+  // Storages of the thread, indexed by search nesting depth. They are held by pointer so growing the pool doesn't move
+  // the storages lent to the enclosing searches.
+  struct Pool {
+    std::vector<std::unique_ptr<Storage>> storages;
+    std::size_t depth{0};
+  };
+
+  static Pool& GetPool() {
+    thread_local Pool pool;
+    return pool;
+  }
+
+  Storage* storage_{};
+};
+
+KDTreeStrategy::KDTreeStrategy(const api::RoadGeometry* rg, const double sampling_step, std::size_t num_threads)
+    : StrategyBase(rg), sampling_step_(sampling_step) {
+  MALIPUT_VALIDATE(num_threads > 0, "Number of threads must be greater than 0.");
+  BuildIndex(num_threads);
+}
+
+KDTreeStrategy::KDTreeStrategy(const api::RoadGeometry* rg, const double sampling_step, std::size_t num_threads,
+                               const std::string& cache_path)
     : StrategyBase(rg), sampling_step_(sampling_step) {
-  const auto lanes = get_road_geometry()->ById().GetLanes();
-  std::deque<MaliputPoint> points;
-  for (const auto& lane : lanes) {
-    const auto lane_length = lane.second->length();
-    for (double s = 0; s <= lane_length; s += sampling_step_) {
-      const auto lane_bounds = lane.second->lane_bounds(s);
-      for (double r = lane_bounds.min(); r <= lane_bounds.max(); r += sampling_step_) {
-        const auto inertial_pos = lane.second->ToInertialPosition({s, r, 0. /* h */}).xyz();
-        points.push_back(MaliputPoint{{inertial_pos.x(), inertial_pos.y(), inertial_pos.z()}, lane.second});
-      }
+  MALIPUT_VALIDATE(num_threads > 0, "Number of threads must be greater than 0.");
+  if (LoadIndex(cache_path)) {
+    maliput::log()->debug("KDTreeStrategy index loaded from ", cache_path);
+    return;
+  }
+  BuildIndex(num_threads);
+  if (!WriteIndex(cache_path)) {
+    maliput::log()->warn("KDTreeStrategy index could not be saved to ", cache_path);
+  }
+}
+
+void KDTreeStrategy::SaveIndex(const std::string& path) const {
+  MALIPUT_VALIDATE(WriteIndex(path), "KDTreeStrategy index could not be saved to " + path);
+}
+
+void KDTreeStrategy::BuildIndex(std::size_t num_threads) {
+  const std::vector<const api::Lane*> lanes = GetSortedLanes(get_road_geometry());
+  // Samples of each lane are stored separately and concatenated in lane order afterwards, which keeps the point
+  // cloud independent of the number of threads.
+  std::vector<std::vector<MaliputPoint>> lane_points(lanes.size());
+  std::vector<double> lane_max_elevations(lanes.size(), 0.);
+  common::ParallelFor(lanes.size(), num_threads, [&lane_points, &lane_max_elevations, &lanes, this](std::size_t i) {
+    lane_points[i] = SampleLane(lanes[i], static_cast<std::uint32_t>(i), sampling_step_, &lane_max_elevations[i]);
+  });
+
+  for (const double lane_max_elevation : lane_max_elevations) {
+    max_elevation_ = std::max(max_elevation_, lane_max_elevation);
+  }
+  std::size_t num_points = 0;
+  for (const auto& points : lane_points) {
+    num_points += points.size();
+  }
+  std::vector<MaliputPoint> points;
+  points.reserve(num_points);
+  for (auto& lane_samples : lane_points) {
+    std::move(lane_samples.begin(), lane_samples.end(), std::back_inserter(points));
+  }
+  kd_tree_ = std::make_unique<math::ImplicitKDTree3D<MaliputPoint>>(std::move(points), num_threads);
+  num_lanes_ = lanes.size();
+}
+
+bool KDTreeStrategy::LoadIndex(const std::string& path) {
+  auto mapped_file = std::make_unique<common::MappedFile>(path);
+  const common::MappedFile& file = *mapped_file;
+  if (file.data() == nullptr || file.size() < sizeof(CacheHeader)) return false;
+  CacheHeader header;
+  std::memcpy(&header, file.data(), sizeof(CacheHeader));
+  const std::string road_geometry_id = get_road_geometry()->id().string();
+  if (header.magic != kCacheMagic || header.version != kCacheVersion ||
+      header.byte_order_mark != kCacheByteOrderMark || header.sampling_step != sampling_step_ ||
+      header.road_geometry_id_size != road_geometry_id.size() || header.num_points == 0 ||
+      !HasCacheSize(header, file.size())) {
+    return false;
+  }
+  const char* cursor = file.data() + sizeof(CacheHeader);
+  if (road_geometry_id.compare(0, road_geometry_id.size(), cursor, header.road_geometry_id_size) != 0) return false;
+  cursor += Padded(header.road_geometry_id_size);
+
+  const std::vector<const api::Lane*> lanes = GetSortedLanes(get_road_geometry());
+  if (header.num_lanes != lanes.size() || header.content_hash != ComputeContentHash(lanes, sampling_step_)) {
+    return false;
+  }
+  // The content hash already covers the lane ids, they are verified anyway as they are cheap to compare.
+  std::size_t offset = 0;
+  for (const api::Lane* lane : lanes) {
+    const std::string id = lane->id().string();
+    if (offset + id.size() + 1 > header.lane_ids_size || id.compare(0, id.size(), cursor + offset, id.size()) != 0 ||
+        cursor[offset + id.size()] != '\0') {
+      return false;
+    }
+    offset += id.size() + 1;
+  }
+  if (offset != header.lane_ids_size) return false;
+  cursor += Padded(header.lane_ids_size);
+
+  // The mapping is page aligned and every section is padded to 8 bytes, so the arrays are suitably aligned.
+  const auto* x = reinterpret_cast<const double*>(cursor);
+  const double* y = x + header.num_points;
+  const double* z = y + header.num_points;
+  const auto* lane_indices = reinterpret_cast<const std::uint32_t*>(z + header.num_points);
+  // The points hold the lanes of this process, so they are the only part of the index built while loading. The
+  // kd-tree traversals read the coordinates from the mapped file.
+  std::vector<MaliputPoint> points;
+  points.reserve(header.num_points);
+  for (std::size_t i = 0; i < header.num_points; ++i) {
+    if (lane_indices[i] >= lanes.size()) return false;
+    points.emplace_back(math::Vector3{x[i], y[i], z[i]}, lanes[lane_indices[i]], lane_indices[i]);
+  }
+  kd_tree_ = std::make_unique<math::ImplicitKDTree3D<MaliputPoint>>(
+      std::move(points), std::array<const double*, 3>{x, y, z}, math::ImplicitKDTree3D<MaliputPoint>::LaidOut{});
+  index_file_ = std::move(mapped_file);
+  max_elevation_ = header.max_elevation;
+  num_lanes_ = lanes.size();
+  return true;
+}
+
+bool KDTreeStrategy::WriteIndex(const std::string& path) const {
+  const std::vector<const api::Lane*> lanes = GetSortedLanes(get_road_geometry());
+  std::string lane_ids;
+  for (const api::Lane* lane : lanes) {
+    lane_ids += lane->id().string();
+    lane_ids.push_back('\0');
+  }
+  const std::vector<MaliputPoint>& points = kd_tree_->points();
+  const std::string road_geometry_id = get_road_geometry()->id().string();
+  CacheHeader header{};
+  header.magic = kCacheMagic;
+  header.version = kCacheVersion;
+  header.byte_order_mark = kCacheByteOrderMark;
+  header.sampling_step = sampling_step_;
+  header.max_elevation = max_elevation_;
+  header.content_hash = ComputeContentHash(lanes, sampling_step_);
+  header.road_geometry_id_size = road_geometry_id.size();
+  header.lane_ids_size = lane_ids.size();
+  header.num_lanes = lanes.size();
+  header.num_points = points.size();
+
+  return common::WriteFileAtomically(path, [&](std::ostream* os) {
+    os->write(reinterpret_cast<const char*>(&header), sizeof(CacheHeader));
+    WritePadded(*os, road_geometry_id.data(), road_geometry_id.size());
+    WritePadded(*os, lane_ids.data(), lane_ids.size());
+    std::vector<double> coordinates(points.size());
+    for (std::size_t dimension = 0; dimension < 3; ++dimension) {
+      std::transform(points.begin(), points.end(), coordinates.begin(),
+                     [dimension](const MaliputPoint& point) { return point[dimension]; });
+      os->write(reinterpret_cast<const char*>(coordinates.data()), coordinates.size() * sizeof(double));
+    }
+    std::vector<std::uint32_t> point_lanes(points.size());
+    std::transform(points.begin(), points.end(), point_lanes.begin(),
+                   [](const MaliputPoint& point) { return point.lane_index(); });
+    WritePadded(*os, point_lanes.data(), point_lanes.size() * sizeof(std::uint32_t));
+  });
+}
+
+std::vector<KDTreeStrategy::MaliputPoint> KDTreeStrategy::SampleLane(const api::Lane* lane, std::uint32_t lane_index,
+                                                                      double sampling_step, double* max_elevation) {
+  std::vector<api::LanePosition> lane_positions;
+  *max_elevation = 0.;
+  const auto lane_length = lane->length();
+  for (double s = 0; s <= lane_length; s += sampling_step) {
+    const auto lane_bounds = lane->lane_bounds(s);
+    for (double r = lane_bounds.min(); r <= lane_bounds.max(); r += sampling_step) {
+      const api::HBounds elevation_bounds = lane->elevation_bounds(s, r);
+      *max_elevation =
+          std::max({*max_elevation, std::abs(elevation_bounds.min()), std::abs(elevation_bounds.max())});
+      lane_positions.emplace_back(s, r, 0. /* h */);
     }
   }
-  kd_tree_ = std::make_unique<math::KDTree3D<MaliputPoint>>(std::move(points));
+  // Converts all the samples of the lane at once, so backends can evaluate them in batch.
+  const std::vector<api::InertialPosition> inertial_positions = lane->ToInertialPositions(lane_positions);
+  std::vector<MaliputPoint> points;
+  points.reserve(inertial_positions.size());
+  for (const api::InertialPosition& inertial_position : inertial_positions) {
+    const math::Vector3& xyz = inertial_position.xyz();
+    points.push_back(MaliputPoint{{xyz.x(), xyz.y(), xyz.z()}, lane, lane_index});
+  }
+  return points;
 }
 
 api::RoadPositionResult KDTreeStrategy::DoToRoadPosition(const api::InertialPosition& inertial_position,
@@ -60,14 +390,43 @@ api::RoadPositionResult KDTreeStrategy::DoToRoadPosition(const api::InertialPosi
   if (hint.has_value()) {
     MALIPUT_THROW_UNLESS(hint->lane != nullptr);
     const api::LanePositionResult lane_pos = hint->lane->ToLanePosition(inertial_position);
+    if (statistics_enabled()) {
+      RecordStatistics(HintedQueryStatistics(lane_pos));
+    }
     return {{hint->lane, lane_pos.lane_position}, lane_pos.nearest_position, lane_pos.distance};
   }
-  return this->ClosestLane(inertial_position);
+  if (!statistics_enabled()) {
+    return ClosestLane(inertial_position, nullptr);
+  }
+  StrategyStatistics statistics;
+  const api::RoadPositionResult result = ClosestLane(inertial_position, &statistics);
+  RecordStatistics(statistics);
+  return result;
 }
 
 std::vector<api::RoadPositionResult> KDTreeStrategy::DoFindRoadPositions(const api::InertialPosition& inertial_position,
                                                                          double radius) const {
-  const auto closest_lanes = this->ClosestLanes(inertial_position, radius);
+  // Lane positions within the radius may be up to a sampling cell and the elevation bounds away from the closest
+  // sample, so the search radius is enlarged accordingly.
+  CandidateLanes candidate_lanes(num_lanes_);
+  std::size_t num_visited_nodes{0};
+  std::size_t num_returned_points{0};
+  kd_tree_->RadiusSearch(
+      MaliputPoint{inertial_position.xyz()}, radius + 2. * sampling_step_ + max_elevation_,
+      [&candidate_lanes, &num_returned_points](const MaliputPoint& point, double) {
+        ++num_returned_points;
+        candidate_lanes.Add(point);
+      },
+      &num_visited_nodes);
+  const std::vector<const api::Lane*>& closest_lanes = candidate_lanes.lanes();
+  if (statistics_enabled()) {
+    StrategyStatistics statistics;
+    statistics.num_visited_nodes = static_cast<int64_t>(num_visited_nodes);
+    statistics.num_returned_points = static_cast<int64_t>(num_returned_points);
+    statistics.num_candidate_lanes = static_cast<int64_t>(closest_lanes.size());
+    statistics.num_to_lane_position_calls = static_cast<int64_t>(closest_lanes.size());
+    RecordStatistics(statistics);
+  }
   std::vector<api::RoadPositionResult> road_positions;
   for (const auto& lane : closest_lanes) {
     MALIPUT_THROW_UNLESS(lane != nullptr);
@@ -80,14 +439,22 @@ std::vector<api::RoadPositionResult> KDTreeStrategy::DoFindRoadPositions(const a
   return road_positions;
 }
 
-api::RoadPositionResult KDTreeStrategy::ClosestLane(const api::InertialPosition& point) const {
+api::RoadPositionResult KDTreeStrategy::ClosestLane(const api::InertialPosition& point,
+                                                    StrategyStatistics* statistics) const {
   // Obtains the closest point in the kd-tree to the given point.
-  const MaliputPoint maliput_point = kd_tree_->nearest_point(MaliputPoint{point.xyz()});
+  std::size_t num_visited_nodes{0};
+  const MaliputPoint& maliput_point =
+      kd_tree_->nearest_point(MaliputPoint{point.xyz()}, std::numeric_limits<double>::min(), &num_visited_nodes);
+  if (statistics != nullptr) {
+    statistics->num_visited_nodes += static_cast<int64_t>(num_visited_nodes);
+  }
   // As the kd-tree is built with a sampling step, the closest point may not be the closest lane.
   // Therefore, we search for the closest lane in a axis-aligned box whose half edge length is the distance between the
   // nearest point and the given point plus twice the sampling_step_.
   const double half_edge_length = (point.xyz() - maliput_point).norm() + 2. * sampling_step_;
-  const std::deque<const api::Lane*> closest_lanes = ClosestLanes(point, half_edge_length);
+  CandidateLanes candidate_lanes(num_lanes_);
+  ClosestLanes(point, half_edge_length, &candidate_lanes, statistics);
+  const std::vector<const api::Lane*>& closest_lanes = candidate_lanes.lanes();
 
   // Once we have the lanes in the region, we search for the closest lane relying on the lane's ToLanePosition method.
   MALIPUT_THROW_UNLESS(maliput_point.get_lane().has_value());
@@ -96,9 +463,17 @@ api::RoadPositionResult KDTreeStrategy::ClosestLane(const api::InertialPosition&
   api::RoadPositionResult road_position_result{{lane_result, lane_position_result.lane_position},
                                                lane_position_result.nearest_position,
                                                lane_position_result.distance};
+  if (statistics != nullptr) {
+    // The lane of the nearest point is among the candidates unless the search region misses it due to rounding.
+    const bool has_lane_result = candidate_lanes.Contains(maliput_point);
+    const int64_t num_candidate_lanes = static_cast<int64_t>(closest_lanes.size()) + (has_lane_result ? 0 : 1);
+    statistics->num_candidate_lanes += num_candidate_lanes;
+    statistics->num_to_lane_position_calls += num_candidate_lanes;
+  }
 
   for (const auto& lane : closest_lanes) {
     MALIPUT_THROW_UNLESS(lane != nullptr);
+    if (lane == lane_result) continue;
     const api::LanePositionResult lane_position = lane->ToLanePosition(point);
     const api::RoadPositionResult road_position{
         {lane, lane_position.lane_position}, lane_position.nearest_position, lane_position.distance};
@@ -110,18 +485,27 @@ api::RoadPositionResult KDTreeStrategy::ClosestLane(const api::InertialPosition&
   return road_position_result;
 }
 
-std::deque<const api::Lane*> KDTreeStrategy::ClosestLanes(const api::InertialPosition& point,
-                                                          double half_edge_length) const {
+void KDTreeStrategy::ClosestLanes(const api::InertialPosition& point, double half_edge_length,
+                                  CandidateLanes* lanes, StrategyStatistics* statistics) const {
   const math::Vector3 min_corner{point.x() - half_edge_length, point.y() - half_edge_length,
                                  point.z() - half_edge_length};
   const math::Vector3 max_corner{point.x() + half_edge_length, point.y() + half_edge_length,
                                  point.z() + half_edge_length};
   const math::AxisAlignedBox search_region{min_corner, max_corner};
-  const std::deque<const MaliputPoint*> maliput_points = kd_tree_->RangeSearch(search_region);
-  std::deque<const api::Lane*> maliput_lanes(maliput_points.size());
-  std::transform(maliput_points.begin(), maliput_points.end(), maliput_lanes.begin(),
-                 [](const MaliputPoint* point) { return point->get_lane().value(); });
-  return maliput_lanes;
+  std::size_t num_visited_nodes{0};
+  std::size_t num_returned_points{0};
+  kd_tree_->RangeSearch(
+      search_region,
+      [lanes, &num_returned_points](const MaliputPoint& maliput_point) {
+        ++num_returned_points;
+        lanes->Add(maliput_point);
+      },
+      &num_visited_nodes);
+  if (statistics != nullptr) {
+    statistics->num_visited_nodes += static_cast<int64_t>(num_visited_nodes);
+    statistics->num_returned_points += static_cast<int64_t>(num_returned_points);
+  }
 }
+
 }  // namespace geometry_base
 }  // namespace maliput
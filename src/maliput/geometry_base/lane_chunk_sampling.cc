@@ -0,0 +1,168 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2023, Woven by Toyota. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "lane_chunk_sampling.h"
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "maliput/common/maliput_throw.h"
+#include "maliput/math/vector.h"
+
+namespace maliput {
+namespace geometry_base {
+namespace internal {
+namespace {
+
+// Number of samples along `s` per chunk.
+constexpr double kSamplesPerChunk{4.};
+
+// Obtains equally spaced samples in [start, end] at most @p step apart, including both ends.
+std::vector<double> SampleRange(double start, double end, double step) {
+  std::vector<double> samples{start};
+  for (double value = start + step; value < end; value += step) {
+    samples.push_back(value);
+  }
+  if (end > start) {
+    samples.push_back(end);
+  }
+  return samples;
+}
+
+// Evaluates the Inertial Frame positions of @p lane at @p s and at the lateral position given by @p fraction of
+// its lane bounds, at both of its elevation bounds.
+std::array<math::Vector3, 2> EvalLaneVolume(const api::Lane* lane, double s, double fraction) {
+  const api::RBounds lane_bounds = lane->lane_bounds(s);
+  const double r = lane_bounds.min() + fraction * (lane_bounds.max() - lane_bounds.min());
+  const api::HBounds elevation_bounds = lane->elevation_bounds(s, r);
+  return {lane->ToInertialPosition({s, r, elevation_bounds.min()}).xyz(),
+          lane->ToInertialPosition({s, r, elevation_bounds.max()}).xyz()};
+}
+
+// Computes the box that encloses the volume of @p lane in [@p chunk_start, @p chunk_end], sampled every @p step.
+math::AxisAlignedBox ComputeLaneChunkBox(const api::Lane* lane, double chunk_start, double chunk_end, double step,
+                                         double linear_tolerance) {
+  const std::vector<double> s_samples = SampleRange(chunk_start, chunk_end, step);
+  // Lateral samples are taken at fixed fractions of the lane bounds, so they line up along `s` even when the
+  // bounds vary within the chunk.
+  double max_width{0.};
+  for (const double s : s_samples) {
+    const api::RBounds lane_bounds = lane->lane_bounds(s);
+    max_width = std::max(max_width, lane_bounds.max() - lane_bounds.min());
+  }
+  const std::vector<double> fractions = SampleRange(0., 1., max_width > step ? step / max_width : 1.);
+
+  const double infinity = std::numeric_limits<double>::infinity();
+  math::Vector3 min_corner{infinity, infinity, infinity};
+  math::Vector3 max_corner{-infinity, -infinity, -infinity};
+  const auto eval = [lane, &min_corner, &max_corner](double s, double fraction) {
+    const std::array<math::Vector3, 2> xyz = EvalLaneVolume(lane, s, fraction);
+    for (const math::Vector3& point : xyz) {
+      for (int i = 0; i < 3; ++i) {
+        min_corner[i] = std::min(min_corner[i], point[i]);
+        max_corner[i] = std::max(max_corner[i], point[i]);
+      }
+    }
+    return xyz;
+  };
+  // The lane volume between samples departs from the chords joining them (which lie within the box) by the
+  // sagitta of the lane surface, that grows with curvature and bounds variation. It is measured at the
+  // midpoints of the sampling grid and doubled to cover the error of the midpoint estimate.
+  double sagitta{0.};
+  const auto update_sagitta = [&sagitta](const std::array<math::Vector3, 2>& middle,
+                                         const std::array<math::Vector3, 2>& lhs,
+                                         const std::array<math::Vector3, 2>& rhs) {
+    for (int i = 0; i < 2; ++i) {
+      sagitta = std::max(sagitta, (middle[i] - (lhs[i] + rhs[i]) / 2.).norm());
+    }
+  };
+  std::vector<std::array<math::Vector3, 2>> previous_row;
+  for (std::size_t i = 0; i < s_samples.size(); ++i) {
+    std::vector<std::array<math::Vector3, 2>> row;
+    row.reserve(fractions.size());
+    for (std::size_t j = 0; j < fractions.size(); ++j) {
+      row.push_back(eval(s_samples[i], fractions[j]));
+      if (j > 0) {
+        update_sagitta(eval(s_samples[i], (fractions[j - 1] + fractions[j]) / 2.), row[j - 1], row[j]);
+      }
+      if (i > 0) {
+        update_sagitta(eval((s_samples[i - 1] + s_samples[i]) / 2., fractions[j]), previous_row[j], row[j]);
+      }
+    }
+    previous_row = std::move(row);
+  }
+  const double margin = 2. * sagitta + linear_tolerance;
+  const math::Vector3 margin_vector{margin, margin, margin};
+  return math::AxisAlignedBox{min_corner - margin_vector, max_corner + margin_vector};
+}
+
+}  // namespace
+
+std::vector<const api::Lane*> GetLanes(const api::RoadGeometry* rg) {
+  const api::RoadGeometry::IdIndex& id_index = rg->ById();
+  std::vector<const api::Lane*> lanes;
+  if (id_index.num_lane_indices() > 0) {
+    lanes.reserve(id_index.num_lane_indices());
+    for (uint32_t i = 0; i < id_index.num_lane_indices(); ++i) {
+      lanes.push_back(id_index.GetLaneByIndex(i));
+    }
+  } else {
+    for (const auto& id_lane : id_index.GetLanes()) {
+      lanes.push_back(id_lane.second);
+    }
+  }
+  return lanes;
+}
+
+void VisitLaneChunkBoxes(const api::Lane* lane, double chunk_length, double linear_tolerance,
+                         const std::function<void(const math::AxisAlignedBox&)>& visitor) {
+  MALIPUT_THROW_UNLESS(lane != nullptr);
+  MALIPUT_THROW_UNLESS(chunk_length > 0.);
+  const double step = chunk_length / kSamplesPerChunk;
+  const double lane_length = lane->length();
+  double chunk_start{0.};
+  do {
+    const double chunk_end = std::min(chunk_start + chunk_length, lane_length);
+    visitor(ComputeLaneChunkBox(lane, chunk_start, chunk_end, step, linear_tolerance));
+    chunk_start = chunk_end;
+  } while (chunk_start < lane_length);
+}
+
+api::RoadPositionResult ToRoadPositionOnHint(const api::InertialPosition& inertial_position,
+                                             const api::RoadPosition& hint) {
+  MALIPUT_THROW_UNLESS(hint.lane != nullptr);
+  const api::LanePositionResult lane_pos = hint.lane->ToLanePosition(inertial_position);
+  return {{hint.lane, lane_pos.lane_position}, lane_pos.nearest_position, lane_pos.distance};
+}
+
+}  // namespace internal
+}  // namespace geometry_base
+}  // namespace maliput
@@ -0,0 +1,68 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2023, Woven by Toyota. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <functional>
+#include <optional>
+#include <vector>
+
+#include "maliput/api/lane.h"
+#include "maliput/api/lane_data.h"
+#include "maliput/api/road_geometry.h"
+#include "maliput/math/axis_aligned_box.h"
+
+namespace maliput {
+namespace geometry_base {
+namespace internal {
+
+// Helpers shared by the lookup strategies that enclose chunks of the lanes in volumes, i.e. BVHStrategy and
+// SpatialHashStrategy.
+
+// Distance tolerance used to consider results that tie with the best result so far.
+// It matches the one used by IsNewRoadPositionResultCloser().
+constexpr double kTieTolerance{1e-12};
+
+// @returns The lanes of @p rg in dense index order, or in RoadGeometry::IdIndex::GetLanes() order when its IdIndex
+// does not assign dense indices.
+std::vector<const api::Lane*> GetLanes(const api::RoadGeometry* rg);
+
+// Splits @p lane along its `s` coordinate into chunks of at most @p chunk_length length and calls @p visitor with the
+// box that encloses the volume (lane bounds and elevation bounds) of each chunk, in increasing `s` order.
+// Chunks are sampled at a quarter of @p chunk_length and the boxes are grown by the sagitta of the lane surface
+// between samples plus @p linear_tolerance.
+void VisitLaneChunkBoxes(const api::Lane* lane, double chunk_length, double linear_tolerance,
+                         const std::function<void(const math::AxisAlignedBox&)>& visitor);
+
+// Resolves a query at @p inertial_position on the lane of @p hint.
+api::RoadPositionResult ToRoadPositionOnHint(const api::InertialPosition& inertial_position,
+                                             const api::RoadPosition& hint);
+
+}  // namespace internal
+}  // namespace geometry_base
+}  // namespace maliput
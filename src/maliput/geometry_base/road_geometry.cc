@@ -81,5 +81,15 @@ std::vector<api::RoadPositionResult> RoadGeometry::DoFindRoadPositions(const api
   return strategy_->FindRoadPositions(inertial_position, radius);
 }
 
+std::vector<api::RoadPositionResult> RoadGeometry::DoToRoadPositions(
+    const std::vector<api::InertialPosition>& inertial_positions,
+    const std::vector<std::optional<api::RoadPosition>>& hints, std::size_t num_threads) const {
+  MALIPUT_VALIDATE(
+      strategy_ != nullptr,
+      "RoadGeometry::DoToRoadPositions() called with no strategy set. Call "
+      "maliput::geometry_base::RoadGeometry::InitializeStrategy() after road geometry is fully constructed.");
+  return strategy_->ToRoadPositions(inertial_positions, hints, num_threads);
+}
+
 }  // namespace geometry_base
 }  // namespace maliput
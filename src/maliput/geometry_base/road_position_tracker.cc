@@ -0,0 +1,104 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2023, Woven by Toyota. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "maliput/geometry_base/road_position_tracker.h"
+
+#include "maliput/api/branch_point.h"
+#include "maliput/api/lane.h"
+#include "maliput/common/maliput_throw.h"
+#include "maliput/geometry_base/strategy_base.h"
+
+namespace maliput {
+namespace geometry_base {
+
+RoadPositionTracker::RoadPositionTracker(const api::RoadGeometry* road_geometry) : road_geometry_(road_geometry) {
+  MALIPUT_THROW_UNLESS(road_geometry_ != nullptr);
+}
+
+RoadPositionTracker::RoadPositionTracker(const api::RoadGeometry* road_geometry, const api::RoadPosition& road_position)
+    : RoadPositionTracker(road_geometry) {
+  MALIPUT_THROW_UNLESS(road_position.lane != nullptr);
+  road_position_ = road_position;
+}
+
+api::RoadPositionResult RoadPositionTracker::Update(const api::InertialPosition& inertial_position) {
+  std::optional<api::RoadPositionResult> result = LocalSearch(inertial_position);
+  if (result.has_value() && result->distance <= road_geometry_->linear_tolerance()) {
+    ++num_local_hits_;
+  } else {
+    result = road_geometry_->ToRoadPosition(inertial_position);
+    ++num_fallbacks_;
+  }
+  road_position_ = result->road_position;
+  return result.value();
+}
+
+void RoadPositionTracker::Consider(const api::Lane* lane, const api::InertialPosition& inertial_position,
+                                   std::optional<api::RoadPositionResult>* best) {
+  if (lane == nullptr) {
+    return;
+  }
+  const api::LanePositionResult lane_position_result = lane->ToLanePosition(inertial_position);
+  const api::RoadPositionResult candidate{{lane, lane_position_result.lane_position},
+                                          lane_position_result.nearest_position,
+                                          lane_position_result.distance};
+  if (!best->has_value() || IsNewRoadPositionResultCloser(candidate, best->value())) {
+    *best = candidate;
+  }
+}
+
+std::optional<api::RoadPositionResult> RoadPositionTracker::LocalSearch(
+    const api::InertialPosition& inertial_position) const {
+  if (!road_position_.has_value()) {
+    return std::nullopt;
+  }
+  const api::Lane* lane = road_position_->lane;
+  std::optional<api::RoadPositionResult> best{};
+  Consider(lane, inertial_position, &best);
+  // Most ticks end in the same lane; avoid evaluating the neighbourhood then.
+  if (best->distance <= road_geometry_->linear_tolerance() && best->road_position.pos.s() > 0. &&
+      best->road_position.pos.s() < lane->length()) {
+    return best;
+  }
+  Consider(lane->to_left(), inertial_position, &best);
+  Consider(lane->to_right(), inertial_position, &best);
+  for (const api::LaneEnd::Which end : {api::LaneEnd::kStart, api::LaneEnd::kFinish}) {
+    // Lanes whose ends were not attached to a BranchPoint have no ongoing branches.
+    if (lane->GetBranchPoint(end) == nullptr) {
+      continue;
+    }
+    const api::LaneEndSet* ongoing_branches = lane->GetOngoingBranches(end);
+    for (int i = 0; i < ongoing_branches->size(); ++i) {
+      Consider(ongoing_branches->get(i).lane, inertial_position, &best);
+    }
+  }
+  return best;
+}
+
+}  // namespace geometry_base
+}  // namespace maliput
@@ -0,0 +1,214 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2023, Woven by Toyota. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "maliput/geometry_base/spatial_hash_strategy.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <unordered_set>
+#include <utility>
+
+#include "lane_chunk_sampling.h"
+#include "maliput/common/maliput_throw.h"
+
+namespace maliput {
+namespace geometry_base {
+namespace {
+
+// @returns The distance from @p value to the interval [@p min, @p max].
+double IntervalDistance(double value, double min, double max) {
+  return value < min ? min - value : (value > max ? value - max : 0.);
+}
+
+}  // namespace
+
+SpatialHashStrategy::SpatialHashStrategy(const api::RoadGeometry* rg, double cell_size)
+    : StrategyBase(rg), cell_size_(cell_size) {
+  MALIPUT_THROW_UNLESS(cell_size_ > 0.);
+  std::unordered_map<CellKey, std::vector<Entry>, common::DefaultHash> cells;
+  for (const api::Lane* lane : internal::GetLanes(get_road_geometry())) {
+    AddLane(lane, &cells);
+  }
+  cells_.reserve(cells.size());
+  for (const auto& key_entries : cells) {
+    cells_.emplace(key_entries.first, Range{entries_.size(), entries_.size() + key_entries.second.size()});
+    entries_.insert(entries_.end(), key_entries.second.begin(), key_entries.second.end());
+  }
+}
+
+void SpatialHashStrategy::AddLane(const api::Lane* lane,
+                                  std::unordered_map<CellKey, std::vector<Entry>, common::DefaultHash>* cells) {
+  internal::VisitLaneChunkBoxes(
+      lane, cell_size_, get_road_geometry()->linear_tolerance(), [this, lane, cells](const math::AxisAlignedBox& box) {
+        const Entry entry{lane, box.min_corner().z(), box.max_corner().z()};
+        const std::int64_t first_ix = CellIndex(box.min_corner().x());
+        const std::int64_t last_ix = CellIndex(box.max_corner().x());
+        const std::int64_t first_iy = CellIndex(box.min_corner().y());
+        const std::int64_t last_iy = CellIndex(box.max_corner().y());
+        for (std::int64_t ix = first_ix; ix <= last_ix; ++ix) {
+          for (std::int64_t iy = first_iy; iy <= last_iy; ++iy) {
+            std::vector<Entry>& cell = (*cells)[CellKey(ix, iy)];
+            // Consecutive chunks of the same lane usually share cells, so their entries are merged.
+            if (!cell.empty() && cell.back().lane == lane) {
+              cell.back().min_z = std::min(cell.back().min_z, entry.min_z);
+              cell.back().max_z = std::max(cell.back().max_z, entry.max_z);
+            } else {
+              cell.push_back(entry);
+            }
+          }
+        }
+        min_ix_ = std::min(min_ix_, first_ix);
+        max_ix_ = std::max(max_ix_, last_ix);
+        min_iy_ = std::min(min_iy_, first_iy);
+        max_iy_ = std::max(max_iy_, last_iy);
+      });
+}
+
+std::int64_t SpatialHashStrategy::CellIndex(double coordinate) const {
+  return static_cast<std::int64_t>(std::floor(coordinate / cell_size_));
+}
+
+double SpatialHashStrategy::Distance(const math::Vector3& xyz, std::int64_t ix, std::int64_t iy,
+                                     const Entry& entry) const {
+  const double dx = IntervalDistance(xyz.x(), ix * cell_size_, (ix + 1) * cell_size_);
+  const double dy = IntervalDistance(xyz.y(), iy * cell_size_, (iy + 1) * cell_size_);
+  const double dz = IntervalDistance(xyz.z(), entry.min_z, entry.max_z);
+  return std::sqrt(dx * dx + dy * dy + dz * dz);
+}
+
+template <typename Visitor>
+void SpatialHashStrategy::VisitCell(std::int64_t ix, std::int64_t iy, Visitor&& visitor) const {
+  const auto it = cells_.find(CellKey(ix, iy));
+  if (it == cells_.end()) {
+    return;
+  }
+  for (std::size_t i = it->second.begin; i < it->second.end; ++i) {
+    visitor(ix, iy, entries_[i]);
+  }
+}
+
+api::RoadPositionResult SpatialHashStrategy::DoToRoadPosition(const api::InertialPosition& inertial_position,
+                                                              const std::optional<api::RoadPosition>& hint) const {
+  if (hint.has_value()) {
+    return internal::ToRoadPositionOnHint(inertial_position, hint.value());
+  }
+  MALIPUT_VALIDATE(!cells_.empty(), "The RoadGeometry has no lanes.");
+
+  const math::Vector3& xyz = inertial_position.xyz();
+  const std::int64_t cx = CellIndex(xyz.x());
+  const std::int64_t cy = CellIndex(xyz.y());
+  // Rings closer than the grid are empty, and rings beyond its farthest corner hold no cells.
+  const std::int64_t first_ring = std::max({std::int64_t{0}, min_ix_ - cx, cx - max_ix_, min_iy_ - cy, cy - max_iy_});
+  const std::int64_t last_ring =
+      std::max({std::abs(cx - min_ix_), std::abs(cx - max_ix_), std::abs(cy - min_iy_), std::abs(cy - max_iy_)});
+
+  std::unordered_set<const api::Lane*> evaluated_lanes;
+  std::optional<api::RoadPositionResult> result;
+  const auto evaluate = [&](std::int64_t ix, std::int64_t iy, const Entry& entry) {
+    if (result.has_value() && Distance(xyz, ix, iy, entry) > result->distance + internal::kTieTolerance) {
+      return;
+    }
+    if (!evaluated_lanes.insert(entry.lane).second) {
+      return;
+    }
+    const api::LanePositionResult lane_position = entry.lane->ToLanePosition(inertial_position);
+    const api::RoadPositionResult road_position{
+        {entry.lane, lane_position.lane_position}, lane_position.nearest_position, lane_position.distance};
+    if (!result.has_value() || IsNewRoadPositionResultCloser(road_position, result.value())) {
+      result = road_position;
+    }
+  };
+  for (std::int64_t ring = first_ring; ring <= last_ring; ++ring) {
+    // The query point lies within the center cell, so cells in this ring are at least `ring - 1` cells away.
+    if (result.has_value() && (ring - 1) * cell_size_ > result->distance + internal::kTieTolerance) {
+      break;
+    }
+    if (ring == 0) {
+      VisitCell(cx, cy, evaluate);
+      continue;
+    }
+    const std::int64_t first_ix = std::max(cx - ring, min_ix_);
+    const std::int64_t last_ix = std::min(cx + ring, max_ix_);
+    for (const std::int64_t iy : {cy - ring, cy + ring}) {
+      if (iy < min_iy_ || iy > max_iy_) {
+        continue;
+      }
+      for (std::int64_t ix = first_ix; ix <= last_ix; ++ix) {
+        VisitCell(ix, iy, evaluate);
+      }
+    }
+    const std::int64_t first_iy = std::max(cy - ring + 1, min_iy_);
+    const std::int64_t last_iy = std::min(cy + ring - 1, max_iy_);
+    for (const std::int64_t ix : {cx - ring, cx + ring}) {
+      if (ix < min_ix_ || ix > max_ix_) {
+        continue;
+      }
+      for (std::int64_t iy = first_iy; iy <= last_iy; ++iy) {
+        VisitCell(ix, iy, evaluate);
+      }
+    }
+  }
+  MALIPUT_THROW_UNLESS(result.has_value());
+  return result.value();
+}
+
+std::vector<api::RoadPositionResult> SpatialHashStrategy::DoFindRoadPositions(
+    const api::InertialPosition& inertial_position, double radius) const {
+  MALIPUT_THROW_UNLESS(radius >= 0.);
+  const math::Vector3& xyz = inertial_position.xyz();
+  std::vector<const api::Lane*> candidate_lanes;
+  std::unordered_set<const api::Lane*> visited_lanes;
+  const auto add_candidate = [&](std::int64_t ix, std::int64_t iy, const Entry& entry) {
+    if (Distance(xyz, ix, iy, entry) <= radius && visited_lanes.insert(entry.lane).second) {
+      candidate_lanes.push_back(entry.lane);
+    }
+  };
+  const std::int64_t first_ix = std::max(CellIndex(xyz.x() - radius), min_ix_);
+  const std::int64_t last_ix = std::min(CellIndex(xyz.x() + radius), max_ix_);
+  const std::int64_t first_iy = std::max(CellIndex(xyz.y() - radius), min_iy_);
+  const std::int64_t last_iy = std::min(CellIndex(xyz.y() + radius), max_iy_);
+  for (std::int64_t ix = first_ix; ix <= last_ix; ++ix) {
+    for (std::int64_t iy = first_iy; iy <= last_iy; ++iy) {
+      VisitCell(ix, iy, add_candidate);
+    }
+  }
+
+  std::vector<api::RoadPositionResult> road_positions;
+  for (const api::Lane* lane : candidate_lanes) {
+    const api::LanePositionResult lane_position = lane->ToLanePosition(inertial_position);
+    if (lane_position.distance <= radius) {
+      road_positions.push_back(
+          {{lane, lane_position.lane_position}, lane_position.nearest_position, lane_position.distance});
+    }
+  }
+  return road_positions;
+}
+
+}  // namespace geometry_base
+}  // namespace maliput
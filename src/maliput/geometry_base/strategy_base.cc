@@ -30,7 +30,11 @@
 
 #include "maliput/geometry_base/strategy_base.h"
 
+#include <algorithm>
 #include <cstdlib>
+#include <utility>
+
+#include "maliput/common/parallel_for.h"
 
 namespace maliput {
 namespace geometry_base {
@@ -74,5 +78,88 @@ bool IsNewRoadPositionResultCloser(const maliput::api::RoadPositionResult& new_r
   return false;
 }
 
+namespace {
+
+// Raises @p maximum to @p value.
+void UpdateMaximum(int64_t value, std::atomic<int64_t>* maximum) {
+  int64_t current = maximum->load(std::memory_order_relaxed);
+  while (value > current && !maximum->compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+  }
+}
+
+}  // namespace
+
+StrategyStatistics StrategyBase::GetStatistics() const {
+  StrategyStatistics result;
+  result.num_queries = statistics_.num_queries.load(std::memory_order_relaxed);
+  result.num_visited_nodes = statistics_.num_visited_nodes.load(std::memory_order_relaxed);
+  result.num_returned_points = statistics_.num_returned_points.load(std::memory_order_relaxed);
+  result.num_candidate_lanes = statistics_.num_candidate_lanes.load(std::memory_order_relaxed);
+  result.num_to_lane_position_calls = statistics_.num_to_lane_position_calls.load(std::memory_order_relaxed);
+  result.num_hint_hits = statistics_.num_hint_hits.load(std::memory_order_relaxed);
+  result.num_hint_misses = statistics_.num_hint_misses.load(std::memory_order_relaxed);
+  result.max_candidate_lanes = statistics_.max_candidate_lanes.load(std::memory_order_relaxed);
+  result.max_visited_nodes = statistics_.max_visited_nodes.load(std::memory_order_relaxed);
+  return result;
+}
+
+void StrategyBase::ResetStatistics() const {
+  for (std::atomic<int64_t>* counter :
+       {&statistics_.num_queries, &statistics_.num_visited_nodes, &statistics_.num_returned_points,
+        &statistics_.num_candidate_lanes, &statistics_.num_to_lane_position_calls, &statistics_.num_hint_hits,
+        &statistics_.num_hint_misses, &statistics_.max_candidate_lanes, &statistics_.max_visited_nodes}) {
+    counter->store(0, std::memory_order_relaxed);
+  }
+}
+
+void StrategyBase::RecordStatistics(const StrategyStatistics& query_statistics) const {
+  if (!statistics_enabled()) {
+    return;
+  }
+  statistics_.num_visited_nodes.fetch_add(query_statistics.num_visited_nodes, std::memory_order_relaxed);
+  statistics_.num_returned_points.fetch_add(query_statistics.num_returned_points, std::memory_order_relaxed);
+  statistics_.num_candidate_lanes.fetch_add(query_statistics.num_candidate_lanes, std::memory_order_relaxed);
+  statistics_.num_to_lane_position_calls.fetch_add(query_statistics.num_to_lane_position_calls,
+                                                   std::memory_order_relaxed);
+  statistics_.num_hint_hits.fetch_add(query_statistics.num_hint_hits, std::memory_order_relaxed);
+  statistics_.num_hint_misses.fetch_add(query_statistics.num_hint_misses, std::memory_order_relaxed);
+  UpdateMaximum(query_statistics.num_candidate_lanes, &statistics_.max_candidate_lanes);
+  UpdateMaximum(query_statistics.num_visited_nodes, &statistics_.max_visited_nodes);
+}
+
+StrategyStatistics StrategyBase::HintedQueryStatistics(const api::LanePositionResult& lane_position_result) const {
+  StrategyStatistics result;
+  result.num_candidate_lanes = 1;
+  result.num_to_lane_position_calls = 1;
+  if (lane_position_result.distance <= rg_->linear_tolerance()) {
+    result.num_hint_hits = 1;
+  } else {
+    result.num_hint_misses = 1;
+  }
+  return result;
+}
+
+std::vector<api::RoadPositionResult> StrategyBase::DoToRoadPositions(
+    const std::vector<api::InertialPosition>& inertial_positions,
+    const std::vector<std::optional<api::RoadPosition>>& hints, std::size_t num_threads) const {
+  MALIPUT_THROW_UNLESS(hints.empty() || hints.size() == inertial_positions.size());
+  MALIPUT_THROW_UNLESS(num_threads > 0);
+  std::vector<api::RoadPositionResult> results(inertial_positions.size());
+  // Resolves the queries in the [begin, end) range.
+  const auto resolve_range = [&](std::size_t begin, std::size_t end) {
+    for (std::size_t i = begin; i < end; ++i) {
+      results[i] = DoToRoadPosition(inertial_positions[i], hints.empty() ? std::nullopt : hints[i]);
+    }
+  };
+
+  // Each chunk writes to a disjoint range of `results`. ParallelFor() waits for every chunk before rethrowing the
+  // first exception raised while resolving them.
+  const std::vector<std::pair<std::size_t, std::size_t>> chunks =
+      common::MakeChunks(inertial_positions.size(), num_threads);
+  common::ParallelFor(chunks.size(), num_threads,
+                      [&chunks, &resolve_range](std::size_t i) { resolve_range(chunks[i].first, chunks[i].second); });
+  return results;
+}
+
 }  // namespace geometry_base
 }  // namespace maliput
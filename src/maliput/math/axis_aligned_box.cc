@@ -29,6 +29,9 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "maliput/math/axis_aligned_box.h"
 
+#include <algorithm>
+#include <cmath>
+
 namespace maliput {
 namespace math {
 AxisAlignedBox::AxisAlignedBox(const Vector3& min_corner, const Vector3& max_corner)
@@ -98,5 +101,24 @@ std::optional<AxisAlignedBox> AxisAlignedBox::GetIntersection(const AxisAlignedB
   return {AxisAlignedBox(min_corner, max_corner, tolerance_)};
 }
 
+AxisAlignedBox AxisAlignedBox::GetUnion(const AxisAlignedBox& other) const {
+  const auto min_corner =
+      Vector3(std::min(min_corner_.x(), other.min_corner_.x()), std::min(min_corner_.y(), other.min_corner_.y()),
+              std::min(min_corner_.z(), other.min_corner_.z()));
+  const auto max_corner =
+      Vector3(std::max(max_corner_.x(), other.max_corner_.x()), std::max(max_corner_.y(), other.max_corner_.y()),
+              std::max(max_corner_.z(), other.max_corner_.z()));
+  return AxisAlignedBox(min_corner, max_corner, tolerance_);
+}
+
+double AxisAlignedBox::Distance(const Vector3& position) const {
+  double squared_distance{0.};
+  for (int i = 0; i < 3; ++i) {
+    const double delta = std::max({min_corner_[i] - position[i], 0., position[i] - max_corner_[i]});
+    squared_distance += delta * delta;
+  }
+  return std::sqrt(squared_distance);
+}
+
 }  // namespace math
 }  // namespace maliput
@@ -0,0 +1,726 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2023, Woven by Toyota. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "maliput/test_utilities/procedural_road_network.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "maliput/api/intersection.h"
+#include "maliput/api/lane_data.h"
+#include "maliput/api/regions.h"
+#include "maliput/api/rules/discrete_value_rule.h"
+#include "maliput/api/rules/phase.h"
+#include "maliput/api/rules/phase_ring.h"
+#include "maliput/api/rules/range_value_rule.h"
+#include "maliput/api/rules/rule_registry.h"
+#include "maliput/api/rules/traffic_lights.h"
+#include "maliput/base/intersection.h"
+#include "maliput/base/intersection_book.h"
+#include "maliput/base/manual_phase_provider.h"
+#include "maliput/base/manual_phase_ring_book.h"
+#include "maliput/base/manual_range_value_rule_state_provider.h"
+#include "maliput/base/manual_rulebook.h"
+#include "maliput/base/phased_discrete_rule_state_provider.h"
+#include "maliput/base/rule_registry.h"
+#include "maliput/base/traffic_light_book.h"
+#include "maliput/common/maliput_throw.h"
+#include "maliput/geometry_base/branch_point.h"
+#include "maliput/geometry_base/junction.h"
+#include "maliput/geometry_base/lane.h"
+#include "maliput/geometry_base/segment.h"
+#include "maliput/math/saturate.h"
+#include "maliput/math/vector.h"
+
+namespace maliput {
+namespace api {
+namespace test {
+namespace {
+
+using rules::BulbGroup;
+using rules::DiscreteValueRule;
+using rules::Phase;
+using rules::PhaseRing;
+using rules::RangeValueRule;
+using rules::Rule;
+using rules::TrafficLight;
+
+constexpr double kPi{M_PI};
+// Height of the lane volumes.
+constexpr double kMaxHeight{5.};
+// Curvatures below this value are considered straight lines.
+constexpr double kStraightCurvature{1e-12};
+// Length of the range of `s` below which projections onto graded lanes stop refining it.
+constexpr double kProjectionTolerance{1e-9};
+// Height of the traffic lights over the road.
+constexpr double kTrafficLightHeight{5.};
+// Names of the travel directions, indexed by the heading in quarters of a turn.
+constexpr std::array<const char*, 4> kHeadingNames{"east", "north", "west", "south"};
+
+// A planar curve of constant curvature whose elevation changes linearly along its planar length.
+struct Curve {
+  // @returns The unit vector pointing left of @p heading.
+  static math::Vector3 Normal(double heading) { return {-std::sin(heading), std::cos(heading), 0.}; }
+
+  double HeadingAt(double u) const { return heading + curvature * u; }
+
+  math::Vector3 PositionAt(double u) const {
+    const double z = start.z() + grade * u;
+    if (std::abs(curvature) < kStraightCurvature) {
+      return {start.x() + u * std::cos(heading), start.y() + u * std::sin(heading), z};
+    }
+    const double end_heading = HeadingAt(u);
+    return {start.x() + (std::sin(end_heading) - std::sin(heading)) / curvature,
+            start.y() - (std::cos(end_heading) - std::cos(heading)) / curvature, z};
+  }
+
+  // @returns The curve that runs parallel to this one, @p r to its left. Both curves share the elevation at their
+  // ends, so the grade changes with the length.
+  Curve Offset(double r) const {
+    const double scale = 1. - curvature * r;
+    MALIPUT_VALIDATE(scale > 0., "Lanes are too far from the center of their curve.");
+    return {start + r * Normal(heading), heading, curvature / scale, length * scale, grade / scale};
+  }
+
+  // @returns The same curve, traversed in the opposite direction.
+  Curve Reversed() const { return {PositionAt(length), HeadingAt(length) + kPi, -curvature, length, -grade}; }
+
+  math::Vector3 start;
+  double heading{};
+  double curvature{};
+  // Planar length.
+  double length{};
+  double grade{};
+};
+
+// A geometry_base::Lane whose centerline is a Curve. Lateral offsets are horizontal and the `h` axis is parallel to
+// the Inertial Frame's z-axis.
+class ProceduralLane final : public geometry_base::Lane {
+ public:
+  ProceduralLane(const LaneId& id, const Curve& curve, const RBounds& lane_bounds, const RBounds& segment_bounds)
+      : geometry_base::Lane(id),
+        curve_(curve),
+        length_scale_(std::sqrt(1. + curve.grade * curve.grade)),
+        lane_bounds_(lane_bounds),
+        segment_bounds_(segment_bounds) {}
+
+  const Curve& curve() const { return curve_; }
+
+ private:
+  double do_length() const override { return curve_.length * length_scale_; }
+  RBounds do_lane_bounds(double) const override { return lane_bounds_; }
+  RBounds do_segment_bounds(double) const override { return segment_bounds_; }
+  HBounds do_elevation_bounds(double, double) const override { return {0., kMaxHeight}; }
+
+  InertialPosition DoToInertialPosition(const LanePosition& lane_pos) const override {
+    const double u = lane_pos.s() / length_scale_;
+    return InertialPosition::FromXyz(curve_.PositionAt(u) + lane_pos.r() * Curve::Normal(curve_.HeadingAt(u)) +
+                                     lane_pos.h() * math::Vector3::UnitZ());
+  }
+
+  Rotation DoGetOrientation(const LanePosition& lane_pos) const override {
+    return Rotation::FromRpy(0., -std::atan(curve_.grade), curve_.HeadingAt(lane_pos.s() / length_scale_));
+  }
+
+  LanePosition DoEvalMotionDerivatives(const LanePosition& lane_pos, const IsoLaneVelocity& velocity) const override {
+    return {velocity.sigma_v / (1. - curve_.curvature * lane_pos.r()), velocity.rho_v, velocity.eta_v};
+  }
+
+  LanePositionResult DoToLanePosition(const InertialPosition& inertial_pos) const override {
+    return Project(inertial_pos, lane_bounds_);
+  }
+
+  LanePositionResult DoToSegmentPosition(const InertialPosition& inertial_pos) const override {
+    return Project(inertial_pos, segment_bounds_);
+  }
+
+  // Projects @p inertial_pos onto the volume of the lane limited laterally by @p bounds.
+  // The planar projection onto the centerline is exact for lanes without grade. On graded lanes, the closest cross
+  // section is then searched around it, which is exact for straight lanes as the distance to their cross sections is
+  // convex along `s`, and it assumes a single minimum within the searched range on curved lanes.
+  LanePositionResult Project(const InertialPosition& inertial_pos, const RBounds& bounds) const {
+    const math::Vector3& xyz = inertial_pos.xyz();
+    const double planar_u = PlanarProjection(xyz);
+    LanePosition lane_position = ProjectOnCrossSection(xyz, planar_u, bounds);
+    double distance = (xyz - DoToInertialPosition(lane_position).xyz()).norm();
+    if (curve_.grade != 0. && distance > 0.) {
+      // Closer cross sections are less than `distance` away horizontally, which bounds the range to search.
+      double half_range = distance;
+      if (std::abs(curve_.curvature) >= kStraightCurvature) {
+        const math::Vector3 center = curve_.start + Curve::Normal(curve_.heading) / curve_.curvature;
+        const double radius = std::hypot(xyz.x() - center.x(), xyz.y() - center.y());
+        half_range = distance < radius ? std::asin(distance / radius) / std::abs(curve_.curvature) : curve_.length;
+      }
+      const auto distance_at = [&](double u) {
+        return (xyz - DoToInertialPosition(ProjectOnCrossSection(xyz, u, bounds)).xyz()).norm();
+      };
+      // Golden-section search.
+      static constexpr double kInverseGoldenRatio{0.6180339887498949};
+      double lower = std::max(0., planar_u - half_range);
+      double upper = std::min(curve_.length, planar_u + half_range);
+      double lhs = upper - kInverseGoldenRatio * (upper - lower);
+      double rhs = lower + kInverseGoldenRatio * (upper - lower);
+      double lhs_distance = distance_at(lhs);
+      double rhs_distance = distance_at(rhs);
+      while (upper - lower > kProjectionTolerance) {
+        if (lhs_distance < rhs_distance) {
+          upper = rhs;
+          rhs = lhs;
+          rhs_distance = lhs_distance;
+          lhs = upper - kInverseGoldenRatio * (upper - lower);
+          lhs_distance = distance_at(lhs);
+        } else {
+          lower = lhs;
+          lhs = rhs;
+          lhs_distance = rhs_distance;
+          rhs = lower + kInverseGoldenRatio * (upper - lower);
+          rhs_distance = distance_at(rhs);
+        }
+      }
+      const LanePosition graded_lane_position = ProjectOnCrossSection(xyz, (lower + upper) / 2., bounds);
+      const double graded_distance = (xyz - DoToInertialPosition(graded_lane_position).xyz()).norm();
+      if (graded_distance < distance) {
+        lane_position = graded_lane_position;
+        distance = graded_distance;
+      }
+    }
+    return {lane_position, DoToInertialPosition(lane_position), distance};
+  }
+
+  // @returns The parameter of the point of the curve that is horizontally closest to @p xyz.
+  double PlanarProjection(const math::Vector3& xyz) const {
+    if (std::abs(curve_.curvature) < kStraightCurvature) {
+      return math::saturate((xyz - curve_.start).dot({std::cos(curve_.heading), std::sin(curve_.heading), 0.}), 0.,
+                            curve_.length);
+    }
+    const math::Vector3 center = curve_.start + Curve::Normal(curve_.heading) / curve_.curvature;
+    const double start_angle = std::atan2(curve_.start.y() - center.y(), curve_.start.x() - center.x());
+    const double angle = std::atan2(xyz.y() - center.y(), xyz.x() - center.x());
+    // Angle swept from the start in the direction of travel, in [0, 2 pi).
+    const double sign = curve_.curvature > 0. ? 1. : -1.;
+    double swept = std::fmod(sign * (angle - start_angle), 2. * kPi);
+    swept = swept < 0. ? swept + 2. * kPi : swept;
+    const double arc_angle = std::abs(curve_.curvature) * curve_.length;
+    if (swept <= arc_angle) {
+      return swept / std::abs(curve_.curvature);
+    }
+    return swept - arc_angle < 2. * kPi - swept ? curve_.length : 0.;
+  }
+
+  // @returns The lane position of the point of the cross section at @p u, limited laterally by @p bounds, that is
+  // closest to @p xyz.
+  LanePosition ProjectOnCrossSection(const math::Vector3& xyz, double u, const RBounds& bounds) const {
+    const math::Vector3 delta = xyz - curve_.PositionAt(u);
+    return {u * length_scale_,
+            math::saturate(delta.dot(Curve::Normal(curve_.HeadingAt(u))), bounds.min(), bounds.max()),
+            math::saturate(delta.z(), 0., kMaxHeight)};
+  }
+
+  const Curve curve_;
+  // Ratio between the lane length and the planar length of its curve.
+  const double length_scale_{};
+  const RBounds lane_bounds_;
+  const RBounds segment_bounds_;
+};
+
+// An intersection approach: the lanes entering an intersection with the same heading.
+struct Approach {
+  // Travel direction, in quarters of a turn from the x-axis.
+  int heading_index{};
+  TrafficLight::Id traffic_light_id{"unset"};
+  math::Vector3 traffic_light_position;
+  double traffic_light_yaw{};
+  // Lanes within the intersection that start at this approach.
+  std::vector<const ProceduralLane*> connecting_lanes;
+};
+
+// The intersections of the grid city, used to build the rules.
+struct IntersectionLayout {
+  std::string name;
+  std::vector<Approach> approaches;
+};
+
+void ValidateConfig(const ProceduralRoadNetworkConfig& config) {
+  MALIPUT_VALIDATE(config.lanes_per_direction > 0, "lanes_per_direction must be positive.");
+  MALIPUT_VALIDATE(config.lane_width > 0., "lane_width must be positive.");
+  MALIPUT_VALIDATE(config.speed_limit_zones_per_lane > 0, "speed_limit_zones_per_lane must be positive.");
+  if (config.layout == ProceduralRoadNetworkConfig::Layout::kGridCity) {
+    MALIPUT_VALIDATE(config.num_rows > 0 && config.num_columns > 0 && config.num_rows * config.num_columns >= 2,
+                     "The grid must have at least two intersections.");
+    MALIPUT_VALIDATE(config.block_length > 4. * (config.lanes_per_direction + 1) * config.lane_width,
+                     "block_length leaves no room for the roads between intersections.");
+  } else {
+    MALIPUT_VALIDATE(config.num_segments > 0, "num_segments must be positive.");
+    MALIPUT_VALIDATE(config.segment_length > 0., "segment_length must be positive.");
+    MALIPUT_VALIDATE(config.interchange_spacing >= 0, "interchange_spacing must not be negative.");
+    MALIPUT_VALIDATE(config.ramp_radius > 0., "ramp_radius must be positive.");
+    MALIPUT_VALIDATE(std::abs(config.curvature) * config.lanes_per_direction * config.lane_width < 1.,
+                     "curvature is too large for the width of the carriageways.");
+  }
+}
+
+// Builds the RoadGeometry described by a ProceduralRoadNetworkConfig.
+class Builder {
+ public:
+  explicit Builder(const ProceduralRoadNetworkConfig& config) : config_(config) { ValidateConfig(config_); }
+
+  // Builds the RoadGeometry and fills @p intersections, when it is not nullptr, with the intersections of the grid.
+  std::unique_ptr<geometry_base::RoadGeometry> Build(std::vector<IntersectionLayout>* intersections) {
+    rg_ = std::make_unique<geometry_base::RoadGeometry>(
+        RoadGeometryId(config_.layout == ProceduralRoadNetworkConfig::Layout::kGridCity ? "procedural_grid_city"
+                                                                                        : "procedural_highway"),
+        config_.linear_tolerance, config_.angular_tolerance, 1. /* scale_length */, math::Vector3{0., 0., 0.});
+    if (config_.layout == ProceduralRoadNetworkConfig::Layout::kGridCity) {
+      BuildGridCity(intersections);
+    } else {
+      BuildHighway();
+    }
+    return std::move(rg_);
+  }
+
+ private:
+  // A lane end, hashed to keep a BranchPoint per lane end.
+  using LaneEndKey = std::pair<const ProceduralLane*, LaneEnd::Which>;
+  struct LaneEndKeyHash {
+    std::size_t operator()(const LaneEndKey& key) const {
+      return std::hash<const void*>()(key.first) ^ static_cast<std::size_t>(key.second);
+    }
+  };
+
+  // @returns The lateral offset of the center of lane @p index from the reference line of a one-way road, which is
+  // the left edge of its leftmost lane.
+  double LaneOffset(int index) const {
+    return -(config_.lanes_per_direction - 1 - index + 0.5) * config_.lane_width;
+  }
+
+  geometry_base::Junction* AddJunction(const std::string& name) {
+    return rg_->AddJunction(std::make_unique<geometry_base::Junction>(JunctionId(name)));
+  }
+
+  // Adds a Segment to @p junction with lanes_per_direction lanes parallel to @p reference, on its right.
+  std::vector<ProceduralLane*> AddOneWaySegment(geometry_base::Junction* junction, const std::string& name,
+                                                const Curve& reference) {
+    auto segment = junction->AddSegment(std::make_unique<geometry_base::Segment>(SegmentId(name)));
+    const int num_lanes = config_.lanes_per_direction;
+    const double half_width = config_.lane_width / 2.;
+    std::vector<ProceduralLane*> lanes;
+    for (int i = 0; i < num_lanes; ++i) {
+      const RBounds segment_bounds{-half_width - i * config_.lane_width,
+                                   half_width + (num_lanes - 1 - i) * config_.lane_width};
+      lanes.push_back(segment->AddLane(std::make_unique<ProceduralLane>(
+          LaneId(name + "_" + std::to_string(i)), reference.Offset(LaneOffset(i)),
+          RBounds{-half_width, half_width}, segment_bounds)));
+    }
+    return lanes;
+  }
+
+  // Adds a Segment to @p junction with a single lane along @p curve.
+  ProceduralLane* AddSingleLaneSegment(geometry_base::Junction* junction, const std::string& name,
+                                       const Curve& curve) {
+    auto segment = junction->AddSegment(std::make_unique<geometry_base::Segment>(SegmentId(name)));
+    const RBounds bounds{-config_.lane_width / 2., config_.lane_width / 2.};
+    return segment->AddLane(std::make_unique<ProceduralLane>(LaneId(name + "_0"), curve, bounds, bounds));
+  }
+
+  // @returns The BranchPoint of @p lane's @p end, adding an empty one when it does not exist yet.
+  geometry_base::BranchPoint* GetOrAddBranchPoint(const ProceduralLane* lane, LaneEnd::Which end) {
+    geometry_base::BranchPoint* branch_point = FindBranchPoint(lane, end);
+    if (branch_point != nullptr) {
+      return branch_point;
+    }
+    branch_point = rg_->AddBranchPoint(
+        std::make_unique<geometry_base::BranchPoint>(BranchPointId("bp_" + std::to_string(branch_points_.size()))));
+    branch_points_.emplace(LaneEndKey{lane, end}, branch_point);
+    return branch_point;
+  }
+
+  // @returns The BranchPoint of @p lane's @p end, or nullptr when it has none yet.
+  geometry_base::BranchPoint* FindBranchPoint(const ProceduralLane* lane, LaneEnd::Which end) const {
+    const auto it = branch_points_.find({lane, end});
+    return it == branch_points_.end() ? nullptr : it->second;
+  }
+
+  // Connects @p from's finish with @p to's start, reusing the BranchPoint of either end when there is one.
+  void Connect(ProceduralLane* from, ProceduralLane* to) {
+    geometry_base::BranchPoint* from_branch_point = FindBranchPoint(from, LaneEnd::kFinish);
+    geometry_base::BranchPoint* to_branch_point = FindBranchPoint(to, LaneEnd::kStart);
+    if (from_branch_point == nullptr && to_branch_point == nullptr) {
+      from_branch_point = GetOrAddBranchPoint(from, LaneEnd::kFinish);
+      from_branch_point->AddABranch(from, LaneEnd::kFinish);
+    }
+    if (from_branch_point == nullptr) {
+      AttachA(to_branch_point, from, LaneEnd::kFinish);
+    } else if (to_branch_point == nullptr) {
+      AttachB(from_branch_point, to, LaneEnd::kStart);
+    } else {
+      MALIPUT_THROW_UNLESS(from_branch_point == to_branch_point);
+    }
+  }
+
+  // Adds A-side or B-side BranchPoints to lane ends that are not connected.
+  void CloseLaneEnds(const std::vector<ProceduralLane*>& lanes) {
+    for (ProceduralLane* lane : lanes) {
+      if (FindBranchPoint(lane, LaneEnd::kStart) == nullptr) {
+        GetOrAddBranchPoint(lane, LaneEnd::kStart)->AddBBranch(lane, LaneEnd::kStart);
+      }
+      if (FindBranchPoint(lane, LaneEnd::kFinish) == nullptr) {
+        GetOrAddBranchPoint(lane, LaneEnd::kFinish)->AddABranch(lane, LaneEnd::kFinish);
+      }
+    }
+  }
+
+  // Attaches @p lane's @p end on the A side of @p branch_point.
+  void AttachA(geometry_base::BranchPoint* branch_point, ProceduralLane* lane, LaneEnd::Which end) {
+    branch_point->AddABranch(lane, end);
+    branch_points_.emplace(LaneEndKey{lane, end}, branch_point);
+  }
+
+  // Attaches @p lane's @p end on the B side of @p branch_point.
+  void AttachB(geometry_base::BranchPoint* branch_point, ProceduralLane* lane, LaneEnd::Which end) {
+    branch_point->AddBBranch(lane, end);
+    branch_points_.emplace(LaneEndKey{lane, end}, branch_point);
+  }
+
+  void BuildGridCity(std::vector<IntersectionLayout>* intersections) {
+    const int n = config_.lanes_per_direction;
+    const double w = config_.lane_width;
+    const double b = config_.block_length;
+    // Half the side of the intersections, it leaves a lane width between the roads and the turns.
+    const double h = (n + 1) * w;
+    const int num_nodes = config_.num_rows * config_.num_columns;
+    const auto node_center = [&](int node) {
+      return math::Vector3{(node % config_.num_columns) * b, (node / config_.num_columns) * b, 0.};
+    };
+    const auto node_name = [&](int node) {
+      return std::to_string(node % config_.num_columns) + "_" + std::to_string(node / config_.num_columns);
+    };
+    const auto direction = [](int heading_index) {
+      return math::Vector3{std::cos(heading_index * kPi / 2.), std::sin(heading_index * kPi / 2.), 0.};
+    };
+
+    // Lanes entering and leaving each node, indexed by their heading.
+    std::vector<std::array<std::vector<ProceduralLane*>, 4>> incoming(num_nodes);
+    std::vector<std::array<std::vector<ProceduralLane*>, 4>> outgoing(num_nodes);
+    for (int node = 0; node < num_nodes; ++node) {
+      const int column = node % config_.num_columns;
+      const int row = node / config_.num_columns;
+      for (const int heading_index : {0, 1}) {
+        if ((heading_index == 0 && column + 1 >= config_.num_columns) ||
+            (heading_index == 1 && row + 1 >= config_.num_rows)) {
+          continue;
+        }
+        const int next_node = heading_index == 0 ? node + 1 : node + config_.num_columns;
+        const std::string name = "road_" + node_name(node) + "_" + kHeadingNames[heading_index];
+        geometry_base::Junction* junction = AddJunction(name);
+        const Curve reference{node_center(node) + h * direction(heading_index), heading_index * kPi / 2., 0.,
+                              b - 2. * h, 0.};
+        const std::vector<ProceduralLane*> forward = AddOneWaySegment(junction, name + "_forward", reference);
+        const std::vector<ProceduralLane*> backward =
+            AddOneWaySegment(junction, name + "_backward", reference.Reversed());
+        outgoing[node][heading_index] = forward;
+        incoming[next_node][heading_index] = forward;
+        outgoing[next_node][heading_index + 2] = backward;
+        incoming[node][heading_index + 2] = backward;
+      }
+    }
+
+    for (int node = 0; node < num_nodes; ++node) {
+      IntersectionLayout layout{"intersection_" + node_name(node), {}};
+      geometry_base::Junction* junction = AddJunction(layout.name);
+      for (int heading_index = 0; heading_index < 4; ++heading_index) {
+        const std::vector<ProceduralLane*>& approach_lanes = incoming[node][heading_index];
+        if (approach_lanes.empty()) {
+          continue;
+        }
+        const double heading = heading_index * kPi / 2.;
+        const math::Vector3 forward = direction(heading_index);
+        const math::Vector3 left = Curve::Normal(heading);
+        // Maps the coordinates of the approach frame, whose x-axis points in the direction of travel, to the
+        // Inertial Frame.
+        const auto to_inertial = [&](double x, double y) { return node_center(node) + x * forward + y * left; };
+        const std::string prefix = layout.name + "_from_" + kHeadingNames[(heading_index + 2) % 4];
+        Approach approach;
+        approach.heading_index = heading_index;
+        approach.traffic_light_id = TrafficLight::Id("tl_" + prefix);
+        approach.traffic_light_position =
+            to_inertial(-h, -n * w - w / 2.) + kTrafficLightHeight * math::Vector3::UnitZ();
+        approach.traffic_light_yaw = heading + kPi;
+
+        // Straight through.
+        const std::vector<ProceduralLane*>& straight_targets = outgoing[node][heading_index];
+        if (!straight_targets.empty()) {
+          const std::vector<ProceduralLane*> lanes =
+              AddOneWaySegment(junction, prefix + "_straight", Curve{to_inertial(-h, 0.), heading, 0., 2. * h, 0.});
+          for (int i = 0; i < n; ++i) {
+            Connect(approach_lanes[i], lanes[i]);
+            Connect(lanes[i], straight_targets[i]);
+            approach.connecting_lanes.push_back(lanes[i]);
+          }
+        }
+        // Right turn, from and to the rightmost lanes.
+        const std::vector<ProceduralLane*>& right_targets = outgoing[node][(heading_index + 3) % 4];
+        if (!right_targets.empty()) {
+          const double radius = h + LaneOffset(0);
+          ProceduralLane* lane = AddSingleLaneSegment(
+              junction, prefix + "_right", Curve{to_inertial(-h, LaneOffset(0)), heading, -1. / radius,
+                                                 kPi / 2. * radius, 0.});
+          Connect(approach_lanes.front(), lane);
+          Connect(lane, right_targets.front());
+          approach.connecting_lanes.push_back(lane);
+        }
+        // Left turn, from and to the leftmost lanes.
+        const std::vector<ProceduralLane*>& left_targets = outgoing[node][(heading_index + 1) % 4];
+        if (!left_targets.empty()) {
+          const double radius = h - LaneOffset(n - 1);
+          ProceduralLane* lane = AddSingleLaneSegment(
+              junction, prefix + "_left", Curve{to_inertial(-h, LaneOffset(n - 1)), heading, 1. / radius,
+                                                kPi / 2. * radius, 0.});
+          Connect(approach_lanes.back(), lane);
+          Connect(lane, left_targets.back());
+          approach.connecting_lanes.push_back(lane);
+        }
+        layout.approaches.push_back(std::move(approach));
+      }
+      if (intersections != nullptr) {
+        intersections->push_back(std::move(layout));
+      }
+    }
+    // Roads leading to intersections without connections in some direction still need their BranchPoints.
+    for (int node = 0; node < num_nodes; ++node) {
+      for (int heading_index = 0; heading_index < 4; ++heading_index) {
+        CloseLaneEnds(incoming[node][heading_index]);
+      }
+    }
+  }
+
+  void BuildHighway() {
+    const int n = config_.lanes_per_direction;
+    std::vector<std::vector<ProceduralLane*>> forward(config_.num_segments);
+    std::vector<std::vector<ProceduralLane*>> backward(config_.num_segments);
+    Curve reference{math::Vector3{0., 0., 0.}, 0., config_.curvature, config_.segment_length, config_.grade};
+    for (int k = 0; k < config_.num_segments; ++k) {
+      // Alternates left and right turns so the highway does not close on itself.
+      reference.curvature = k % 2 == 0 ? config_.curvature : -config_.curvature;
+      const std::string name = "highway_" + std::to_string(k);
+      geometry_base::Junction* junction = AddJunction(name);
+      forward[k] = AddOneWaySegment(junction, name + "_forward", reference);
+      backward[k] = AddOneWaySegment(junction, name + "_backward", reference.Reversed());
+      reference = Curve{reference.PositionAt(reference.length), reference.HeadingAt(reference.length), 0.,
+                        config_.segment_length, config_.grade};
+    }
+    for (int k = 0; k + 1 < config_.num_segments; ++k) {
+      for (int i = 0; i < n; ++i) {
+        Connect(forward[k][i], forward[k + 1][i]);
+        Connect(backward[k + 1][i], backward[k][i]);
+      }
+    }
+
+    for (int k = 1; config_.interchange_spacing > 0 && k < config_.num_segments; ++k) {
+      if (k % config_.interchange_spacing != 0) {
+        continue;
+      }
+      const std::string name = "interchange_" + std::to_string(k);
+      geometry_base::Junction* junction = AddJunction(name);
+      const double radius = config_.ramp_radius;
+      const double ramp_length = kPi / 2. * radius;
+      // The exit ramp continues the rightmost lane of the next Junction, turning right.
+      const Curve& next_curve = forward[k].front()->curve();
+      ProceduralLane* exit_ramp = AddSingleLaneSegment(
+          junction, name + "_exit",
+          Curve{next_curve.start, next_curve.heading, -1. / radius, ramp_length, next_curve.grade});
+      // The entrance ramp comes from the right and ends where the rightmost lane of the previous Junction ends,
+      // so it is built backwards from there.
+      const Curve& previous_curve = forward[k - 1].front()->curve();
+      const Curve backwards{previous_curve.PositionAt(previous_curve.length),
+                            previous_curve.HeadingAt(previous_curve.length) + kPi, -1. / radius, ramp_length,
+                            -previous_curve.grade};
+      ProceduralLane* entrance_ramp = AddSingleLaneSegment(junction, name + "_entrance", backwards.Reversed());
+      // Both ramps share the BranchPoint between the rightmost lanes of the Junctions.
+      geometry_base::BranchPoint* branch_point = GetOrAddBranchPoint(forward[k - 1].front(), LaneEnd::kFinish);
+      AttachA(branch_point, entrance_ramp, LaneEnd::kFinish);
+      AttachB(branch_point, exit_ramp, LaneEnd::kStart);
+      CloseLaneEnds({exit_ramp, entrance_ramp});
+    }
+    for (int k = 0; k < config_.num_segments; ++k) {
+      CloseLaneEnds(forward[k]);
+      CloseLaneEnds(backward[k]);
+    }
+  }
+
+  const ProceduralRoadNetworkConfig config_;
+  std::unique_ptr<geometry_base::RoadGeometry> rg_;
+  std::unordered_map<LaneEndKey, geometry_base::BranchPoint*, LaneEndKeyHash> branch_points_;
+};
+
+// Adds the speed limit and direction usage rules of every lane in @p rg to @p rulebook.
+void AddLaneRules(const ProceduralRoadNetworkConfig& config, const RoadGeometry* rg, ManualRulebook* rulebook) {
+  const RangeValueRule::Range speed_limit{Rule::State::kStrict, {}, {}, "Procedural speed limit", 0.,
+                                          config.speed_limit};
+  const DiscreteValueRule::DiscreteValue with_s{Rule::State::kStrict, {}, {}, "WithS"};
+  for (int j = 0; j < rg->num_junctions(); ++j) {
+    const Junction* junction = rg->junction(j);
+    for (int s = 0; s < junction->num_segments(); ++s) {
+      const Segment* segment = junction->segment(s);
+      for (int l = 0; l < segment->num_lanes(); ++l) {
+        const Lane* lane = segment->lane(l);
+        const std::string lane_id = lane->id().string();
+        const double zone_length = lane->length() / config.speed_limit_zones_per_lane;
+        for (int z = 0; z < config.speed_limit_zones_per_lane; ++z) {
+          rulebook->AddRule(RangeValueRule(
+              Rule::Id(SpeedLimitRuleTypeId().string() + "/" + lane_id + "_" + std::to_string(z)),
+              SpeedLimitRuleTypeId(), LaneSRoute({LaneSRange(lane->id(), {z * zone_length, (z + 1) * zone_length})}),
+              {speed_limit}));
+        }
+        rulebook->AddRule(DiscreteValueRule(Rule::Id(DirectionUsageRuleTypeId().string() + "/" + lane_id),
+                                            DirectionUsageRuleTypeId(),
+                                            LaneSRoute({LaneSRange(lane->id(), {0., lane->length()})}), {with_s}));
+      }
+    }
+  }
+}
+
+// @returns The traffic light of @p approach.
+std::unique_ptr<TrafficLight> MakeTrafficLight(const Approach& approach) {
+  std::vector<std::unique_ptr<rules::Bulb>> bulbs;
+  const std::vector<rules::BulbState> states{rules::BulbState::kOff, rules::BulbState::kOn};
+  bulbs.push_back(std::make_unique<rules::Bulb>(rules::Bulb::Id("red"), InertialPosition(0., 0., 0.4), Rotation(),
+                                                rules::BulbColor::kRed, rules::BulbType::kRound, std::nullopt,
+                                                states));
+  bulbs.push_back(std::make_unique<rules::Bulb>(rules::Bulb::Id("yellow"), InertialPosition(0., 0., 0.), Rotation(),
+                                                rules::BulbColor::kYellow, rules::BulbType::kRound, std::nullopt,
+                                                states));
+  bulbs.push_back(std::make_unique<rules::Bulb>(rules::Bulb::Id("green"), InertialPosition(0., 0., -0.4),
+                                                Rotation(), rules::BulbColor::kGreen, rules::BulbType::kRound,
+                                                std::nullopt, states));
+  std::vector<std::unique_ptr<BulbGroup>> bulb_groups;
+  bulb_groups.push_back(
+      std::make_unique<BulbGroup>(BulbGroup::Id("bulb_group"), InertialPosition(), Rotation(), std::move(bulbs)));
+  return std::make_unique<TrafficLight>(approach.traffic_light_id,
+                                        InertialPosition::FromXyz(approach.traffic_light_position),
+                                        Rotation::FromRpy(0., 0., approach.traffic_light_yaw), std::move(bulb_groups));
+}
+
+}  // namespace
+
+std::unique_ptr<geometry_base::RoadGeometry> CreateProceduralRoadGeometry(const ProceduralRoadNetworkConfig& config) {
+  return Builder(config).Build(nullptr);
+}
+
+std::unique_ptr<RoadNetwork> CreateProceduralRoadNetwork(const ProceduralRoadNetworkConfig& config) {
+  std::vector<IntersectionLayout> intersection_layouts;
+  std::unique_ptr<geometry_base::RoadGeometry> rg = Builder(config).Build(&intersection_layouts);
+
+  auto rulebook = std::make_unique<ManualRulebook>();
+  auto traffic_light_book = std::make_unique<TrafficLightBook>();
+  auto phase_ring_book = std::make_unique<ManualPhaseRingBook>();
+  auto phase_provider = std::make_unique<ManualPhaseProvider>();
+  auto intersection_book = std::make_unique<maliput::IntersectionBook>(rg.get());
+  AddLaneRules(config, rg.get(), rulebook.get());
+
+  const BulbGroup::Id bulb_group_id("bulb_group");
+  const auto bulb_id = [&](const Approach& approach, const char* bulb) {
+    return rules::UniqueBulbId(approach.traffic_light_id, bulb_group_id, rules::Bulb::Id(bulb));
+  };
+  for (const IntersectionLayout& layout : intersection_layouts) {
+    std::vector<LaneSRange> region;
+    // States of the rules and bulbs for the phases where north-south and east-west approaches go.
+    rules::DiscreteValueRuleStates north_south_rule_states;
+    rules::DiscreteValueRuleStates east_west_rule_states;
+    rules::BulbStates north_south_bulb_states;
+    rules::BulbStates east_west_bulb_states;
+    for (const Approach& approach : layout.approaches) {
+      traffic_light_book->AddTrafficLight(MakeTrafficLight(approach));
+      const Rule::RelatedRules related_rules{{RelatedRulesKeys::kYieldGroup, {}}};
+      const Rule::RelatedUniqueIds related_unique_ids{
+          {RelatedUniqueIdsKeys::kBulbGroup, {rules::UniqueBulbGroupId(approach.traffic_light_id, bulb_group_id)}}};
+      const DiscreteValueRule::DiscreteValue go{Rule::State::kStrict, related_rules, related_unique_ids, "Go"};
+      const DiscreteValueRule::DiscreteValue stop{Rule::State::kStrict, related_rules, related_unique_ids, "Stop"};
+      const bool is_north_south = approach.heading_index % 2 == 1;
+      for (const ProceduralLane* lane : approach.connecting_lanes) {
+        const LaneSRange lane_s_range(lane->id(), {0., lane->length()});
+        region.push_back(lane_s_range);
+        const Rule::Id rule_id(RightOfWayRuleTypeId().string() + "/" + lane->id().string());
+        rulebook->AddRule(DiscreteValueRule(rule_id, RightOfWayRuleTypeId(), LaneSRoute({lane_s_range}), {go, stop}));
+        north_south_rule_states.emplace(rule_id, is_north_south ? go : stop);
+        east_west_rule_states.emplace(rule_id, is_north_south ? stop : go);
+      }
+      for (const char* bulb : {"red", "yellow", "green"}) {
+        const bool is_green = std::string(bulb) == "green";
+        const bool is_red = std::string(bulb) == "red";
+        const auto go_state = is_green ? rules::BulbState::kOn : rules::BulbState::kOff;
+        const auto stop_state = is_red ? rules::BulbState::kOn : rules::BulbState::kOff;
+        north_south_bulb_states.emplace(bulb_id(approach, bulb), is_north_south ? go_state : stop_state);
+        east_west_bulb_states.emplace(bulb_id(approach, bulb), is_north_south ? stop_state : go_state);
+      }
+    }
+    const Phase::Id north_south_id("north_south_go");
+    const Phase::Id east_west_id("east_west_go");
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+    const std::vector<Phase> phases{Phase(north_south_id, {}, north_south_rule_states, north_south_bulb_states),
+                                    Phase(east_west_id, {}, east_west_rule_states, east_west_bulb_states)};
+#pragma GCC diagnostic pop
+    const std::unordered_map<Phase::Id, std::vector<PhaseRing::NextPhase>> next_phases{
+        {north_south_id, {{east_west_id, config.phase_duration}}},
+        {east_west_id, {{north_south_id, config.phase_duration}}}};
+    const PhaseRing ring(PhaseRing::Id("ring_" + layout.name), phases, next_phases);
+    phase_ring_book->AddPhaseRing(ring);
+    phase_provider->AddPhaseRing(ring.id(), north_south_id, east_west_id, config.phase_duration);
+    intersection_book->AddIntersection(
+        std::make_unique<maliput::Intersection>(Intersection::Id(layout.name), region, ring, phase_provider.get()));
+  }
+
+  auto rule_registry = std::make_unique<rules::RuleRegistry>();
+  for (const rules::DiscreteValueRuleTypeAndValues& rule_type :
+       {BuildRightOfWayRuleType(), BuildDirectionUsageRuleType()}) {
+    rule_registry->RegisterDiscreteValueRule(rule_type.first, rule_type.second);
+  }
+  rule_registry->RegisterRangeValueRule(
+      SpeedLimitRuleTypeId(),
+      {RangeValueRule::Range{Rule::State::kStrict, {}, {}, "Procedural speed limit", 0., config.speed_limit}});
+
+  auto discrete_value_rule_state_provider = PhasedDiscreteRuleStateProvider::GetDefaultPhasedDiscreteRuleStateProvider(
+      rulebook.get(), phase_ring_book.get(), phase_provider.get());
+  auto range_value_rule_state_provider =
+      ManualRangeValueRuleStateProvider::GetDefaultManualRangeValueRuleStateProvider(rulebook.get());
+  return std::make_unique<RoadNetwork>(std::move(rg), std::move(rulebook), std::move(traffic_light_book),
+                                       std::move(intersection_book), std::move(phase_ring_book),
+                                       std::move(phase_provider), std::move(rule_registry),
+                                       std::move(discrete_value_rule_state_provider),
+                                       std::move(range_value_rule_state_provider));
+}
+
+}  // namespace test
+}  // namespace api
+}  // namespace maliput
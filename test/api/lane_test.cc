@@ -38,6 +38,7 @@
 #include "maliput/geometry_base/road_geometry.h"
 #include "maliput/test_utilities/mock.h"
 #include "maliput/test_utilities/mock_geometry.h"
+#include "maliput/test_utilities/procedural_road_network.h"
 
 using ::testing::An;
 using ::testing::Invoke;
@@ -147,6 +148,37 @@ TEST_F(LaneTest, Contains) {
   }
 }
 
+// The default batch conversions match the single-point ones.
+GTEST_TEST(LaneBatchTest, MatchesSinglePointConversions) {
+  ProceduralRoadNetworkConfig config;
+  config.layout = ProceduralRoadNetworkConfig::Layout::kHighway;
+  config.num_segments = 1;
+  config.curvature = 1e-2;
+  config.grade = 0.05;
+  const std::unique_ptr<geometry_base::RoadGeometry> rg = CreateProceduralRoadGeometry(config);
+  const Lane* dut = rg->junction(0)->segment(0)->lane(0);
+
+  const std::vector<LanePosition> lane_positions{{0., 0., 0.}, {10., 1., 2.}, {dut->length(), -1., 0.5}};
+  const std::vector<InertialPosition> inertial_positions = dut->ToInertialPositions(lane_positions);
+  const std::vector<Rotation> orientations = dut->GetOrientations(lane_positions);
+  const std::vector<LanePositionResult> results = dut->ToLanePositions(inertial_positions);
+  ASSERT_EQ(inertial_positions.size(), lane_positions.size());
+  ASSERT_EQ(orientations.size(), lane_positions.size());
+  ASSERT_EQ(results.size(), lane_positions.size());
+  for (std::size_t i = 0; i < lane_positions.size(); ++i) {
+    EXPECT_EQ(inertial_positions[i], dut->ToInertialPosition(lane_positions[i]));
+    EXPECT_EQ(orientations[i].quat().coeffs(), dut->GetOrientation(lane_positions[i]).quat().coeffs());
+    const LanePositionResult expected = dut->ToLanePosition(inertial_positions[i]);
+    EXPECT_EQ(results[i].lane_position.srh(), expected.lane_position.srh());
+    EXPECT_EQ(results[i].nearest_position, expected.nearest_position);
+    EXPECT_EQ(results[i].distance, expected.distance);
+  }
+
+  EXPECT_TRUE(dut->ToInertialPositions({}).empty());
+  EXPECT_TRUE(dut->GetOrientations({}).empty());
+  EXPECT_TRUE(dut->ToLanePositions({}).empty());
+}
+
 }  // namespace
 }  // namespace test
 }  // namespace api
@@ -41,6 +41,7 @@
 #include "maliput/common/assertion_error.h"
 #include "maliput/common/maliput_throw.h"
 #include "maliput/test_utilities/mock.h"
+#include "maliput/test_utilities/procedural_road_network.h"
 
 namespace maliput {
 namespace api {
@@ -427,6 +428,61 @@ TEST_P(RelatedRulesTest, ChecksRelatedRules) {
 
 INSTANTIATE_TEST_CASE_P(RelatedRulesTestGroup, RelatedRulesTest, ::testing::ValuesIn(RelatedRulesTestParameters()));
 
+// The procedural road networks have no DirectionUsageRules, so every Lane is a violation.
+GTEST_TEST(CheckRoadNetworkTest, ReportsAllViolations) {
+  ProceduralRoadNetworkConfig config;
+  config.num_rows = 3;
+  config.num_columns = 3;
+  const std::unique_ptr<RoadNetwork> road_network = CreateProceduralRoadNetwork(config);
+  const int num_lanes = static_cast<int>(road_network->road_geometry()->ById().GetLanes().size());
+
+  const RoadNetworkValidationReport dut = CheckRoadNetwork(*road_network, RoadNetworkValidatorOptions{});
+  EXPECT_FALSE(dut.is_valid());
+  ASSERT_EQ(dut.checks.size(), 8u);
+  EXPECT_EQ(dut.checks[0].name, "check_direction_usage_rule_coverage");
+  EXPECT_EQ(static_cast<int>(dut.checks[0].violations.size()), num_lanes);
+  EXPECT_EQ(static_cast<int>(dut.violations().size()), num_lanes);
+  EXPECT_EQ(dut.violations()[0].find("check_direction_usage_rule_coverage: Lane(id: "), 0u);
+  for (std::size_t i = 1; i < dut.checks.size(); ++i) {
+    EXPECT_TRUE(dut.checks[i].violations.empty()) << dut.checks[i].name;
+  }
+  for (const RoadNetworkCheckResult& check : dut.checks) {
+    EXPECT_GE(check.duration.count(), 0.);
+  }
+  EXPECT_GT(dut.duration.count(), 0.);
+
+  // Only the enabled checks are reported.
+  RoadNetworkValidatorOptions options;
+  options.check_direction_usage_rule_coverage = false;
+  options.check_road_geometry_invariants = false;
+  const RoadNetworkValidationReport valid = CheckRoadNetwork(*road_network, options);
+  EXPECT_TRUE(valid.is_valid());
+  ASSERT_EQ(valid.checks.size(), 6u);
+  EXPECT_EQ(valid.checks[0].name, "check_road_geometry_hierarchy");
+  EXPECT_NO_THROW(ValidateRoadNetwork(*road_network, options));
+}
+
+GTEST_TEST(CheckRoadNetworkTest, ParallelMatchesSerial) {
+  ProceduralRoadNetworkConfig config;
+  config.num_rows = 4;
+  config.num_columns = 4;
+  const std::unique_ptr<RoadNetwork> road_network = CreateProceduralRoadNetwork(config);
+  const RoadNetworkValidationReport expected = CheckRoadNetwork(*road_network, RoadNetworkValidatorOptions{});
+  for (const std::size_t num_threads : {2u, 3u, 8u}) {
+    RoadNetworkValidatorOptions options;
+    options.num_threads = num_threads;
+    const RoadNetworkValidationReport dut = CheckRoadNetwork(*road_network, options);
+    ASSERT_EQ(dut.checks.size(), expected.checks.size());
+    for (std::size_t i = 0; i < dut.checks.size(); ++i) {
+      EXPECT_EQ(dut.checks[i].name, expected.checks[i].name);
+      EXPECT_EQ(dut.checks[i].violations, expected.checks[i].violations);
+    }
+  }
+  RoadNetworkValidatorOptions options;
+  options.num_threads = 0;
+  EXPECT_THROW(CheckRoadNetwork(*road_network, options), common::assertion_error);
+}
+
 }  // namespace
 }  // namespace test
 }  // namespace api
@@ -183,6 +183,9 @@ GTEST_TEST(RoadRulebookTest, ExerciseInterface) {
 
   EXPECT_EQ(dut.GetRangeValueRule(dut.kRangeValueRule.id()).id(), dut.kRangeValueRule.id());
   EXPECT_THROW(dut.GetRangeValueRule(Rule::Id("xxx")), std::out_of_range);
+
+  // Changes are not tracked by default.
+  EXPECT_EQ(dut.revision(), std::nullopt);
 }
 
 }  // namespace
@@ -84,6 +84,34 @@ GTEST_TEST(TypeSpecificIdentifierTest, CopyingAndAssignment) {
   EXPECT_TRUE(dut1 == dut3);
 }
 
+GTEST_TEST(TypeSpecificIdentifierTest, SharedString) {
+  EXPECT_EQ(sizeof(CId), sizeof(void*));
+  const CId dut1("a string that does not fit in the small string buffer");
+  const CId dut2(std::string("a string that does not fit ") + "in the small string buffer");
+  // Identifiers constructed from a string don't share it, but copies do.
+  EXPECT_NE(&dut1.string(), &dut2.string());
+  EXPECT_EQ(dut1, dut2);
+  const CId dut3(dut1);
+  EXPECT_EQ(&dut1.string(), &dut3.string());
+  // The cached hash matches the one of the string.
+  EXPECT_EQ(std::hash<CId>{}(dut1), maliput::common::DefaultHash{}(dut1.string()));
+  EXPECT_EQ(std::hash<CId>{}(dut1), maliput::common::DefaultHash{}(dut1));
+  EXPECT_EQ(std::hash<CId>{}(dut1), std::hash<CId>{}(dut2));
+}
+
+GTEST_TEST(TypeSpecificIdentifierTest, Interned) {
+  EXPECT_THROW(CId::Interned(""), maliput::common::assertion_error);
+  const CId dut1 = CId::Interned("a string that does not fit in the small string buffer");
+  const CId dut2 = CId::Interned(std::string("a string that does not fit ") + "in the small string buffer");
+  const CId dut3("a string that does not fit in the small string buffer");
+  // Interned identifiers share the interned string.
+  EXPECT_EQ(&dut1.string(), &dut2.string());
+  EXPECT_EQ(dut1, dut2);
+  // They are equal to identifiers that are not interned.
+  EXPECT_EQ(dut1, dut3);
+  EXPECT_EQ(std::hash<CId>{}(dut1), std::hash<CId>{}(dut3));
+}
+
 GTEST_TEST(TypeSpecificIdentifierTest, StreamOperator) {
   const CId dut("x");
   std::stringstream ss;
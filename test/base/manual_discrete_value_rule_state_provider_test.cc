@@ -31,6 +31,7 @@
 
 #include <map>
 #include <stdexcept>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -148,6 +149,46 @@ api::rules::Rule::RelatedRules CreateRightOfWayRelatedRules() {
   };
 }
 
+TEST_F(ManualDiscreteRuleStateProviderTest, BulkStates) {
+  ManualDiscreteValueRuleStateProvider dut(road_rulebook_.get());
+  EXPECT_THROW(dut.GetAllStates(nullptr), maliput::common::assertion_error);
+  EXPECT_THROW(dut.GetStatesChangedSince(0, nullptr), maliput::common::assertion_error);
+  EXPECT_TRUE(dut.rule_ids().empty());
+  EXPECT_TRUE(dut.GetAllStates().states.empty());
+
+  dut.SetState(kRuleId, kStateA, {kStateB}, {kDurationUntil});
+  ASSERT_EQ(dut.rule_ids(), std::vector<Rule::Id>{kRuleId});
+  const ManualDiscreteValueRuleStateProvider::StatesSnapshot snapshot = dut.GetAllStates();
+  ASSERT_EQ(snapshot.states.size(), 1u);
+  ASSERT_TRUE(snapshot.states[0].has_value());
+  EXPECT_TRUE(AssertCompare(IsEqual(snapshot.states[0]->state, kStateA)));
+  ASSERT_TRUE(snapshot.states[0]->next.has_value());
+  EXPECT_TRUE(AssertCompare(IsEqual(snapshot.states[0]->next->state, kStateB)));
+  EXPECT_EQ(snapshot.states[0]->next->duration_until, kDurationUntil);
+
+  ManualDiscreteValueRuleStateProvider::StateChanges changes;
+  dut.GetStatesChangedSince(0, &changes);
+  EXPECT_EQ(changes.version, snapshot.version);
+  EXPECT_EQ(changes.indices, std::vector<std::size_t>{0});
+  dut.GetStatesChangedSince(snapshot.version, &changes);
+  EXPECT_EQ(changes.version, snapshot.version);
+  EXPECT_TRUE(changes.indices.empty());
+
+  // Setting the same state again is not a change.
+  dut.SetState(kRuleId, kStateA, {kStateB}, {kDurationUntil});
+  dut.GetStatesChangedSince(snapshot.version, &changes);
+  EXPECT_TRUE(changes.indices.empty());
+
+  dut.SetState(kRuleId, kStateA, {kStateB}, {2. * kDurationUntil});
+  dut.GetStatesChangedSince(snapshot.version, &changes);
+  EXPECT_GT(changes.version, snapshot.version);
+  EXPECT_EQ(changes.indices, std::vector<std::size_t>{0});
+  ASSERT_EQ(changes.states.size(), 1u);
+  ASSERT_TRUE(changes.states[0].has_value());
+  EXPECT_EQ(changes.states[0]->next->duration_until, 2. * kDurationUntil);
+  EXPECT_EQ(dut.GetAllStates().version, changes.version);
+}
+
 class GetCurrentYieldGroupTest : public ::testing::Test {
  protected:
   const Rule::TypeId kTypeId{RightOfWayRuleTypeId()};
@@ -31,6 +31,7 @@
 
 #include <optional>
 #include <stdexcept>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -39,6 +40,7 @@
 #include "maliput/api/rules/phase_ring.h"
 #include "maliput/api/rules/right_of_way_rule.h"
 #include "maliput/api/rules/rule.h"
+#include "maliput/common/assertion_error.h"
 
 namespace maliput {
 namespace {
@@ -101,6 +103,96 @@ TEST_F(ManualPhaseRingBookTest, BasicTest) {
   }
 }
 
+TEST_F(ManualPhaseRingBookTest, Views) {
+  ManualPhaseRingBook dut;
+  const PhaseRing::Id unknown_ring_id("unknown ring");
+  EXPECT_EQ(dut.GetPhaseRingView(ring_id), nullptr);
+  dut.AddPhaseRing(ring);
+  const PhaseRing* result = dut.GetPhaseRingView(ring_id);
+  ASSERT_NE(result, nullptr);
+  EXPECT_EQ(result->id(), ring_id);
+  EXPECT_EQ(static_cast<int>(result->phases().size()), 1);
+  EXPECT_EQ(dut.GetPhaseRingView(unknown_ring_id), nullptr);
+  for (const auto rule_id : {rule_id_a, rule_id_b}) {
+    // Views point to the ring stored in the book.
+    EXPECT_EQ(dut.FindPhaseRingView(rule_id), result);
+  }
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+  for (const auto rule_id : {row_rule_id_a, row_rule_id_b}) {
+    EXPECT_EQ(dut.FindPhaseRingView(rule_id), result);
+  }
+  EXPECT_EQ(dut.FindPhaseRingView(RightOfWayRule::Id("unknown rule")), nullptr);
+#pragma GCC diagnostic pop
+  EXPECT_EQ(dut.FindPhaseRingView(Rule::Id("unknown rule")), nullptr);
+  dut.RemovePhaseRing(ring_id);
+  EXPECT_EQ(dut.GetPhaseRingView(ring_id), nullptr);
+  EXPECT_EQ(dut.FindPhaseRingView(rule_id_a), nullptr);
+}
+
+// Verifies that the api::rules::PhaseRingBook views hand out the stored ring
+// without copying it into the storage.
+TEST_F(ManualPhaseRingBookTest, PhaseRingBookViews) {
+  ManualPhaseRingBook manual_phase_ring_book;
+  manual_phase_ring_book.AddPhaseRing(ring);
+  const PhaseRing* expected_ring = manual_phase_ring_book.GetPhaseRingView(ring_id);
+  const api::rules::PhaseRingBook& dut = manual_phase_ring_book;
+  std::optional<PhaseRing> storage;
+  EXPECT_EQ(dut.GetPhaseRingView(ring_id, &storage), expected_ring);
+  EXPECT_EQ(dut.FindPhaseRingView(rule_id_a, &storage), expected_ring);
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+  EXPECT_EQ(dut.FindPhaseRingView(row_rule_id_a, &storage), expected_ring);
+#pragma GCC diagnostic pop
+  EXPECT_FALSE(storage.has_value());
+  EXPECT_EQ(dut.GetPhaseRingView(PhaseRing::Id("unknown ring"), &storage), nullptr);
+  EXPECT_THROW(dut.GetPhaseRingView(ring_id, nullptr), common::assertion_error);
+}
+
+// A PhaseRingBook that relies on the default api::rules::PhaseRingBook views.
+class CopyingPhaseRingBook : public api::rules::PhaseRingBook {
+ public:
+  explicit CopyingPhaseRingBook(const ManualPhaseRingBook* book) : book_(book) {}
+
+ private:
+  std::vector<PhaseRing::Id> DoGetPhaseRings() const override { return book_->GetPhaseRings(); }
+  std::optional<PhaseRing> DoGetPhaseRing(const PhaseRing::Id& ring_id) const override {
+    return book_->GetPhaseRing(ring_id);
+  }
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+  std::optional<PhaseRing> DoFindPhaseRing(const RightOfWayRule::Id& rule_id) const override {
+    return book_->FindPhaseRing(rule_id);
+  }
+#pragma GCC diagnostic pop
+  std::optional<PhaseRing> DoFindPhaseRing(const Rule::Id& rule_id) const override {
+    return book_->FindPhaseRing(rule_id);
+  }
+
+  const ManualPhaseRingBook* book_{};
+};
+
+// Verifies that the default api::rules::PhaseRingBook views copy the ring
+// into the storage.
+TEST_F(ManualPhaseRingBookTest, DefaultPhaseRingBookViews) {
+  ManualPhaseRingBook manual_phase_ring_book;
+  manual_phase_ring_book.AddPhaseRing(ring);
+  const CopyingPhaseRingBook dut(&manual_phase_ring_book);
+  std::optional<PhaseRing> storage;
+  const PhaseRing* result = dut.GetPhaseRingView(ring_id, &storage);
+  ASSERT_TRUE(storage.has_value());
+  EXPECT_EQ(result, &storage.value());
+  EXPECT_EQ(result->id(), ring_id);
+  EXPECT_EQ(dut.FindPhaseRingView(rule_id_b, &storage), &storage.value());
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+  EXPECT_EQ(dut.FindPhaseRingView(row_rule_id_b, &storage), &storage.value());
+  EXPECT_EQ(dut.FindPhaseRingView(RightOfWayRule::Id("unknown rule"), &storage), nullptr);
+#pragma GCC diagnostic pop
+  EXPECT_EQ(dut.FindPhaseRingView(Rule::Id("unknown rule"), &storage), nullptr);
+  EXPECT_FALSE(storage.has_value());
+}
+
 // Verifies that an exception is thrown when the user attempts to add a
 // different PhaseRing that has the same ID as a previously added PhaseRing.
 TEST_F(ManualPhaseRingBookTest, RingWithSameId) {
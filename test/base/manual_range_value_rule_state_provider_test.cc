@@ -30,6 +30,7 @@
 #include "maliput/base/manual_range_value_rule_state_provider.h"
 
 #include <stdexcept>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -130,6 +131,36 @@ TEST_F(ManualRangeValueRuleStateProviderTest, GetStateByRoadPositionAndRuleType)
   EXPECT_EQ(result->next->duration_until.value(), kDurationUntil);
 }
 
+TEST_F(ManualRangeValueRuleStateProviderTest, BulkStates) {
+  ManualRangeValueRuleStateProvider dut(road_rulebook_.get());
+  EXPECT_THROW(dut.GetAllStates(nullptr), maliput::common::assertion_error);
+  EXPECT_THROW(dut.GetStatesChangedSince(0, nullptr), maliput::common::assertion_error);
+  EXPECT_TRUE(dut.GetAllStates().states.empty());
+
+  dut.SetState(kRuleId, kRangeA, {}, {});
+  ASSERT_EQ(dut.rule_ids(), std::vector<Rule::Id>{kRuleId});
+  ManualRangeValueRuleStateProvider::StatesSnapshot snapshot;
+  dut.GetAllStates(&snapshot);
+  ASSERT_EQ(snapshot.states.size(), 1u);
+  ASSERT_TRUE(snapshot.states[0].has_value());
+  EXPECT_TRUE(AssertCompare(IsEqual(snapshot.states[0]->state, kRangeA)));
+  EXPECT_FALSE(snapshot.states[0]->next.has_value());
+
+  ManualRangeValueRuleStateProvider::StateChanges changes;
+  dut.GetStatesChangedSince(snapshot.version, &changes);
+  EXPECT_EQ(changes.version, snapshot.version);
+  EXPECT_TRUE(changes.indices.empty());
+
+  dut.SetState(kRuleId, kRangeA, {kRangeA}, {kDurationUntil});
+  dut.GetStatesChangedSince(snapshot.version, &changes);
+  EXPECT_GT(changes.version, snapshot.version);
+  EXPECT_EQ(changes.indices, std::vector<std::size_t>{0});
+  ASSERT_EQ(changes.states.size(), 1u);
+  ASSERT_TRUE(changes.states[0].has_value());
+  ASSERT_TRUE(changes.states[0]->next.has_value());
+  EXPECT_EQ(changes.states[0]->next->duration_until, kDurationUntil);
+}
+
 // Tests the states when using the ManualRangeValueRuleStateProvider::GetDefaultManualRangeValueRuleStateProvider
 // method.
 TEST_F(ManualRangeValueRuleStateProviderTest, StaticMethodTest) {
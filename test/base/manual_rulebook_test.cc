@@ -29,6 +29,11 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "maliput/base/manual_rulebook.h"
 
+#include <cmath>
+#include <optional>
+#include <string>
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include "assert_compare.h"
@@ -283,6 +288,46 @@ TEST_F(ManualRulebookTest, FindRules) {
   EXPECT_EQ(static_cast<int>(toofar.range_value_rules.size()), 0);
 }
 
+// Compares the results of FindRules() on a lane with many overlapping ranges to checking every range.
+TEST_F(ManualRulebookTest, FindRulesAmongManyRanges) {
+  ManualRulebook dut;
+  const LaneId kLaneId("a");
+  const int kNumRules{200};
+  std::vector<RangeValueRule> rules;
+  for (int i = 0; i < kNumRules; ++i) {
+    // Lengths in [0.5, 15.5) scattered over [0, 100), every third range is reversed.
+    const double s0 = std::fmod(37. * i, 100.);
+    const double s1 = s0 + 0.5 + std::fmod(7.3 * i, 15.);
+    const api::SRange s_range = i % 3 == 0 ? api::SRange(s1, s0) : api::SRange(s0, s1);
+    rules.emplace_back(Rule::Id("rvrt/" + std::to_string(i)), Rule::TypeId("rvrt"),
+                       LaneSRoute({LaneSRange(kLaneId, s_range)}), kRangeValueRule.states());
+    dut.AddRule(rules.back());
+  }
+  // Removing rules after a query updates the index.
+  EXPECT_EQ(dut.FindRules({LaneSRange(kLaneId, {0., 200.})}, 0.).range_value_rules.size(), rules.size());
+  for (int i = 0; i < kNumRules; i += 5) {
+    dut.RemoveRule(rules[i].id());
+  }
+
+  for (const double tolerance : {0., 0.25}) {
+    for (double s = 0.; s < 110.; s += 1.7) {
+      const LaneSRange query(kLaneId, {s, s + 2.});
+      std::vector<Rule::Id> expected_ids;
+      for (int i = 0; i < kNumRules; ++i) {
+        if (i % 5 != 0 && rules[i].zone().ranges()[0].s_range().Intersects(query.s_range(), tolerance)) {
+          expected_ids.push_back(rules[i].id());
+        }
+      }
+      const RoadRulebook::QueryResults results = dut.FindRules({query}, tolerance);
+      ASSERT_EQ(results.range_value_rules.size(), expected_ids.size());
+      for (const Rule::Id& id : expected_ids) {
+        EXPECT_EQ(results.range_value_rules.count(id), 1u);
+      }
+      EXPECT_TRUE(dut.FindRules({LaneSRange(LaneId("b"), query.s_range())}, tolerance).range_value_rules.empty());
+    }
+  }
+}
+
 TEST_F(ManualRulebookTest, GetAllRules) {
   ManualRulebook dut;
 
@@ -327,6 +372,124 @@ TEST_F(ManualRulebookTest, GetAllRules) {
   EXPECT_EQ(static_cast<int>(result.range_value_rules.size()), 1);
 }
 
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+TEST_F(ManualRulebookTest, FindRuleViews) {
+  ManualRulebook dut;
+  dut.AddRule(kSpeedLimit);
+  dut.AddRule(kRightOfWay);
+  dut.AddRule(kDirectionUsage);
+  dut.AddRule(kDiscreteValueRule);
+  dut.AddRule(kRangeValueRule);
+  const RangeValueRule kOtherRangeValueRule(Rule::Id("rvrt/other"), kRangeValueRule.type_id(),
+                                            LaneSRoute({LaneSRange(LaneId("a"), {15., 30.})}),
+                                            kRangeValueRule.states());
+  dut.AddRule(kOtherRangeValueRule);
+
+  EXPECT_THROW(dut.FindRuleViews({kZone}, -1.), maliput::common::assertion_error);
+  EXPECT_THROW(dut.FindRuleViews({kZone}, 0., nullptr), maliput::common::assertion_error);
+
+  ManualRulebook::QueryResultViews views = dut.FindRuleViews({kZone}, 0.);
+  ASSERT_EQ(static_cast<int>(views.right_of_way.size()), 1);
+  EXPECT_TRUE(AssertCompare(IsEqual(*views.right_of_way[0], kRightOfWay)));
+  ASSERT_EQ(static_cast<int>(views.speed_limit.size()), 1);
+  EXPECT_TRUE(AssertCompare(IsEqual(*views.speed_limit[0], kSpeedLimit)));
+  ASSERT_EQ(static_cast<int>(views.direction_usage.size()), 1);
+  EXPECT_TRUE(AssertCompare(IsEqual(*views.direction_usage[0], kDirectionUsage)));
+  ASSERT_EQ(static_cast<int>(views.discrete_value_rules.size()), 1);
+  EXPECT_TRUE(AssertCompare(IsEqual(*views.discrete_value_rules[0], kDiscreteValueRule)));
+  // Sorted by ID.
+  ASSERT_EQ(static_cast<int>(views.range_value_rules.size()), 2);
+  EXPECT_TRUE(AssertCompare(IsEqual(*views.range_value_rules[0], kOtherRangeValueRule)));
+  EXPECT_TRUE(AssertCompare(IsEqual(*views.range_value_rules[1], kRangeValueRule)));
+
+  // Rules matched by several ranges are reported once, and the views are cleared before they are refilled.
+  const LaneSRange kFarZone(kZone.lane_id(), {25., 30.});
+  dut.FindRuleViews({kZone, kZone, kFarZone}, 0., &views);
+  EXPECT_EQ(static_cast<int>(views.right_of_way.size()), 1);
+  EXPECT_EQ(static_cast<int>(views.range_value_rules.size()), 2);
+  dut.FindRuleViews({kFarZone}, 0., &views);
+  EXPECT_TRUE(views.right_of_way.empty());
+  EXPECT_TRUE(views.speed_limit.empty());
+  EXPECT_TRUE(views.direction_usage.empty());
+  EXPECT_TRUE(views.discrete_value_rules.empty());
+  ASSERT_EQ(static_cast<int>(views.range_value_rules.size()), 1);
+  EXPECT_EQ(views.range_value_rules[0]->id(), kOtherRangeValueRule.id());
+
+  // Views point into the rulebook.
+  EXPECT_EQ(views.range_value_rules[0], dut.GetRangeValueRuleView(kOtherRangeValueRule.id()));
+  EXPECT_EQ(dut.FindRuleViews({kZone}, 0.).discrete_value_rules[0],
+            dut.GetDiscreteValueRuleView(kDiscreteValueRule.id()));
+}
+#pragma GCC diagnostic pop
+
+TEST_F(ManualRulebookTest, RuleViews) {
+  ManualRulebook dut;
+  const ManualRulebook::QueryResultViews empty = dut.RuleViews();
+  EXPECT_TRUE(empty.right_of_way.empty());
+  EXPECT_TRUE(empty.speed_limit.empty());
+  EXPECT_TRUE(empty.direction_usage.empty());
+  EXPECT_TRUE(empty.discrete_value_rules.empty());
+  EXPECT_TRUE(empty.range_value_rules.empty());
+
+  dut.AddRule(kSpeedLimit);
+  dut.AddRule(kRightOfWay);
+  dut.AddRule(kDirectionUsage);
+  dut.AddRule(kDiscreteValueRule);
+  dut.AddRule(kRangeValueRule);
+  const ManualRulebook::QueryResultViews views = dut.RuleViews();
+  EXPECT_EQ(static_cast<int>(views.right_of_way.size()), 1);
+  EXPECT_EQ(static_cast<int>(views.speed_limit.size()), 1);
+  EXPECT_EQ(static_cast<int>(views.direction_usage.size()), 1);
+  ASSERT_EQ(static_cast<int>(views.discrete_value_rules.size()), 1);
+  EXPECT_TRUE(AssertCompare(IsEqual(*views.discrete_value_rules[0], kDiscreteValueRule)));
+  ASSERT_EQ(static_cast<int>(views.range_value_rules.size()), 1);
+  EXPECT_TRUE(AssertCompare(IsEqual(*views.range_value_rules[0], kRangeValueRule)));
+}
+
+TEST_F(ManualRulebookTest, GetRuleViews) {
+  ManualRulebook dut;
+  EXPECT_EQ(dut.GetDiscreteValueRuleView(kDiscreteValueRule.id()), nullptr);
+  EXPECT_EQ(dut.GetRangeValueRuleView(kRangeValueRule.id()), nullptr);
+
+  dut.AddRule(kDiscreteValueRule);
+  dut.AddRule(kRangeValueRule);
+  const DiscreteValueRule* discrete_value_rule = dut.GetDiscreteValueRuleView(kDiscreteValueRule.id());
+  ASSERT_NE(discrete_value_rule, nullptr);
+  EXPECT_TRUE(AssertCompare(IsEqual(*discrete_value_rule, kDiscreteValueRule)));
+  const RangeValueRule* range_value_rule = dut.GetRangeValueRuleView(kRangeValueRule.id());
+  ASSERT_NE(range_value_rule, nullptr);
+  EXPECT_TRUE(AssertCompare(IsEqual(*range_value_rule, kRangeValueRule)));
+  // IDs of the other kind of rule are unknown.
+  EXPECT_EQ(dut.GetDiscreteValueRuleView(kRangeValueRule.id()), nullptr);
+  EXPECT_EQ(dut.GetRangeValueRuleView(kDiscreteValueRule.id()), nullptr);
+
+  dut.RemoveRule(kRangeValueRule.id());
+  EXPECT_EQ(dut.GetRangeValueRuleView(kRangeValueRule.id()), nullptr);
+}
+
+TEST_F(ManualRulebookTest, Revision) {
+  ManualRulebook dut;
+  std::optional<std::size_t> revision = dut.revision();
+  ASSERT_TRUE(revision.has_value());
+  const auto expect_changed = [&]() {
+    EXPECT_NE(dut.revision(), revision);
+    revision = dut.revision();
+  };
+  dut.AddRule(kDiscreteValueRule);
+  expect_changed();
+  dut.AddRule(kRangeValueRule);
+  expect_changed();
+  // Failed changes and queries don't count.
+  EXPECT_THROW(dut.AddRule(kRangeValueRule), maliput::common::assertion_error);
+  dut.FindRules({kZone}, 0.);
+  EXPECT_EQ(dut.revision(), revision);
+  dut.RemoveRule(kRangeValueRule.id());
+  expect_changed();
+  dut.RemoveAll();
+  expect_changed();
+}
+
 }  // namespace
 }  // namespace test
 }  // namespace maliput
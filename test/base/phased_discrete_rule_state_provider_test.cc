@@ -30,6 +30,7 @@
 #include "maliput/base/phased_discrete_rule_state_provider.h"
 
 #include <memory>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -238,6 +239,44 @@ TEST_F(PhaseBasedBehaviorTest, GetStateByRoadPositionBehavior) {
                maliput::common::assertion_error);
 }
 
+TEST_F(PhaseBasedBehaviorTest, BulkStates) {
+  PhasedDiscreteRuleStateProvider dut(&rulebook_, &phase_ring_book_, &phase_provider_);
+  // The rules of the phase rings are known without setting their state.
+  ASSERT_EQ(dut.rule_ids().size(), 2u);
+
+  const auto expect_same_states = [&dut, this](const PhasedDiscreteRuleStateProvider::StatesSnapshot& snapshot) {
+    ASSERT_EQ(snapshot.states.size(), dut.rule_ids().size());
+    for (std::size_t i = 0; i < dut.rule_ids().size(); ++i) {
+      const std::optional<DiscreteValueRuleStateProvider::StateResult> result = dut.GetState(dut.rule_ids()[i]);
+      ASSERT_TRUE(result.has_value());
+      ASSERT_TRUE(snapshot.states[i].has_value());
+      CompareDiscreteValueRuleStateProviderResult(*result, *snapshot.states[i]);
+    }
+  };
+
+  const PhasedDiscreteRuleStateProvider::StatesSnapshot phase_1_snapshot = dut.GetAllStates();
+  expect_same_states(phase_1_snapshot);
+
+  PhasedDiscreteRuleStateProvider::StateChanges changes;
+  dut.GetStatesChangedSince(phase_1_snapshot.version, &changes);
+  EXPECT_TRUE(changes.indices.empty());
+
+  phase_provider_.SetPhase(ring_id, phase_id_2, phase_id_1, 5.);
+  dut.GetStatesChangedSince(phase_1_snapshot.version, &changes);
+  EXPECT_GT(changes.version, phase_1_snapshot.version);
+  EXPECT_EQ(changes.indices, (std::vector<std::size_t>{0, 1}));
+  ASSERT_EQ(changes.states.size(), 2u);
+  for (std::size_t i = 0; i < changes.indices.size(); ++i) {
+    const std::optional<DiscreteValueRuleStateProvider::StateResult> result =
+        dut.GetState(dut.rule_ids()[changes.indices[i]]);
+    ASSERT_TRUE(result.has_value());
+    ASSERT_TRUE(changes.states[i].has_value());
+    ASSERT_TRUE(changes.states[i]->next.has_value());
+    CompareDiscreteValueRuleStateProviderResult(*result, *changes.states[i]);
+  }
+  expect_same_states(dut.GetAllStates());
+}
+
 // Evaluates the manual behavior of the state provider.
 class ManualBasedBehaviorTest : public ::testing::Test {
  protected:
@@ -0,0 +1,344 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2023, Woven by Toyota. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "maliput/base/road_network_snapshot.h"
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "assert_compare.h"
+#include "maliput/api/intersection.h"
+#include "maliput/api/rules/compare.h"
+#include "maliput/base/intersection_book.h"
+#include "maliput/base/manual_phase_provider.h"
+#include "maliput/base/manual_phase_ring_book.h"
+#include "maliput/base/manual_range_value_rule_state_provider.h"
+#include "maliput/base/manual_rulebook.h"
+#include "maliput/base/phased_discrete_rule_state_provider.h"
+#include "maliput/base/traffic_light_book.h"
+#include "maliput/common/assertion_error.h"
+#include "maliput/common/filesystem.h"
+#include "maliput/test_utilities/procedural_road_network.h"
+
+namespace maliput {
+namespace test {
+namespace {
+
+using api::LaneId;
+using api::LaneSRange;
+using api::LaneSRoute;
+using api::RoadNetwork;
+using api::rules::DirectionUsageRule;
+using api::rules::PhaseRing;
+using api::rules::RightOfWayRule;
+using api::rules::Rule;
+using api::rules::SpeedLimitRule;
+using api::rules::TrafficLight;
+using api::test::CreateProceduralRoadGeometry;
+using api::test::CreateProceduralRoadNetwork;
+using api::test::ProceduralRoadNetworkConfig;
+
+// Stores the procedural RoadGeometry as the number of rows and columns of its grid.
+class ProceduralRoadGeometrySerializer : public RoadGeometrySerializer {
+ public:
+  explicit ProceduralRoadGeometrySerializer(const ProceduralRoadNetworkConfig& config) : config_(config) {}
+
+ private:
+  std::string DoSerialize(const api::RoadGeometry&) const override {
+    const std::int32_t grid[2]{config_.num_rows, config_.num_columns};
+    return std::string(reinterpret_cast<const char*>(grid), sizeof(grid));
+  }
+
+  std::unique_ptr<const api::RoadGeometry> DoDeserialize(const char* data, std::size_t size) const override {
+    MALIPUT_VALIDATE(size == 2 * sizeof(std::int32_t), "Unexpected RoadGeometry size.");
+    ProceduralRoadNetworkConfig config = config_;
+    std::int32_t grid[2];
+    std::memcpy(grid, data, sizeof(grid));
+    config.num_rows = grid[0];
+    config.num_columns = grid[1];
+    return CreateProceduralRoadGeometry(config);
+  }
+
+  const ProceduralRoadNetworkConfig config_;
+};
+
+class RoadNetworkSnapshotTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    directory_.set_as_temp();
+    directory_.append("RoadNetworkSnapshotTest");
+    ASSERT_TRUE(common::Filesystem::create_directory(directory_));
+    snapshot_path_ = directory_.get_path() + "/road_network.snapshot";
+    other_snapshot_path_ = directory_.get_path() + "/other_road_network.snapshot";
+    config_.num_rows = 2;
+    config_.num_columns = 3;
+  }
+
+  void TearDown() override {
+    common::Filesystem::remove_file(common::Path(snapshot_path_));
+    common::Filesystem::remove_file(common::Path(other_snapshot_path_));
+    ASSERT_TRUE(common::Filesystem::remove_directory(directory_));
+  }
+
+  static std::string ReadFile(const std::string& path) {
+    std::ifstream is(path, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(is), std::istreambuf_iterator<char>());
+  }
+
+  static void WriteFile(const std::string& path, const std::string& contents) {
+    std::ofstream os(path, std::ios::binary);
+    os.write(contents.data(), contents.size());
+  }
+
+  // Expects @p dut to hold the same entities as @p expected.
+  static void ExpectEqualRoadNetworks(RoadNetwork* expected, RoadNetwork* dut) {
+    EXPECT_EQ(dut->road_geometry()->id(), expected->road_geometry()->id());
+    EXPECT_EQ(dut->rule_registry()->DiscreteValueRuleTypes(), expected->rule_registry()->DiscreteValueRuleTypes());
+    EXPECT_EQ(dut->rule_registry()->RangeValueRuleTypes(), expected->rule_registry()->RangeValueRuleTypes());
+
+    const api::rules::RoadRulebook::QueryResults expected_rules = expected->rulebook()->Rules();
+    const api::rules::RoadRulebook::QueryResults rules = dut->rulebook()->Rules();
+    ASSERT_EQ(rules.discrete_value_rules.size(), expected_rules.discrete_value_rules.size());
+    for (const auto& rule : expected_rules.discrete_value_rules) {
+      EXPECT_TRUE(AssertCompare(IsEqual(rules.discrete_value_rules.at(rule.first), rule.second)));
+    }
+    ASSERT_EQ(rules.range_value_rules.size(), expected_rules.range_value_rules.size());
+    for (const auto& rule : expected_rules.range_value_rules) {
+      EXPECT_TRUE(AssertCompare(IsEqual(rules.range_value_rules.at(rule.first), rule.second)));
+    }
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+    ASSERT_EQ(rules.right_of_way.size(), expected_rules.right_of_way.size());
+    for (const auto& rule : expected_rules.right_of_way) {
+      EXPECT_TRUE(AssertCompare(IsEqual(rules.right_of_way.at(rule.first), rule.second)));
+    }
+    ASSERT_EQ(rules.speed_limit.size(), expected_rules.speed_limit.size());
+    for (const auto& rule : expected_rules.speed_limit) {
+      EXPECT_TRUE(AssertCompare(IsEqual(rules.speed_limit.at(rule.first), rule.second)));
+    }
+    ASSERT_EQ(rules.direction_usage.size(), expected_rules.direction_usage.size());
+    for (const auto& rule : expected_rules.direction_usage) {
+      EXPECT_TRUE(AssertCompare(IsEqual(rules.direction_usage.at(rule.first), rule.second)));
+    }
+#pragma GCC diagnostic pop
+
+    const std::vector<const TrafficLight*> expected_traffic_lights = expected->traffic_light_book()->TrafficLights();
+    ASSERT_EQ(dut->traffic_light_book()->TrafficLights().size(), expected_traffic_lights.size());
+    for (const TrafficLight* traffic_light : expected_traffic_lights) {
+      EXPECT_TRUE(AssertCompare(
+          IsEqual(dut->traffic_light_book()->GetTrafficLight(traffic_light->id()), traffic_light)));
+    }
+
+    const std::vector<PhaseRing::Id> expected_ring_ids = expected->phase_ring_book()->GetPhaseRings();
+    ASSERT_EQ(dut->phase_ring_book()->GetPhaseRings().size(), expected_ring_ids.size());
+    for (const PhaseRing::Id& ring_id : expected_ring_ids) {
+      const std::optional<PhaseRing> expected_ring = expected->phase_ring_book()->GetPhaseRing(ring_id);
+      const std::optional<PhaseRing> ring = dut->phase_ring_book()->GetPhaseRing(ring_id);
+      ASSERT_TRUE(ring.has_value());
+      ASSERT_EQ(ring->phases().size(), expected_ring->phases().size());
+      for (const auto& phase : expected_ring->phases()) {
+        EXPECT_TRUE(AssertCompare(IsEqual(ring->phases().at(phase.first), phase.second)));
+        EXPECT_TRUE(
+            AssertCompare(IsEqual(ring->GetNextPhases(phase.first), expected_ring->GetNextPhases(phase.first))));
+      }
+      const auto expected_phase = expected->phase_provider()->GetPhase(ring_id);
+      const auto phase = dut->phase_provider()->GetPhase(ring_id);
+      ASSERT_EQ(phase.has_value(), expected_phase.has_value());
+      if (phase.has_value()) {
+        EXPECT_EQ(phase->state, expected_phase->state);
+        ASSERT_EQ(phase->next.has_value(), expected_phase->next.has_value());
+        if (phase->next.has_value()) {
+          EXPECT_EQ(phase->next->state, expected_phase->next->state);
+          EXPECT_EQ(phase->next->duration_until, expected_phase->next->duration_until);
+        }
+      }
+    }
+
+    const std::vector<api::Intersection*> expected_intersections = expected->intersection_book()->GetIntersections();
+    ASSERT_EQ(dut->intersection_book()->GetIntersections().size(), expected_intersections.size());
+    for (const api::Intersection* expected_intersection : expected_intersections) {
+      const api::Intersection* intersection = dut->intersection_book()->GetIntersection(expected_intersection->id());
+      ASSERT_NE(intersection, nullptr);
+      EXPECT_EQ(intersection->ring_id(), expected_intersection->ring_id());
+      ASSERT_EQ(intersection->region().size(), expected_intersection->region().size());
+      for (std::size_t i = 0; i < intersection->region().size(); ++i) {
+        EXPECT_EQ(intersection->region()[i].lane_id(), expected_intersection->region()[i].lane_id());
+        EXPECT_EQ(intersection->region()[i].s_range().s0(), expected_intersection->region()[i].s_range().s0());
+        EXPECT_EQ(intersection->region()[i].s_range().s1(), expected_intersection->region()[i].s_range().s1());
+      }
+      EXPECT_EQ(intersection->Phase()->state, expected_intersection->Phase()->state);
+    }
+  }
+
+  common::Path directory_;
+  std::string snapshot_path_;
+  std::string other_snapshot_path_;
+  ProceduralRoadNetworkConfig config_;
+};
+
+TEST_F(RoadNetworkSnapshotTest, SavesAndLoads) {
+  const std::unique_ptr<RoadNetwork> road_network = CreateProceduralRoadNetwork(config_);
+  SaveRoadNetworkSnapshot(road_network.get(), snapshot_path_);
+  ASSERT_TRUE(common::Path(snapshot_path_).is_file());
+
+  const std::unique_ptr<RoadNetwork> dut =
+      LoadRoadNetworkSnapshot(snapshot_path_, CreateProceduralRoadGeometry(config_));
+  ASSERT_NE(dut, nullptr);
+  ExpectEqualRoadNetworks(road_network.get(), dut.get());
+  // The state providers are rebuilt out of the restored books.
+  const Rule::Id rule_id = road_network->rulebook()->Rules().discrete_value_rules.begin()->first;
+  EXPECT_TRUE(AssertCompare(IsEqual(dut->discrete_value_rule_state_provider()->GetState(rule_id)->state,
+                                    road_network->discrete_value_rule_state_provider()->GetState(rule_id)->state)));
+
+  // Snapshots are deterministic, so the restored RoadNetwork produces the same bytes.
+  SaveRoadNetworkSnapshot(dut.get(), other_snapshot_path_);
+  EXPECT_EQ(ReadFile(other_snapshot_path_), ReadFile(snapshot_path_));
+}
+
+TEST_F(RoadNetworkSnapshotTest, CurrentPhasesAreSaved) {
+  const std::unique_ptr<RoadNetwork> road_network = CreateProceduralRoadNetwork(config_);
+  api::Intersection* intersection = road_network->intersection_book()->GetIntersections().front();
+  const api::rules::Phase::Id east_west("east_west_go");
+  intersection->SetPhase(east_west);
+  SaveRoadNetworkSnapshot(road_network.get(), snapshot_path_);
+
+  const std::unique_ptr<RoadNetwork> dut =
+      LoadRoadNetworkSnapshot(snapshot_path_, CreateProceduralRoadGeometry(config_));
+  EXPECT_EQ(dut->intersection_book()->GetIntersection(intersection->id())->Phase()->state, east_west);
+  EXPECT_FALSE(dut->intersection_book()->GetIntersection(intersection->id())->Phase()->next.has_value());
+}
+
+TEST_F(RoadNetworkSnapshotTest, DeprecatedRules) {
+  std::unique_ptr<const api::RoadGeometry> road_geometry = CreateProceduralRoadGeometry(config_);
+  const LaneSRange zone(LaneId("road_0_0_east_forward_0"), {0., 10.});
+  auto rulebook = std::make_unique<ManualRulebook>();
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+  rulebook->AddRule(RightOfWayRule(
+      RightOfWayRule::Id("right_of_way"), LaneSRoute({zone}), RightOfWayRule::ZoneType::kStopAllowed,
+      {RightOfWayRule::State(RightOfWayRule::State::Id("go"), RightOfWayRule::State::Type::kGo, {}),
+       RightOfWayRule::State(RightOfWayRule::State::Id("stop"), RightOfWayRule::State::Type::kStopThenGo,
+                             {RightOfWayRule::Id("other")})},
+      {{TrafficLight::Id("traffic_light"), {api::rules::BulbGroup::Id("a"), api::rules::BulbGroup::Id("b")}}}));
+  rulebook->AddRule(
+      SpeedLimitRule(SpeedLimitRule::Id("speed_limit"), zone, SpeedLimitRule::Severity::kAdvisory, 1., 20.));
+  rulebook->AddRule(DirectionUsageRule(
+      DirectionUsageRule::Id("direction_usage"), zone,
+      {DirectionUsageRule::State(DirectionUsageRule::State::Id("with_s"), DirectionUsageRule::State::Type::kWithS,
+                                 DirectionUsageRule::State::Severity::kPreferred)}));
+#pragma GCC diagnostic pop
+  auto phase_ring_book = std::make_unique<ManualPhaseRingBook>();
+  auto phase_provider = std::make_unique<ManualPhaseProvider>();
+  auto intersection_book = std::make_unique<IntersectionBook>(road_geometry.get());
+  auto discrete_value_rule_state_provider = PhasedDiscreteRuleStateProvider::GetDefaultPhasedDiscreteRuleStateProvider(
+      rulebook.get(), phase_ring_book.get(), phase_provider.get());
+  auto range_value_rule_state_provider =
+      ManualRangeValueRuleStateProvider::GetDefaultManualRangeValueRuleStateProvider(rulebook.get());
+  RoadNetwork road_network(std::move(road_geometry), std::move(rulebook), std::make_unique<TrafficLightBook>(),
+                           std::move(intersection_book), std::move(phase_ring_book), std::move(phase_provider),
+                           std::make_unique<api::rules::RuleRegistry>(), std::move(discrete_value_rule_state_provider),
+                           std::move(range_value_rule_state_provider));
+  SaveRoadNetworkSnapshot(&road_network, snapshot_path_);
+
+  const std::unique_ptr<RoadNetwork> dut =
+      LoadRoadNetworkSnapshot(snapshot_path_, CreateProceduralRoadGeometry(config_));
+  ExpectEqualRoadNetworks(&road_network, dut.get());
+}
+
+TEST_F(RoadNetworkSnapshotTest, RoadGeometrySerializer) {
+  const std::unique_ptr<RoadNetwork> road_network = CreateProceduralRoadNetwork(config_);
+  const ProceduralRoadGeometrySerializer serializer(config_);
+  SaveRoadNetworkSnapshot(road_network.get(), snapshot_path_, &serializer);
+
+  const std::unique_ptr<RoadNetwork> dut = LoadRoadNetworkSnapshot(snapshot_path_, serializer);
+  ASSERT_NE(dut, nullptr);
+  EXPECT_EQ(dut->road_geometry()->num_junctions(), road_network->road_geometry()->num_junctions());
+  ExpectEqualRoadNetworks(road_network.get(), dut.get());
+
+  // Snapshots without a RoadGeometry can't be loaded with a serializer.
+  SaveRoadNetworkSnapshot(road_network.get(), other_snapshot_path_);
+  EXPECT_THROW(LoadRoadNetworkSnapshot(other_snapshot_path_, serializer), common::assertion_error);
+}
+
+// Threads saving to the same file don't clobber each other's temporary files.
+TEST_F(RoadNetworkSnapshotTest, ConcurrentSaves) {
+  constexpr int kNumThreads{4};
+  const std::unique_ptr<RoadNetwork> road_network = CreateProceduralRoadNetwork(config_);
+  SaveRoadNetworkSnapshot(road_network.get(), other_snapshot_path_);
+  std::vector<std::thread> threads;
+  for (int i = 0; i < kNumThreads; ++i) {
+    threads.emplace_back([this, &road_network]() { SaveRoadNetworkSnapshot(road_network.get(), snapshot_path_); });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(ReadFile(snapshot_path_), ReadFile(other_snapshot_path_));
+}
+
+TEST_F(RoadNetworkSnapshotTest, Errors) {
+  const std::unique_ptr<RoadNetwork> road_network = CreateProceduralRoadNetwork(config_);
+  EXPECT_THROW(SaveRoadNetworkSnapshot(nullptr, snapshot_path_), common::assertion_error);
+  EXPECT_THROW(SaveRoadNetworkSnapshot(road_network.get(), directory_.get_path() + "/missing/road_network.snapshot"),
+               common::assertion_error);
+  EXPECT_THROW(LoadRoadNetworkSnapshot(snapshot_path_, CreateProceduralRoadGeometry(config_)),
+               common::assertion_error);
+
+  SaveRoadNetworkSnapshot(road_network.get(), snapshot_path_);
+  EXPECT_THROW(LoadRoadNetworkSnapshot(snapshot_path_, nullptr), common::assertion_error);
+  // The RoadGeometry must be the saved one.
+  ProceduralRoadNetworkConfig other_config = config_;
+  other_config.layout = ProceduralRoadNetworkConfig::Layout::kHighway;
+  EXPECT_THROW(LoadRoadNetworkSnapshot(snapshot_path_, CreateProceduralRoadGeometry(other_config)),
+               common::assertion_error);
+
+  const std::string snapshot = ReadFile(snapshot_path_);
+  // Not a snapshot.
+  std::string corrupted = snapshot;
+  corrupted[0] = 'X';
+  WriteFile(other_snapshot_path_, corrupted);
+  EXPECT_THROW(LoadRoadNetworkSnapshot(other_snapshot_path_, CreateProceduralRoadGeometry(config_)),
+               common::assertion_error);
+  // Truncated snapshots are detected wherever they are cut.
+  for (const std::size_t size : {std::size_t{4}, snapshot.size() / 3, snapshot.size() / 2, snapshot.size() - 1}) {
+    WriteFile(other_snapshot_path_, snapshot.substr(0, size));
+    EXPECT_THROW(LoadRoadNetworkSnapshot(other_snapshot_path_, CreateProceduralRoadGeometry(config_)),
+                 common::assertion_error);
+  }
+}
+
+}  // namespace
+}  // namespace test
+}  // namespace maliput
@@ -0,0 +1,181 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2023, Woven by Toyota. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "maliput/base/rule_state_tracker.h"
+
+#include <optional>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "maliput/api/rules/discrete_value_rule.h"
+#include "maliput/api/rules/discrete_value_rule_state_provider.h"
+#include "maliput/api/rules/rule.h"
+#include "maliput/common/assertion_error.h"
+
+namespace maliput {
+namespace test {
+namespace {
+
+using api::rules::DiscreteValueRule;
+using api::rules::DiscreteValueRuleStateProvider;
+using api::rules::Rule;
+
+using StateResult = DiscreteValueRuleStateProvider::StateResult;
+
+class RuleStateTrackerTest : public ::testing::Test {
+ protected:
+  const Rule::Id kRuleA{"dvrt/a"};
+  const Rule::Id kRuleB{"dvrt/b"};
+  const DiscreteValueRule::DiscreteValue kGo{Rule::State::kStrict, Rule::RelatedRules{}, Rule::RelatedUniqueIds{},
+                                             "Go"};
+  const DiscreteValueRule::DiscreteValue kStop{Rule::State::kStrict, Rule::RelatedRules{}, Rule::RelatedUniqueIds{},
+                                               "Stop"};
+
+  RuleStateTracker<StateResult> dut_;
+};
+
+TEST_F(RuleStateTrackerTest, Register) {
+  EXPECT_EQ(dut_.Register(kRuleA), 0u);
+  EXPECT_EQ(dut_.Register(kRuleB), 1u);
+  EXPECT_EQ(dut_.Register(kRuleA), 0u);
+  EXPECT_EQ(dut_.rule_ids(), (std::vector<Rule::Id>{kRuleA, kRuleB}));
+  EXPECT_EQ(dut_.IndexOf(kRuleB), std::make_optional<std::size_t>(1));
+  EXPECT_EQ(dut_.IndexOf(Rule::Id{"dvrt/unknown"}), std::nullopt);
+}
+
+TEST_F(RuleStateTrackerTest, RecordAndGetChangesSince) {
+  dut_.Register(kRuleA);
+  dut_.Register(kRuleB);
+  EXPECT_THROW(dut_.Record({}), common::assertion_error);
+  EXPECT_THROW(dut_.GetChangesSince(0, nullptr), common::assertion_error);
+
+  // Rules without a state are not changes.
+  EXPECT_EQ(dut_.Record({std::nullopt, std::nullopt}), 0u);
+  const std::size_t first_version = dut_.Record({StateResult{kGo, std::nullopt}, std::nullopt});
+  EXPECT_EQ(first_version, 1u);
+  EXPECT_EQ(dut_.Record({StateResult{kGo, std::nullopt}, std::nullopt}), first_version);
+
+  RuleStateChanges<StateResult> changes;
+  dut_.GetChangesSince(0, &changes);
+  EXPECT_EQ(changes.version, first_version);
+  EXPECT_EQ(changes.indices, std::vector<std::size_t>{0});
+  ASSERT_EQ(changes.states.size(), 1u);
+  EXPECT_EQ(changes.states[0]->state, kGo);
+
+  // Only the next state changes.
+  const std::size_t second_version =
+      dut_.Record({StateResult{kGo, StateResult::Next{kStop, 3.}}, StateResult{kStop, std::nullopt}});
+  EXPECT_EQ(second_version, 2u);
+  dut_.GetChangesSince(first_version, &changes);
+  EXPECT_EQ(changes.version, second_version);
+  EXPECT_EQ(changes.indices, (std::vector<std::size_t>{0, 1}));
+
+  // Only the duration until the next state changes.
+  EXPECT_EQ(dut_.Record({StateResult{kGo, StateResult::Next{kStop, 2.}}, StateResult{kStop, std::nullopt}}), 3u);
+  dut_.GetChangesSince(second_version, &changes);
+  EXPECT_EQ(changes.indices, std::vector<std::size_t>{0});
+  ASSERT_EQ(changes.states.size(), 1u);
+  EXPECT_EQ(changes.states[0]->next->duration_until, 2.);
+
+  // Losing the state is a change.
+  EXPECT_EQ(dut_.Record({StateResult{kGo, StateResult::Next{kStop, 2.}}, std::nullopt}), 4u);
+  dut_.GetChangesSince(3u, &changes);
+  EXPECT_EQ(changes.indices, std::vector<std::size_t>{1});
+  ASSERT_EQ(changes.states.size(), 1u);
+  EXPECT_FALSE(changes.states[0].has_value());
+}
+
+TEST_F(RuleStateTrackerTest, UpdateRuleStateFromValues) {
+  std::optional<StateResult> state;
+  UpdateRuleState(kGo, &kStop, std::make_optional(2.), &state);
+  ASSERT_TRUE(state.has_value());
+  EXPECT_TRUE(IsSameRuleState(*state, StateResult{kGo, StateResult::Next{kStop, 2.}}));
+  EXPECT_TRUE(IsSameRuleState(*state, kGo, &kStop, std::make_optional(2.)));
+  EXPECT_FALSE(IsSameRuleState(*state, kGo, &kStop, std::make_optional(3.)));
+  const DiscreteValueRule::DiscreteValue* no_next_value{nullptr};
+  EXPECT_FALSE(IsSameRuleState(*state, kGo, no_next_value, std::nullopt));
+
+  UpdateRuleState(kStop, no_next_value, std::nullopt, &state);
+  ASSERT_TRUE(state.has_value());
+  EXPECT_TRUE(IsSameRuleState(*state, StateResult{kStop, std::nullopt}));
+}
+
+class ManualRuleStatesTest : public RuleStateTrackerTest {
+ protected:
+  // Writes the states set in `dut_` to `states`.
+  void GetSetStates(std::vector<std::optional<StateResult>>* states) const {
+    for (std::size_t i = 0; i < states->size(); ++i) {
+      dut_.GetSetState(i, &(*states)[i]);
+    }
+  }
+
+  ManualRuleStates<StateResult> dut_;
+};
+
+TEST_F(ManualRuleStatesTest, SetAndFind) {
+  EXPECT_EQ(dut_.Find(kRuleA), nullptr);
+  EXPECT_EQ(dut_.Register(kRuleA), 0u);
+  EXPECT_EQ(dut_.Find(kRuleA), nullptr);
+  dut_.Set(kRuleB, StateResult{kGo, std::nullopt});
+  dut_.Set(kRuleA, StateResult{kStop, std::nullopt});
+  EXPECT_EQ(dut_.rule_ids(), (std::vector<Rule::Id>{kRuleA, kRuleB}));
+  EXPECT_EQ(dut_.IndexOf(kRuleB), std::make_optional<std::size_t>(1));
+  ASSERT_NE(dut_.Find(kRuleA), nullptr);
+  EXPECT_EQ(dut_.Find(kRuleA)->state, kStop);
+  ASSERT_NE(dut_.Find(kRuleB), nullptr);
+  EXPECT_EQ(dut_.Find(kRuleB)->state, kGo);
+}
+
+TEST_F(ManualRuleStatesTest, BulkQueries) {
+  const auto get_states = [this](std::vector<std::optional<StateResult>>* states) { GetSetStates(states); };
+  EXPECT_THROW(dut_.GetAllStates(get_states, nullptr), common::assertion_error);
+  EXPECT_THROW(dut_.GetStatesChangedSince(0, get_states, nullptr), common::assertion_error);
+
+  dut_.Register(kRuleA);
+  dut_.Set(kRuleB, StateResult{kGo, std::nullopt});
+  RuleStatesSnapshot<StateResult> snapshot;
+  dut_.GetAllStates(get_states, &snapshot);
+  EXPECT_EQ(snapshot.version, 1u);
+  ASSERT_EQ(snapshot.states.size(), 2u);
+  EXPECT_FALSE(snapshot.states[0].has_value());
+  ASSERT_TRUE(snapshot.states[1].has_value());
+  EXPECT_EQ(snapshot.states[1]->state, kGo);
+
+  dut_.Set(kRuleA, StateResult{kStop, std::nullopt});
+  RuleStateChanges<StateResult> changes;
+  dut_.GetStatesChangedSince(snapshot.version, get_states, &changes);
+  EXPECT_EQ(changes.version, 2u);
+  EXPECT_EQ(changes.indices, std::vector<std::size_t>{0});
+  ASSERT_EQ(changes.states.size(), 1u);
+  EXPECT_EQ(changes.states[0]->state, kStop);
+}
+
+}  // namespace
+}  // namespace test
+}  // namespace maliput
@@ -0,0 +1,191 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2023, Woven by Toyota. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "maliput/base/rule_zone_index.h"
+
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "maliput/api/regions.h"
+#include "maliput/api/rules/discrete_value_rule.h"
+#include "maliput/api/rules/range_value_rule.h"
+#include "maliput/api/rules/rule.h"
+#include "maliput/base/manual_rulebook.h"
+#include "maliput/common/assertion_error.h"
+#include "maliput/test_utilities/mock.h"
+
+namespace maliput {
+namespace test {
+namespace {
+
+using api::LaneId;
+using api::LanePosition;
+using api::LaneSRange;
+using api::LaneSRoute;
+using api::RoadPosition;
+using api::rules::DiscreteValueRule;
+using api::rules::RangeValueRule;
+using api::rules::Rule;
+
+class RuleZoneIndexTest : public ::testing::Test {
+ protected:
+  const LaneId kLaneA{"a"};
+  const LaneId kLaneB{"b"};
+  const Rule::TypeId kTypeA{"type_a"};
+  const Rule::TypeId kTypeB{"type_b"};
+  const api::test::MockLane kMockLaneA{kLaneA};
+  const api::test::MockLane kMockLaneB{kLaneB};
+
+  // Returns a DiscreteValueRule with a single state.
+  DiscreteValueRule MakeRule(const std::string& id, const Rule::TypeId& type_id, const LaneSRoute& zone) const {
+    return DiscreteValueRule(
+        Rule::Id(id), type_id, zone,
+        {DiscreteValueRule::DiscreteValue{Rule::State::kStrict, api::test::CreateEmptyRelatedRules(),
+                                          api::test::CreateEmptyRelatedUniqueIds(), "value"}});
+  }
+
+  void SetUp() override {
+    rulebook_.AddRule(MakeRule("type_a/1", kTypeA, LaneSRoute({LaneSRange(kLaneA, {0., 10.})})));
+    // Reversed, and with two ranges on the same lane.
+    rulebook_.AddRule(MakeRule("type_a/0", kTypeA,
+                               LaneSRoute({LaneSRange(kLaneA, {20., 5.}), LaneSRange(kLaneA, {8., 30.}),
+                                           LaneSRange(kLaneB, {0., 10.})})));
+    rulebook_.AddRule(MakeRule("type_b/0", kTypeB, LaneSRoute({LaneSRange(kLaneA, {0., 30.})})));
+    // Range value rules are not indexed by RuleZoneIndex<DiscreteValueRule>.
+    rulebook_.AddRule(RangeValueRule(Rule::Id("type_a/range"), kTypeA, LaneSRoute({LaneSRange(kLaneA, {0., 30.})}),
+                                     {RangeValueRule::Range{Rule::State::kStrict, api::test::CreateEmptyRelatedRules(),
+                                                            api::test::CreateEmptyRelatedUniqueIds(), "range", 0.,
+                                                            1.}}));
+  }
+
+  RoadPosition AtLaneA(double s) const { return RoadPosition(&kMockLaneA, LanePosition(s, 0., 0.)); }
+
+  ManualRulebook rulebook_;
+};
+
+TEST_F(RuleZoneIndexTest, Constructor) {
+  EXPECT_THROW(RuleZoneIndex<DiscreteValueRule>(nullptr), common::assertion_error);
+}
+
+TEST_F(RuleZoneIndexTest, FindRules) {
+  const RuleZoneIndex<DiscreteValueRule> dut(&rulebook_);
+
+  EXPECT_THROW(dut.FindRule(AtLaneA(1.), kTypeA, -1.), common::assertion_error);
+  EXPECT_THROW(dut.FindRules(AtLaneA(1.), kTypeA, -1.), common::assertion_error);
+
+  EXPECT_EQ(dut.FindRules(AtLaneA(1.), kTypeA, 0.), std::vector<Rule::Id>{Rule::Id("type_a/1")});
+  // Rules matched by several ranges are reported once, sorted by ID.
+  EXPECT_EQ(dut.FindRules(AtLaneA(9.), kTypeA, 0.),
+            (std::vector<Rule::Id>{Rule::Id("type_a/0"), Rule::Id("type_a/1")}));
+  EXPECT_EQ(dut.FindRules(AtLaneA(25.), kTypeA, 0.), std::vector<Rule::Id>{Rule::Id("type_a/0")});
+  EXPECT_EQ(dut.FindRules(AtLaneA(25.), kTypeB, 0.), std::vector<Rule::Id>{Rule::Id("type_b/0")});
+  EXPECT_TRUE(dut.FindRules(AtLaneA(35.), kTypeA, 0.).empty());
+  EXPECT_EQ(dut.FindRules(AtLaneA(35.), kTypeA, 5.), std::vector<Rule::Id>{Rule::Id("type_a/0")});
+  EXPECT_EQ(dut.FindRules(RoadPosition(&kMockLaneB, LanePosition(5., 0., 0.)), kTypeA, 0.),
+            std::vector<Rule::Id>{Rule::Id("type_a/0")});
+  EXPECT_TRUE(dut.FindRules(RoadPosition(&kMockLaneB, LanePosition(5., 0., 0.)), kTypeB, 0.).empty());
+
+  // The smallest ID is picked when several rules apply.
+  EXPECT_EQ(dut.FindRule(AtLaneA(9.), kTypeA, 0.), Rule::Id("type_a/0"));
+  EXPECT_EQ(dut.FindRule(AtLaneA(1.), kTypeA, 0.), Rule::Id("type_a/1"));
+  EXPECT_EQ(dut.FindRule(AtLaneA(1.), Rule::TypeId("unknown"), 0.), std::nullopt);
+  EXPECT_EQ(dut.FindRule(AtLaneA(35.), kTypeA, 0.), std::nullopt);
+}
+
+TEST_F(RuleZoneIndexTest, RangeValueRules) {
+  const RuleZoneIndex<RangeValueRule> dut(&rulebook_);
+  EXPECT_EQ(dut.FindRules(AtLaneA(1.), kTypeA, 0.), std::vector<Rule::Id>{Rule::Id("type_a/range")});
+  EXPECT_TRUE(dut.FindRules(AtLaneA(1.), kTypeB, 0.).empty());
+}
+
+// The index follows the changes of a ManualRulebook.
+TEST_F(RuleZoneIndexTest, RulebookChanges) {
+  const RuleZoneIndex<DiscreteValueRule> dut(&rulebook_);
+  EXPECT_TRUE(dut.FindRules(AtLaneA(40.), kTypeA, 0.).empty());
+
+  rulebook_.AddRule(MakeRule("type_a/2", kTypeA, LaneSRoute({LaneSRange(kLaneA, {35., 45.})})));
+  EXPECT_EQ(dut.FindRules(AtLaneA(40.), kTypeA, 0.), std::vector<Rule::Id>{Rule::Id("type_a/2")});
+
+  rulebook_.RemoveRule(Rule::Id("type_a/2"));
+  EXPECT_TRUE(dut.FindRules(AtLaneA(40.), kTypeA, 0.).empty());
+
+  rulebook_.RemoveAll();
+  EXPECT_EQ(dut.FindRule(AtLaneA(1.), kTypeA, 0.), std::nullopt);
+}
+
+// Forwards to a ManualRulebook without telling its revision.
+class UntrackedRulebook final : public api::rules::RoadRulebook {
+ public:
+  explicit UntrackedRulebook(const ManualRulebook* rulebook) : rulebook_(rulebook) {}
+
+ private:
+  QueryResults DoFindRules(const std::vector<LaneSRange>& ranges, double tolerance) const override {
+    return rulebook_->FindRules(ranges, tolerance);
+  }
+  QueryResults DoRules() const override { return rulebook_->Rules(); }
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+  api::rules::RightOfWayRule DoGetRule(const api::rules::RightOfWayRule::Id& id) const override {
+    return rulebook_->GetRule(id);
+  }
+  api::rules::SpeedLimitRule DoGetRule(const api::rules::SpeedLimitRule::Id& id) const override {
+    return rulebook_->GetRule(id);
+  }
+  api::rules::DirectionUsageRule DoGetRule(const api::rules::DirectionUsageRule::Id& id) const override {
+    return rulebook_->GetRule(id);
+  }
+#pragma GCC diagnostic pop
+  DiscreteValueRule DoGetDiscreteValueRule(const Rule::Id& id) const override {
+    return rulebook_->GetDiscreteValueRule(id);
+  }
+  RangeValueRule DoGetRangeValueRule(const Rule::Id& id) const override { return rulebook_->GetRangeValueRule(id); }
+
+  const ManualRulebook* rulebook_{};
+};
+
+// Rulebooks that don't track their revision are queried every time.
+TEST_F(RuleZoneIndexTest, UntrackedRulebook) {
+  const UntrackedRulebook rulebook(&rulebook_);
+  ASSERT_EQ(rulebook.revision(), std::nullopt);
+  const RuleZoneIndex<DiscreteValueRule> dut(&rulebook);
+  EXPECT_EQ(dut.FindRules(AtLaneA(9.), kTypeA, 0.),
+            (std::vector<Rule::Id>{Rule::Id("type_a/0"), Rule::Id("type_a/1")}));
+  EXPECT_EQ(dut.FindRule(AtLaneA(9.), kTypeA, 0.), Rule::Id("type_a/0"));
+  EXPECT_TRUE(dut.FindRules(AtLaneA(40.), kTypeA, 0.).empty());
+
+  rulebook_.AddRule(MakeRule("type_a/2", kTypeA, LaneSRoute({LaneSRange(kLaneA, {35., 45.})})));
+  EXPECT_EQ(dut.FindRules(AtLaneA(40.), kTypeA, 0.), std::vector<Rule::Id>{Rule::Id("type_a/2")});
+  EXPECT_EQ(dut.FindRule(AtLaneA(40.), kTypeA, 5.), Rule::Id("type_a/2"));
+}
+
+}  // namespace
+}  // namespace test
+}  // namespace maliput
@@ -0,0 +1,298 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2023, Woven by Toyota. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "maliput/common/builtin_profiler.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <numeric>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace maliput {
+namespace common {
+namespace profiler {
+namespace {
+
+class BuiltinProfilerTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    Reset();
+    SetEnabled(true);
+  }
+
+  void TearDown() override {
+    SetEnabled(false);
+    Reset();
+  }
+
+  // @returns The statistics of @p name, or statistics with no calls.
+  static ScopeStatistics FindStatistics(const std::string& name) {
+    for (const ScopeStatistics& statistics : GetStatistics()) {
+      if (statistics.name == name) {
+        return statistics;
+      }
+    }
+    return ScopeStatistics{};
+  }
+
+  // @returns The Chrome trace of the buffered events.
+  static std::string ChromeTrace() {
+    std::ostringstream os;
+    WriteChromeTrace(os);
+    return os.str();
+  }
+
+  // @returns The number of occurrences of @p pattern in @p text.
+  static int Count(const std::string& text, const std::string& pattern) {
+    int count{0};
+    for (std::size_t pos = text.find(pattern); pos != std::string::npos; pos = text.find(pattern, pos + 1)) {
+      ++count;
+    }
+    return count;
+  }
+};
+
+TEST_F(BuiltinProfilerTest, CountsScopes) {
+  for (int i = 0; i < 10; ++i) {
+    ScopedProfile outer("builtin_profiler_test_outer");
+    ScopedProfile inner("builtin_profiler_test_inner");
+  }
+  const ScopeStatistics outer = FindStatistics("builtin_profiler_test_outer");
+  const ScopeStatistics inner = FindStatistics("builtin_profiler_test_inner");
+  EXPECT_EQ(outer.calls, 10);
+  EXPECT_EQ(inner.calls, 10);
+  EXPECT_GE(outer.total_ns, inner.total_ns);
+  EXPECT_GE(outer.max_ns, outer.mean_ns());
+  EXPECT_EQ(std::accumulate(outer.histogram.begin(), outer.histogram.end(), int64_t{0}), 10);
+}
+
+TEST_F(BuiltinProfilerTest, MeasuresDurations) {
+  {
+    ScopedProfile scope("builtin_profiler_test_sleep");
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+  }
+  const ScopeStatistics statistics = FindStatistics("builtin_profiler_test_sleep");
+  ASSERT_EQ(statistics.calls, 1);
+  EXPECT_GE(statistics.total_ns, 1.5e6);
+  EXPECT_LT(statistics.total_ns, 1e9);
+  // 2ms lies in [2^20, 2^21) ns; allow for a loaded machine.
+  EXPECT_EQ(std::accumulate(statistics.histogram.begin() + 20, statistics.histogram.end(), int64_t{0}), 1);
+}
+
+TEST_F(BuiltinProfilerTest, DisabledRecordsNothing) {
+  SetEnabled(false);
+  EXPECT_FALSE(IsEnabled());
+  {
+    ScopedProfile scope("builtin_profiler_test_disabled");
+  }
+  EXPECT_EQ(FindStatistics("builtin_profiler_test_disabled").calls, 0);
+  EXPECT_EQ(Count(ChromeTrace(), "builtin_profiler_test_disabled"), 0);
+}
+
+TEST_F(BuiltinProfilerTest, ToggledWithinAScope) {
+  {
+    ScopedProfile scope("builtin_profiler_test_toggled");
+    SetEnabled(false);
+  }
+  // A scope that began while enabled is completed.
+  EXPECT_EQ(FindStatistics("builtin_profiler_test_toggled").calls, 1);
+  SetEnabled(true);
+  // Unbalanced ends are ignored.
+  End();
+  {
+    ScopedProfile scope("builtin_profiler_test_toggled");
+  }
+  EXPECT_EQ(FindStatistics("builtin_profiler_test_toggled").calls, 2);
+}
+
+TEST_F(BuiltinProfilerTest, BeginEnd) {
+  EXPECT_TRUE(Begin("builtin_profiler_test_begin_end"));
+  End();
+  EXPECT_EQ(FindStatistics("builtin_profiler_test_begin_end").calls, 1);
+  SetEnabled(false);
+  EXPECT_FALSE(Begin("builtin_profiler_test_begin_end"));
+}
+
+TEST_F(BuiltinProfilerTest, EnabledWithinAScope) {
+  ASSERT_TRUE(Begin("builtin_profiler_test_outer"));
+  SetEnabled(false);
+  {
+    ScopedProfile scope("builtin_profiler_test_inner");
+    BeginSample("builtin_profiler_test_sample");
+    SetEnabled(true);
+    // Neither the sample nor the scope began, so they must not end the outer scope.
+    EndSample();
+  }
+  EXPECT_EQ(FindStatistics("builtin_profiler_test_outer").calls, 0);
+  End();
+  EXPECT_EQ(FindStatistics("builtin_profiler_test_outer").calls, 1);
+  EXPECT_EQ(FindStatistics("builtin_profiler_test_inner").calls, 0);
+  EXPECT_EQ(FindStatistics("builtin_profiler_test_sample").calls, 0);
+}
+
+TEST_F(BuiltinProfilerTest, Samples) {
+  BeginSample("builtin_profiler_test_sample");
+  EndSample();
+  EXPECT_EQ(FindStatistics("builtin_profiler_test_sample").calls, 1);
+  // Unbalanced ends are ignored.
+  EndSample();
+}
+
+TEST_F(BuiltinProfilerTest, MergesThreads) {
+  constexpr int kNumThreads{4};
+  constexpr int kNumScopes{1000};
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kNumThreads; ++t) {
+    threads.emplace_back([t]() {
+      SetThreadName("builtin_profiler_test_thread_" + std::to_string(t));
+      for (int i = 0; i < kNumScopes; ++i) {
+        ScopedProfile scope("builtin_profiler_test_threads");
+      }
+    });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(FindStatistics("builtin_profiler_test_threads").calls, kNumThreads * kNumScopes);
+}
+
+TEST_F(BuiltinProfilerTest, ChromeTrace) {
+  SetThreadName("builtin_profiler_test_main");
+  {
+    ScopedProfile outer("builtin_profiler_test_\"quoted\"");
+    ScopedProfile inner("builtin_profiler_test_inner");
+  }
+  const std::string trace = ChromeTrace();
+  EXPECT_EQ(trace.find("{\"traceEvents\":["), 0u);
+  EXPECT_NE(trace.find("\"args\":{\"name\":\"builtin_profiler_test_main\"}"), std::string::npos);
+  EXPECT_EQ(Count(trace, "\"name\":\"builtin_profiler_test_\\\"quoted\\\"\",\"ph\":\"B\""), 1);
+  EXPECT_EQ(Count(trace, "\"name\":\"builtin_profiler_test_inner\",\"ph\":\"B\""), 1);
+  EXPECT_EQ(Count(trace, "\"ph\":\"E\""), 2);
+}
+
+TEST_F(BuiltinProfilerTest, RingBufferKeepsTheLatestEvents) {
+  const int kNumScopes = static_cast<int>(kEventBufferSize);
+  for (int i = 0; i < kNumScopes; ++i) {
+    ScopedProfile scope("builtin_profiler_test_ring");
+  }
+  EXPECT_EQ(FindStatistics("builtin_profiler_test_ring").calls, kNumScopes);
+  // Every scope takes two events, so only the second half is buffered. The oldest buffered event is skipped, as
+  // it could be overwritten by an event being pushed, and so is the end event that matches it.
+  const std::string trace = ChromeTrace();
+  EXPECT_EQ(Count(trace, "\"ph\":\"B\""), kNumScopes / 2 - 1);
+  EXPECT_EQ(Count(trace, "\"ph\":\"E\""), kNumScopes / 2 - 1);
+}
+
+TEST_F(BuiltinProfilerTest, ChromeTraceRestoresStreamFlags) {
+  {
+    ScopedProfile scope("builtin_profiler_test_flags");
+  }
+  std::ostringstream os;
+  os << std::scientific;
+  WriteChromeTrace(os);
+  EXPECT_EQ(os.flags() & std::ios_base::floatfield, std::ios_base::scientific);
+}
+
+TEST_F(BuiltinProfilerTest, Reset) {
+  {
+    ScopedProfile scope("builtin_profiler_test_reset");
+  }
+  Reset();
+  EXPECT_EQ(FindStatistics("builtin_profiler_test_reset").calls, 0);
+  EXPECT_EQ(Count(ChromeTrace(), "builtin_profiler_test_reset"), 0);
+}
+
+TEST_F(BuiltinProfilerTest, ResetOtherThread) {
+  constexpr int kNumScopes{5};
+  std::mutex mutex;
+  std::condition_variable condition;
+  enum class Step { kStarted, kRecorded, kReset } step{Step::kStarted};
+  std::thread thread([&]() {
+    {
+      ScopedProfile scope("builtin_profiler_test_reset_other_thread");
+    }
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      step = Step::kRecorded;
+      condition.notify_all();
+      condition.wait(lock, [&step]() { return step == Step::kReset; });
+    }
+    for (int i = 0; i < kNumScopes; ++i) {
+      ScopedProfile scope("builtin_profiler_test_reset_other_thread");
+    }
+  });
+  {
+    std::unique_lock<std::mutex> lock(mutex);
+    condition.wait(lock, [&step]() { return step == Step::kRecorded; });
+  }
+  EXPECT_EQ(FindStatistics("builtin_profiler_test_reset_other_thread").calls, 1);
+  Reset();
+  // The thread discards its statistics when it records again; meanwhile they are not reported.
+  EXPECT_EQ(FindStatistics("builtin_profiler_test_reset_other_thread").calls, 0);
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    step = Step::kReset;
+    condition.notify_all();
+  }
+  thread.join();
+  EXPECT_EQ(FindStatistics("builtin_profiler_test_reset_other_thread").calls, kNumScopes);
+}
+
+TEST_F(BuiltinProfilerTest, ResetWhileRecording) {
+  std::atomic<bool> stop{false};
+  std::thread thread([&stop]() {
+    while (!stop.load()) {
+      ScopedProfile scope("builtin_profiler_test_reset_while_recording");
+    }
+  });
+  for (int i = 0; i < 100; ++i) {
+    Reset();
+    const ScopeStatistics statistics = FindStatistics("builtin_profiler_test_reset_while_recording");
+    int64_t histogram_calls{0};
+    for (const int64_t count : statistics.histogram) {
+      histogram_calls += count;
+    }
+    EXPECT_LE(statistics.calls, histogram_calls + 1);
+  }
+  stop.store(true);
+  thread.join();
+  Reset();
+  EXPECT_EQ(FindStatistics("builtin_profiler_test_reset_while_recording").calls, 0);
+}
+
+}  // namespace
+}  // namespace profiler
+}  // namespace common
+}  // namespace maliput
@@ -0,0 +1,125 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2023, Woven by Toyota. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "maliput/common/interval_tree.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "maliput/common/assertion_error.h"
+
+namespace maliput {
+namespace common {
+namespace test {
+namespace {
+
+using Tree = IntervalTree<int>;
+
+// Returns the values of the intervals of `tree` that overlap [min, max], sorted.
+std::vector<int> VisitSorted(const Tree& tree, double min, double max) {
+  std::vector<int> values;
+  tree.Visit(min, max, [&values](const Tree::Interval& interval) { values.push_back(interval.value); });
+  std::sort(values.begin(), values.end());
+  return values;
+}
+
+TEST(IntervalTreeTest, Empty) {
+  Tree dut;
+  EXPECT_TRUE(dut.empty());
+  EXPECT_TRUE(dut.is_built());
+  EXPECT_TRUE(VisitSorted(dut, -10., 10.).empty());
+}
+
+TEST(IntervalTreeTest, InsertRequiresBuild) {
+  Tree dut;
+  EXPECT_THROW(dut.Insert(2., 1., 0), assertion_error);
+  dut.Insert(1., 2., 0);
+  EXPECT_FALSE(dut.is_built());
+  EXPECT_THROW(VisitSorted(dut, 0., 3.), assertion_error);
+  dut.Build();
+  EXPECT_TRUE(dut.is_built());
+  EXPECT_EQ(VisitSorted(dut, 0., 3.), std::vector<int>{0});
+}
+
+TEST(IntervalTreeTest, ClosedIntervals) {
+  Tree dut;
+  dut.Insert(1., 2., 0);
+  dut.Insert(3., 3., 1);
+  dut.Build();
+  EXPECT_EQ(VisitSorted(dut, 2., 2.), std::vector<int>{0});
+  EXPECT_EQ(VisitSorted(dut, 2., 3.), (std::vector<int>{0, 1}));
+  EXPECT_EQ(VisitSorted(dut, 3., 5.), std::vector<int>{1});
+  EXPECT_TRUE(VisitSorted(dut, 2.5, 2.9).empty());
+  EXPECT_TRUE(VisitSorted(dut, 0., 0.9).empty());
+}
+
+// Compares Visit() to checking every interval, with nested, overlapping and disjoint intervals.
+TEST(IntervalTreeTest, MatchesLinearScan) {
+  const int kNumIntervals{300};
+  std::vector<Tree::Interval> intervals;
+  Tree dut;
+  for (int i = 0; i < kNumIntervals; ++i) {
+    const double min = std::fmod(37. * i, 100.);
+    const double max = min + std::fmod(7.3 * i, 25.);
+    intervals.push_back({min, max, i});
+    dut.Insert(min, max, i);
+  }
+  const auto check = [&]() {
+    dut.Build();
+    for (double min = -5.; min < 130.; min += 3.1) {
+      for (const double length : {0., 0.5, 12.}) {
+        std::vector<int> expected;
+        for (const Tree::Interval& interval : intervals) {
+          if (interval.max >= min && interval.min <= min + length) {
+            expected.push_back(interval.value);
+          }
+        }
+        ASSERT_EQ(VisitSorted(dut, min, min + length), expected);
+      }
+    }
+  };
+  check();
+
+  const auto is_removed = [](const Tree::Interval& interval) { return interval.value % 4 == 0; };
+  dut.RemoveIf(is_removed);
+  intervals.erase(std::remove_if(intervals.begin(), intervals.end(), is_removed), intervals.end());
+  EXPECT_EQ(dut.size(), intervals.size());
+  check();
+
+  dut.Clear();
+  EXPECT_TRUE(dut.empty());
+  EXPECT_TRUE(VisitSorted(dut, -10., 200.).empty());
+}
+
+}  // namespace
+}  // namespace test
+}  // namespace common
+}  // namespace maliput
@@ -0,0 +1,119 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2023, Woven by Toyota. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "maliput/common/mapped_file.h"
+
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "maliput/common/filesystem.h"
+
+namespace maliput {
+namespace common {
+namespace test {
+namespace {
+
+class MappedFileTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    directory_.set_as_temp();
+    directory_.append("MappedFileTest");
+    ASSERT_TRUE(Filesystem::create_directory(directory_));
+    path_ = directory_.get_path() + "/file.bin";
+  }
+
+  void TearDown() override {
+    Filesystem::remove_file(Path(path_));
+    ASSERT_TRUE(Filesystem::remove_directory(directory_));
+  }
+
+  Path directory_;
+  std::string path_;
+};
+
+TEST_F(MappedFileTest, NonExistentFile) {
+  const MappedFile dut(path_);
+  EXPECT_EQ(nullptr, dut.data());
+  EXPECT_EQ(0u, dut.size());
+}
+
+TEST_F(MappedFileTest, WriteFileAtomically) {
+  const std::string kContents{"contents"};
+  ASSERT_TRUE(WriteFileAtomically(path_, [&kContents](std::ostream* os) { *os << kContents; }));
+  const MappedFile dut(path_);
+  ASSERT_NE(nullptr, dut.data());
+  EXPECT_EQ(kContents, std::string(dut.data(), dut.size()));
+
+  EXPECT_FALSE(WriteFileAtomically(directory_.get_path() + "/non_existent_directory/file.bin", [](std::ostream*) {}));
+  // A failed write leaves the previous file untouched.
+  EXPECT_FALSE(WriteFileAtomically(path_, [](std::ostream* os) { os->setstate(std::ios::badbit); }));
+  EXPECT_EQ(kContents, std::string(MappedFile(path_).data(), kContents.size()));
+}
+
+// An exception thrown while writing propagates and doesn't leave the temporary file behind.
+TEST_F(MappedFileTest, ThrowingWriteFileAtomically) {
+  EXPECT_THROW(WriteFileAtomically(path_, [](std::ostream*) { throw std::runtime_error("write failed"); }),
+               std::runtime_error);
+  EXPECT_EQ(nullptr, MappedFile(path_).data());
+  // The directory is empty.
+  EXPECT_TRUE(Filesystem::remove_directory(directory_));
+  EXPECT_TRUE(Filesystem::create_directory(directory_));
+}
+
+// Concurrent writers never share a temporary file, so the result is the complete contents of one of them and no
+// temporary file is left behind.
+TEST_F(MappedFileTest, ConcurrentWriteFileAtomically) {
+  constexpr int kNumThreads{8};
+  constexpr std::size_t kSize{1 << 16};
+  std::vector<std::thread> threads;
+  for (int i = 0; i < kNumThreads; ++i) {
+    threads.emplace_back([this, i]() {
+      EXPECT_TRUE(WriteFileAtomically(path_, [i](std::ostream* os) { *os << std::string(kSize, 'a' + i); }));
+    });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+  const MappedFile dut(path_);
+  ASSERT_EQ(kSize, dut.size());
+  const std::string contents(dut.data(), dut.size());
+  EXPECT_EQ(std::string(kSize, contents.front()), contents);
+  // Only the file itself is left in the directory.
+  EXPECT_TRUE(Filesystem::remove_file(Path(path_)));
+  EXPECT_TRUE(Filesystem::remove_directory(directory_));
+  EXPECT_TRUE(Filesystem::create_directory(directory_));
+}
+
+}  // namespace
+}  // namespace test
+}  // namespace common
+}  // namespace maliput
@@ -0,0 +1,92 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2023, Woven by Toyota. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "maliput/common/parallel_for.h"
+
+#include <atomic>
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace maliput {
+namespace common {
+namespace {
+
+// Chunks cover [0, size) contiguously, and there is a single one without threads.
+GTEST_TEST(MakeChunksTest, CoversTheRange) {
+  EXPECT_TRUE(MakeChunks(0, 4).empty());
+  for (const std::size_t num_threads : {1u, 2u, 3u}) {
+    for (const std::size_t size : {1u, 5u, 11u, 100u}) {
+      const std::vector<std::pair<std::size_t, std::size_t>> chunks = MakeChunks(size, num_threads);
+      ASSERT_FALSE(chunks.empty());
+      EXPECT_LE(chunks.size(), num_threads > 1 ? num_threads * kChunksPerThread : 1u);
+      EXPECT_EQ(chunks.front().first, 0u);
+      EXPECT_EQ(chunks.back().second, size);
+      for (std::size_t i = 0; i < chunks.size(); ++i) {
+        EXPECT_LT(chunks[i].first, chunks[i].second);
+        if (i > 0) {
+          EXPECT_EQ(chunks[i].first, chunks[i - 1].second);
+        }
+      }
+    }
+  }
+  EXPECT_EQ(MakeChunks(100, 1).size(), 1u);
+  EXPECT_EQ(MakeChunks(100, 2).size(), 2 * kChunksPerThread);
+}
+
+GTEST_TEST(ParallelForTest, RunsEveryTask) {
+  constexpr std::size_t kNumTasks{1000};
+  for (const std::size_t num_threads : {1u, 4u}) {
+    std::vector<std::atomic<int>> calls(kNumTasks);
+    ParallelFor(kNumTasks, num_threads, [&calls](std::size_t i) { ++calls[i]; });
+    for (const std::atomic<int>& count : calls) {
+      EXPECT_EQ(count.load(), 1);
+    }
+  }
+}
+
+GTEST_TEST(ParallelForTest, RethrowsAfterRunningEveryTask) {
+  constexpr std::size_t kNumTasks{100};
+  std::atomic<std::size_t> calls{0};
+  EXPECT_THROW(ParallelFor(kNumTasks, 4,
+                           [&calls](std::size_t i) {
+                             ++calls;
+                             if (i % 10 == 0) {
+                               throw std::runtime_error("task failed");
+                             }
+                           }),
+               std::runtime_error);
+  EXPECT_EQ(calls.load(), kNumTasks);
+}
+
+}  // namespace
+}  // namespace common
+}  // namespace maliput
@@ -38,7 +38,7 @@ namespace {
 
 // By default the profiler is disabled and it is not expected to be enabled in production.
 GTEST_TEST(Profiler, TestDefaultValue) {
-#if MALIPUT_PROFILER_ENABLE
+#if MALIPUT_PROFILER_ENABLE || MALIPUT_BUILTIN_PROFILER_ENABLE
   EXPECT_TRUE(MALIPUT_PROFILER_VALID);
 #else
   EXPECT_FALSE(MALIPUT_PROFILER_VALID);
@@ -0,0 +1,136 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2023, Woven by Toyota. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "maliput/common/shared_string.h"
+
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "maliput/common/maliput_hash.h"
+
+namespace maliput {
+namespace common {
+namespace {
+
+GTEST_TEST(SharedStringTest, Empty) {
+  const SharedString dut;
+  EXPECT_EQ(dut.string(), "");
+  EXPECT_EQ(dut.hash(), DefaultHash{}(std::string()));
+  EXPECT_FALSE(dut.is_interned());
+  EXPECT_EQ(dut, SharedString(""));
+}
+
+GTEST_TEST(SharedStringTest, CopiesShareTheInstance) {
+  const std::size_t initial_size = SharedString::table_size();
+  const SharedString dut("shared_string_test_a");
+  EXPECT_EQ(dut.string(), "shared_string_test_a");
+  EXPECT_EQ(dut.hash(), DefaultHash{}(std::string("shared_string_test_a")));
+  EXPECT_FALSE(dut.is_interned());
+  // Strings that are not interned don't use the table.
+  EXPECT_EQ(SharedString::table_size(), initial_size);
+
+  SharedString copy(dut);
+  EXPECT_TRUE(copy.shares_instance_with(dut));
+  const SharedString other("shared_string_test_a");
+  EXPECT_FALSE(other.shares_instance_with(dut));
+  EXPECT_EQ(other, dut);
+  EXPECT_NE(SharedString("shared_string_test_b"), dut);
+
+  const SharedString moved(std::move(copy));
+  EXPECT_TRUE(moved.shares_instance_with(dut));
+  copy = moved;
+  EXPECT_TRUE(copy.shares_instance_with(dut));
+}
+
+GTEST_TEST(SharedStringTest, EqualInternedStringsShareTheInstance) {
+  const SharedString dut = SharedString::Intern("shared_string_test_c");
+  EXPECT_TRUE(dut.is_interned());
+  EXPECT_EQ(dut.string(), "shared_string_test_c");
+  EXPECT_EQ(dut.hash(), DefaultHash{}(std::string("shared_string_test_c")));
+  EXPECT_TRUE(SharedString::Intern(std::string("shared_string_test_") + "c").shares_instance_with(dut));
+  EXPECT_FALSE(SharedString::Intern("shared_string_test_d").shares_instance_with(dut));
+  EXPECT_EQ(SharedString("shared_string_test_c"), dut);
+}
+
+GTEST_TEST(SharedStringTest, TableHoldsLiveInternedStrings) {
+  const std::size_t initial_size = SharedString::table_size();
+  {
+    const SharedString e1 = SharedString::Intern("shared_string_test_e");
+    const SharedString e2 = SharedString::Intern("shared_string_test_e");
+    const SharedString f = SharedString::Intern("shared_string_test_f");
+    EXPECT_EQ(SharedString::table_size(), initial_size + 2);
+    {
+      const SharedString e3(e1);
+    }
+    EXPECT_EQ(SharedString::table_size(), initial_size + 2);
+  }
+  // Strings leave the table with their last copy.
+  EXPECT_EQ(SharedString::table_size(), initial_size);
+  // Interning transient strings doesn't grow the table.
+  for (int i = 0; i < 100; ++i) {
+    SharedString::Intern("shared_string_test_transient_" + std::to_string(i));
+  }
+  EXPECT_EQ(SharedString::table_size(), initial_size);
+}
+
+GTEST_TEST(SharedStringTest, ConcurrentInterning) {
+  constexpr int kNumThreads{8};
+  constexpr int kNumStrings{1000};
+  const std::size_t initial_size = SharedString::table_size();
+  std::vector<std::vector<SharedString>> results(kNumThreads);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kNumThreads; ++t) {
+    threads.emplace_back([&results, t]() {
+      for (int i = 0; i < kNumStrings; ++i) {
+        const std::string string = "shared_string_test_concurrent_" + std::to_string(i);
+        // Interns and releases a transient copy as well, racing with the other threads to remove it.
+        SharedString::Intern(string);
+        results[t].push_back(SharedString::Intern(string));
+      }
+    });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(SharedString::table_size(), initial_size + kNumStrings);
+  for (int t = 1; t < kNumThreads; ++t) {
+    for (int i = 0; i < kNumStrings; ++i) {
+      EXPECT_TRUE(results[t][i].shares_instance_with(results[0][i]));
+    }
+  }
+  results.clear();
+  EXPECT_EQ(SharedString::table_size(), initial_size);
+}
+
+}  // namespace
+}  // namespace common
+}  // namespace maliput
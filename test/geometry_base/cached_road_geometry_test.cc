@@ -0,0 +1,232 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2023, Woven by Toyota. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "maliput/geometry_base/cached_road_geometry.h"
+
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "maliput/api/branch_point.h"
+#include "maliput/api/junction.h"
+#include "maliput/api/lane.h"
+#include "maliput/api/segment.h"
+#include "maliput/common/assertion_error.h"
+#include "maliput/geometry_base/cached_lane.h"
+#include "maliput/geometry_base/lru_cache.h"
+#include "maliput/geometry_base/road_geometry.h"
+#include "straight_lanes_road_geometry.h"
+
+namespace maliput {
+namespace geometry_base {
+namespace test {
+namespace {
+
+constexpr double kQuantum{1e-6};
+constexpr std::size_t kCapacity{16};
+
+GTEST_TEST(LruCacheTest, EvictsTheLeastRecentlyUsedEntry) {
+  EXPECT_THROW((LruCache<int, int>(0)), common::assertion_error);
+
+  LruCache<int, int> dut(2);
+  EXPECT_EQ(dut.capacity(), 2u);
+  dut.Put(1, 10);
+  dut.Put(2, 20);
+  // Uses 1, so 2 becomes the least recently used entry.
+  EXPECT_EQ(dut.Get(1), 10);
+  dut.Put(3, 30);
+  EXPECT_EQ(dut.size(), 2u);
+  EXPECT_EQ(dut.Get(2), std::nullopt);
+  EXPECT_EQ(dut.Get(3), 30);
+  EXPECT_EQ(dut.GetOrCompute(1, []() { return -1; }), 10);
+  EXPECT_EQ(dut.GetOrCompute(4, []() { return 40; }), 40);
+  EXPECT_EQ(dut.Get(4), 40);
+
+  const CacheStatistics statistics = dut.statistics();
+  EXPECT_EQ(statistics.hits, 4);
+  EXPECT_EQ(statistics.misses, 2);
+  EXPECT_DOUBLE_EQ(statistics.hit_rate(), 4. / 6.);
+  EXPECT_EQ(CacheStatistics{}.hit_rate(), 0.);
+}
+
+class CachedRoadGeometryTest : public ::testing::Test {
+ protected:
+  static constexpr int kNumSegments{3};
+  static constexpr int kNumLanes{2};
+  static constexpr double kLength{20.};
+  static constexpr double kLaneWidth{4.};
+
+  std::unique_ptr<RoadGeometry> road_geometry_{
+      MakeLanesGridRoadGeometry(kNumSegments, kNumLanes, kLength, kLaneWidth)};
+};
+
+TEST_F(CachedRoadGeometryTest, CachedLane) {
+  const api::Lane* lane = road_geometry_->junction(1)->segment(0)->lane(1);
+  EXPECT_THROW(CachedLane(nullptr, kQuantum, kCapacity), common::assertion_error);
+  EXPECT_THROW(CachedLane(lane, 0., kCapacity), common::assertion_error);
+  EXPECT_THROW(CachedLane(lane, kQuantum, 0), common::assertion_error);
+
+  const CachedLane dut(lane, kQuantum, kCapacity);
+  EXPECT_EQ(dut.lane(), lane);
+  EXPECT_EQ(dut.quantum(), kQuantum);
+  EXPECT_EQ(dut.id(), lane->id());
+  EXPECT_EQ(dut.segment(), lane->segment());
+  EXPECT_EQ(dut.to_left(), lane->to_left());
+  EXPECT_EQ(dut.length(), lane->length());
+  EXPECT_EQ(dut.GetOngoingBranches(api::LaneEnd::kFinish), lane->GetOngoingBranches(api::LaneEnd::kFinish));
+
+  for (int i = 0; i < 3; ++i) {
+    for (const double s : {0., 5., kLength}) {
+      EXPECT_EQ(dut.lane_bounds(s).max(), lane->lane_bounds(s).max());
+      EXPECT_EQ(dut.segment_bounds(s).min(), lane->segment_bounds(s).min());
+      EXPECT_EQ(dut.elevation_bounds(s, 1.).max(), lane->elevation_bounds(s, 1.).max());
+      EXPECT_NEAR((dut.ToInertialPosition({s, 1., 0.5}).xyz() - lane->ToInertialPosition({s, 1., 0.5}).xyz()).norm(),
+                  0., 1e-9);
+    }
+  }
+  // Arguments within half a quantum share the entry.
+  dut.lane_bounds(5. + 0.4 * kQuantum);
+
+  const CachedLane::Statistics statistics = dut.statistics();
+  EXPECT_EQ(statistics.lane_bounds.misses, 3);
+  EXPECT_EQ(statistics.lane_bounds.hits, 7);
+  EXPECT_EQ(statistics.segment_bounds.misses, 3);
+  EXPECT_EQ(statistics.segment_bounds.hits, 6);
+  EXPECT_EQ(statistics.elevation_bounds.misses, 3);
+  EXPECT_EQ(statistics.to_inertial_position.misses, 3);
+  EXPECT_EQ(statistics.to_inertial_position.hits, 6);
+}
+
+TEST_F(CachedRoadGeometryTest, CachedRoadGeometry) {
+  EXPECT_THROW(CachedRoadGeometry(nullptr, kQuantum, kCapacity), common::assertion_error);
+
+  const CachedRoadGeometry dut(road_geometry_.get(), kQuantum, kCapacity);
+  EXPECT_EQ(dut.road_geometry(), road_geometry_.get());
+  EXPECT_EQ(dut.id(), road_geometry_->id());
+  EXPECT_EQ(dut.num_junctions(), road_geometry_->num_junctions());
+  EXPECT_EQ(dut.linear_tolerance(), road_geometry_->linear_tolerance());
+
+  // Lanes are decorated.
+  ASSERT_EQ(dut.ById().GetLanes().size(), road_geometry_->ById().GetLanes().size());
+  for (const auto& [id, lane] : road_geometry_->ById().GetLanes()) {
+    const CachedLane* cached_lane = dut.GetCachedLane(lane);
+    ASSERT_NE(cached_lane, nullptr);
+    EXPECT_EQ(cached_lane->lane(), lane);
+    EXPECT_EQ(dut.GetCachedLane(cached_lane), cached_lane);
+    EXPECT_EQ(dut.ById().GetLane(id), cached_lane);
+    EXPECT_EQ(dut.ById().GetLanes().at(id), cached_lane);
+    EXPECT_EQ(dut.ById().GetLaneByIndex(*dut.ById().GetLaneIndex(id)), cached_lane);
+  }
+  const api::Segment* segment = dut.ById().GetSegment(api::SegmentId("s_1"));
+  ASSERT_NE(segment, nullptr);
+  EXPECT_NE(segment, road_geometry_->ById().GetSegment(api::SegmentId("s_1")));
+  EXPECT_EQ(segment->id(), api::SegmentId("s_1"));
+
+  // Position queries return decorated lanes and accept either lane as hint.
+  const api::InertialPosition inertial_position(kLength + 3., 1., 0.);
+  const api::RoadPositionResult expected = road_geometry_->ToRoadPosition(inertial_position);
+  const api::RoadPositionResult result = dut.ToRoadPosition(inertial_position);
+  EXPECT_EQ(result.road_position.lane, dut.GetCachedLane(expected.road_position.lane));
+  EXPECT_EQ(result.road_position.pos.srh(), expected.road_position.pos.srh());
+  const api::RoadPositionResult hinted = dut.ToRoadPosition(inertial_position, result.road_position);
+  EXPECT_EQ(hinted.road_position.lane, result.road_position.lane);
+  const std::vector<api::RoadPositionResult> batch =
+      dut.ToRoadPositions({inertial_position}, {expected.road_position});
+  ASSERT_EQ(batch.size(), 1u);
+  EXPECT_EQ(batch.front().road_position.lane, result.road_position.lane);
+  for (const api::RoadPositionResult& found : dut.FindRoadPositions(inertial_position, kLaneWidth)) {
+    EXPECT_NE(dut.GetCachedLane(found.road_position.lane), nullptr);
+    EXPECT_EQ(dut.GetCachedLane(found.road_position.lane), found.road_position.lane);
+  }
+
+  result.road_position.lane->lane_bounds(1.);
+  result.road_position.lane->lane_bounds(1.);
+  EXPECT_EQ(dut.statistics().lane_bounds.hits, 1);
+  EXPECT_EQ(dut.statistics().lane_bounds.misses, 1);
+}
+
+// Navigating the hierarchy yields the same decorators as ById(), whose owners are decorators too.
+TEST_F(CachedRoadGeometryTest, CachedHierarchy) {
+  const CachedRoadGeometry dut(road_geometry_.get(), kQuantum, kCapacity);
+  const api::RoadGeometry::IdIndex& id_index = dut.ById();
+
+  ASSERT_EQ(dut.num_junctions(), kNumSegments);
+  for (int i = 0; i < dut.num_junctions(); ++i) {
+    const api::Junction* junction = dut.junction(i);
+    EXPECT_EQ(junction->road_geometry(), &dut);
+    EXPECT_EQ(id_index.GetJunction(junction->id()), junction);
+    for (int j = 0; j < junction->num_segments(); ++j) {
+      const api::Segment* segment = junction->segment(j);
+      EXPECT_EQ(segment->junction(), junction);
+      EXPECT_EQ(id_index.GetSegment(segment->id()), segment);
+      EXPECT_EQ(id_index.GetSegmentByIndex(*id_index.GetSegmentIndex(segment->id())), segment);
+      for (int k = 0; k < segment->num_lanes(); ++k) {
+        const api::Lane* lane = segment->lane(k);
+        EXPECT_EQ(id_index.GetLane(lane->id()), lane);
+        EXPECT_EQ(lane->segment(), segment);
+        if (lane->to_left() != nullptr) {
+          EXPECT_EQ(lane->to_left(), id_index.GetLane(lane->to_left()->id()));
+        }
+        for (const api::LaneEnd::Which which_end : {api::LaneEnd::kStart, api::LaneEnd::kFinish}) {
+          const api::BranchPoint* branch_point = lane->GetBranchPoint(which_end);
+          ASSERT_NE(branch_point, nullptr);
+          EXPECT_EQ(branch_point->road_geometry(), &dut);
+          EXPECT_EQ(id_index.GetBranchPoint(branch_point->id()), branch_point);
+          const api::LaneEndSet* confluent = lane->GetConfluentBranches(which_end);
+          EXPECT_TRUE(confluent == branch_point->GetASide() || confluent == branch_point->GetBSide());
+          EXPECT_NE(lane->GetOngoingBranches(which_end), confluent);
+          for (const api::LaneEndSet* lane_end_set : {confluent, lane->GetOngoingBranches(which_end)}) {
+            for (int l = 0; l < lane_end_set->size(); ++l) {
+              EXPECT_EQ(id_index.GetLane(lane_end_set->get(l).lane->id()), lane_end_set->get(l).lane);
+            }
+          }
+          const std::optional<api::LaneEnd> default_branch = lane->GetDefaultBranch(which_end);
+          if (default_branch.has_value()) {
+            EXPECT_EQ(id_index.GetLane(default_branch->lane->id()), default_branch->lane);
+          }
+        }
+      }
+    }
+  }
+  EXPECT_EQ(dut.num_branch_points(), road_geometry_->num_branch_points());
+  for (int i = 0; i < dut.num_branch_points(); ++i) {
+    EXPECT_EQ(id_index.GetBranchPoint(dut.branch_point(i)->id()), dut.branch_point(i));
+  }
+
+  // The decorated hierarchy is consistent, so it satisfies the invariants of the wrapped one.
+  ASSERT_TRUE(road_geometry_->CheckInvariants().empty());
+  EXPECT_TRUE(dut.CheckInvariants().empty());
+  EXPECT_TRUE(dut.FindInvariantViolations(2).empty());
+}
+
+}  // namespace
+}  // namespace test
+}  // namespace geometry_base
+}  // namespace maliput
@@ -31,13 +31,17 @@
 #include "maliput/test_utilities/mock_geometry.h"
 /* clang-format on */
 
+#include <memory>
+#include <string>
 #include <vector>
 
 #include <gtest/gtest.h>
 
 #include "assert_compare.h"
+#include "maliput/api/basic_id_index.h"
 #include "maliput/api/compare.h"
 #include "maliput/common/maliput_unused.h"
+#include "straight_lanes_road_geometry.h"
 
 namespace maliput {
 namespace geometry_base {
@@ -269,6 +273,168 @@ GTEST_TEST(GeometryBaseRoadGeometryTest, AddingBranchPoints) {
   EXPECT_THROW(dut.AddBranchPoint(std::move(another0)), std::exception);
 }
 
+// Expects @p lhs and @p rhs to hold the same violations in the same order.
+void ExpectSameViolations(const std::vector<api::InvariantViolation>& lhs,
+                          const std::vector<api::InvariantViolation>& rhs) {
+  ASSERT_EQ(lhs.size(), rhs.size());
+  for (std::size_t i = 0; i < lhs.size(); ++i) {
+    EXPECT_EQ(lhs[i].type, rhs[i].type);
+    EXPECT_EQ(lhs[i].id, rhs[i].id);
+    EXPECT_EQ(lhs[i].reference_id, rhs[i].reference_id);
+    EXPECT_EQ(lhs[i].end, rhs[i].end);
+    EXPECT_EQ(lhs[i].reference_end, rhs[i].reference_end);
+    EXPECT_EQ(lhs[i].error, rhs[i].error);
+    EXPECT_EQ(lhs[i].claimed_index, rhs[i].claimed_index);
+    EXPECT_EQ(lhs[i].message, rhs[i].message);
+  }
+}
+
+GTEST_TEST(GeometryBaseRoadGeometryTest, FindInvariantViolations) {
+  const double kSomePositiveDouble = 7.0;
+  const math::Vector3 kInertialToBackendFrameTranslation{0., 0., 0.};
+  MockRoadGeometry dut(api::RoadGeometryId("dut"), kSomePositiveDouble, kSomePositiveDouble, kSomePositiveDouble,
+                       kInertialToBackendFrameTranslation);
+  const int kNumBranchPoints{10};
+  for (int i = 0; i < kNumBranchPoints; ++i) {
+    dut.AddBranchPoint(std::make_unique<MockBranchPoint>(api::BranchPointId("bp" + std::to_string(i))));
+  }
+
+  const std::vector<api::InvariantViolation> violations = dut.FindInvariantViolations();
+  ASSERT_EQ(static_cast<int>(violations.size()), kNumBranchPoints);
+  for (int i = 0; i < kNumBranchPoints; ++i) {
+    EXPECT_EQ(violations[i].type, api::InvariantViolation::Type::kEmptyBranchPoint);
+    EXPECT_EQ(violations[i].id, "bp" + std::to_string(i));
+    EXPECT_EQ(violations[i].reference_id, "bp" + std::to_string(i));
+    EXPECT_EQ(violations[i].message, "BranchPoint bp" + std::to_string(i) + " is empty.");
+  }
+  EXPECT_EQ(dut.CheckInvariants().size(), violations.size());
+
+  // The parallel evaluation reports the same violations in the same order.
+  ExpectSameViolations(dut.FindInvariantViolations(3), violations);
+  EXPECT_THROW(dut.FindInvariantViolations(0), std::exception);
+}
+
+// A MockLane of length kLength with fixed poses at its ends, which claims @p claimed_index as its index.
+class PosedLane final : public MockLane {
+ public:
+  static constexpr double kLength{10.};
+
+  PosedLane(const api::LaneId& id, const api::InertialPosition& start, const api::Rotation& start_rotation,
+            const api::InertialPosition& finish, const api::Rotation& finish_rotation, int claimed_index)
+      : MockLane(id),
+        start_(start),
+        start_rotation_(start_rotation),
+        finish_(finish),
+        finish_rotation_(finish_rotation),
+        claimed_index_(claimed_index) {}
+
+ private:
+  int do_index() const override { return claimed_index_; }
+  double do_length() const override { return kLength; }
+  api::InertialPosition DoToInertialPosition(const api::LanePosition& lane_pos) const override {
+    return lane_pos.s() == 0. ? start_ : finish_;
+  }
+  api::Rotation DoGetOrientation(const api::LanePosition& lane_pos) const override {
+    return lane_pos.s() == 0. ? start_rotation_ : finish_rotation_;
+  }
+
+  const api::InertialPosition start_;
+  const api::Rotation start_rotation_;
+  const api::InertialPosition finish_;
+  const api::Rotation finish_rotation_;
+  const int claimed_index_{};
+};
+
+// A MockSegment that claims to be owned by @p claimed_junction.
+class MisownedSegment final : public MockSegment {
+ public:
+  MisownedSegment(const api::SegmentId& id, const api::Junction* claimed_junction)
+      : MockSegment(id), claimed_junction_(claimed_junction) {}
+
+ private:
+  const api::Junction* do_junction() const override { return claimed_junction_; }
+
+  const api::Junction* claimed_junction_{};
+};
+
+GTEST_TEST(GeometryBaseRoadGeometryTest, FindInvariantViolationsOfLanes) {
+  constexpr double kLinearTolerance{0.01};
+  constexpr double kAngularTolerance{0.01};
+  constexpr double kOffset{0.5};
+  constexpr double kLength{PosedLane::kLength};
+  const api::Rotation kIdentity = api::Rotation::FromRpy(0., 0., 0.);
+  MockRoadGeometry dut(api::RoadGeometryId("dut"), kLinearTolerance, kAngularTolerance, 1. /* scale_length */,
+                       math::Vector3{0., 0., 0.});
+
+  // Lane "l0" ends where lane "l1" should start, but "l1" starts kOffset meters further, yawed kOffset radians, and
+  // it claims index 5 within its Segment.
+  auto segment = std::make_unique<MockSegment>(api::SegmentId("s"));
+  PosedLane* l0 = segment->AddLane(std::make_unique<PosedLane>(
+      api::LaneId("l0"), api::InertialPosition(0., 0., 0.), kIdentity, api::InertialPosition(kLength, 0., 0.),
+      kIdentity, 0 /* claimed_index */));
+  PosedLane* l1 = segment->AddLane(std::make_unique<PosedLane>(
+      api::LaneId("l1"), api::InertialPosition(kLength + kOffset, 0., 0.), api::Rotation::FromRpy(0., 0., kOffset),
+      api::InertialPosition(2. * kLength, 0., 0.), kIdentity, 5 /* claimed_index */));
+  auto junction = std::make_unique<MockJunction>(api::JunctionId("j"));
+  const api::Junction* raw_junction = junction->AddSegment(std::move(segment))->junction();
+  dut.AddJunction(std::move(junction));
+  // Segment "s2" of Junction "j2" claims to be owned by "j".
+  auto other_junction = std::make_unique<MockJunction>(api::JunctionId("j2"));
+  other_junction->AddSegment(std::make_unique<MisownedSegment>(api::SegmentId("s2"), raw_junction));
+  dut.AddJunction(std::move(other_junction));
+
+  BranchPoint* bp0 = dut.AddBranchPoint(std::make_unique<MockBranchPoint>(api::BranchPointId("bp0")));
+  bp0->AddABranch(l0, api::LaneEnd::kStart);
+  BranchPoint* bp1 = dut.AddBranchPoint(std::make_unique<MockBranchPoint>(api::BranchPointId("bp1")));
+  bp1->AddABranch(l0, api::LaneEnd::kFinish);
+  bp1->AddBBranch(l1, api::LaneEnd::kStart);
+  BranchPoint* bp2 = dut.AddBranchPoint(std::make_unique<MockBranchPoint>(api::BranchPointId("bp2")));
+  bp2->AddABranch(l1, api::LaneEnd::kFinish);
+
+  // Hierarchy violations come before continuity violations.
+  const std::vector<api::InvariantViolation> violations = dut.FindInvariantViolations();
+  ASSERT_EQ(violations.size(), 4u);
+
+  EXPECT_EQ(violations[0].type, api::InvariantViolation::Type::kLaneIndex);
+  EXPECT_EQ(violations[0].id, "l1");
+  EXPECT_EQ(violations[0].reference_id, "");
+  EXPECT_EQ(violations[0].claimed_index, 5);
+  EXPECT_EQ(violations[0].error, 0.);
+  EXPECT_EQ(violations[0].message, "Lane l1 has index 1 but claims to have index 5.");
+
+  EXPECT_EQ(violations[1].type, api::InvariantViolation::Type::kSegmentOwnership);
+  EXPECT_EQ(violations[1].id, "s2");
+  EXPECT_EQ(violations[1].reference_id, "j2");
+  EXPECT_EQ(violations[1].claimed_index, std::nullopt);
+
+  EXPECT_EQ(violations[2].type, api::InvariantViolation::Type::kLaneEndPosition);
+  EXPECT_EQ(violations[2].id, "l1");
+  EXPECT_EQ(violations[2].reference_id, "l0");
+  EXPECT_EQ(violations[2].end, api::LaneEnd::kStart);
+  EXPECT_EQ(violations[2].reference_end, api::LaneEnd::kFinish);
+  EXPECT_NEAR(violations[2].error, kOffset, 1e-12);
+
+  EXPECT_EQ(violations[3].type, api::InvariantViolation::Type::kLaneEndOrientation);
+  EXPECT_EQ(violations[3].id, "l1");
+  EXPECT_EQ(violations[3].reference_id, "l0");
+  EXPECT_EQ(violations[3].end, api::LaneEnd::kStart);
+  EXPECT_EQ(violations[3].reference_end, api::LaneEnd::kFinish);
+  // The start of "l1" is compared, reversed, with the orientation out of the finish of "l0".
+  const double kExpectedAngularError = kIdentity.Reverse().Distance(api::Rotation::FromRpy(0., 0., kOffset).Reverse());
+  EXPECT_GT(kExpectedAngularError, kAngularTolerance);
+  EXPECT_NEAR(violations[3].error, kExpectedAngularError, 1e-12);
+
+  const std::vector<std::string> messages = dut.CheckInvariants();
+  ASSERT_EQ(messages.size(), violations.size());
+  for (std::size_t i = 0; i < violations.size(); ++i) {
+    EXPECT_EQ(messages[i], violations[i].message);
+  }
+  // The parallel evaluation reports the same violations in the same order.
+  for (const std::size_t num_threads : {2u, 3u, 8u}) {
+    ExpectSameViolations(dut.FindInvariantViolations(num_threads), violations);
+  }
+}
+
 GTEST_TEST(GeometryBaseRoadGeometryTest, AddingJunctions) {
   auto junction0 = std::make_unique<MockJunction>(api::JunctionId("j0"));
   MockJunction* raw_junction0 = junction0.get();
@@ -376,6 +542,66 @@ TEST_F(GeometryBaseRoadGeometryIndexingTest, Test) {
   }
 }
 
+// Dense indices follow the order in which elements are added, and round trip
+// with the ids.
+GTEST_TEST(GeometryBaseRoadGeometryTest, DenseIndices) {
+  constexpr int kNumSegments{3};
+  constexpr int kNumLanes{2};
+  const std::unique_ptr<RoadGeometry> road_geometry = MakeLanesGridRoadGeometry(kNumSegments, kNumLanes, 10., 4.);
+  api::BasicIdIndex walked_index;
+  walked_index.WalkAndAddAll(road_geometry.get());
+
+  const std::vector<const api::RoadGeometry::IdIndex*> duts{&road_geometry->ById(), &walked_index};
+  for (const api::RoadGeometry::IdIndex* dut : duts) {
+    ASSERT_EQ(dut->num_junction_indices(), static_cast<uint32_t>(kNumSegments));
+    ASSERT_EQ(dut->num_segment_indices(), static_cast<uint32_t>(kNumSegments));
+    ASSERT_EQ(dut->num_lane_indices(), static_cast<uint32_t>(kNumSegments * kNumLanes));
+    ASSERT_EQ(dut->num_branch_point_indices(), static_cast<uint32_t>(road_geometry->num_branch_points()));
+    for (uint32_t i = 0; i < dut->num_lane_indices(); ++i) {
+      const api::Lane* lane = dut->GetLaneByIndex(i);
+      ASSERT_NE(lane, nullptr);
+      EXPECT_EQ(lane, road_geometry->junction(i / kNumLanes)->segment(0)->lane(i % kNumLanes));
+      EXPECT_EQ(dut->GetLaneIndex(lane->id()), i);
+    }
+    for (uint32_t i = 0; i < dut->num_segment_indices(); ++i) {
+      EXPECT_EQ(dut->GetSegmentByIndex(i), road_geometry->junction(i)->segment(0));
+      EXPECT_EQ(dut->GetSegmentIndex(road_geometry->junction(i)->segment(0)->id()), i);
+      EXPECT_EQ(dut->GetJunctionByIndex(i), road_geometry->junction(i));
+      EXPECT_EQ(dut->GetJunctionIndex(road_geometry->junction(i)->id()), i);
+    }
+    for (uint32_t i = 0; i < dut->num_branch_point_indices(); ++i) {
+      EXPECT_EQ(dut->GetBranchPointByIndex(i), road_geometry->branch_point(i));
+      EXPECT_EQ(dut->GetBranchPointIndex(road_geometry->branch_point(i)->id()), i);
+    }
+
+    EXPECT_EQ(dut->GetLaneByIndex(dut->num_lane_indices()), nullptr);
+    EXPECT_EQ(dut->GetSegmentByIndex(dut->num_segment_indices()), nullptr);
+    EXPECT_EQ(dut->GetJunctionByIndex(dut->num_junction_indices()), nullptr);
+    EXPECT_EQ(dut->GetBranchPointByIndex(dut->num_branch_point_indices()), nullptr);
+    EXPECT_EQ(dut->GetLaneIndex(api::LaneId("unknown")), std::nullopt);
+    EXPECT_EQ(dut->GetSegmentIndex(api::SegmentId("unknown")), std::nullopt);
+    EXPECT_EQ(dut->GetJunctionIndex(api::JunctionId("unknown")), std::nullopt);
+    EXPECT_EQ(dut->GetBranchPointIndex(api::BranchPointId("unknown")), std::nullopt);
+  }
+}
+
+// GetLanes() holds the Lanes added both before and after it is first called.
+GTEST_TEST(GeometryBaseRoadGeometryTest, BasicIdIndexGetLanes) {
+  const std::unique_ptr<RoadGeometry> road_geometry = MakeLanesGridRoadGeometry(2, 2, 10., 4.);
+  api::BasicIdIndex dut;
+  EXPECT_TRUE(dut.GetLanes().empty());
+  const api::Segment* first = road_geometry->junction(0)->segment(0);
+  dut.AddLane(first->lane(0));
+  ASSERT_EQ(dut.GetLanes().size(), 1u);
+  EXPECT_EQ(dut.GetLanes().at(first->lane(0)->id()), first->lane(0));
+  dut.AddLane(first->lane(1));
+  dut.AddLane(road_geometry->junction(1)->segment(0)->lane(0));
+  ASSERT_EQ(dut.GetLanes().size(), 3u);
+  for (uint32_t i = 0; i < dut.num_lane_indices(); ++i) {
+    EXPECT_EQ(dut.GetLanes().at(dut.GetLaneByIndex(i)->id()), dut.GetLaneByIndex(i));
+  }
+}
+
 GTEST_TEST(GeometryBaseRoadGeometryTest, UnimplementedMethods) {
   const MockRoadGeometry dut(api::RoadGeometryId("dut"), 1., 1., 1., {0, 0, 0});
   // Ensure that the not-actually-implemented methods throw an exception.
@@ -0,0 +1,142 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2023, Woven by Toyota. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "maliput/geometry_base/road_position_tracker.h"
+
+#include <memory>
+#include <optional>
+
+#include <gtest/gtest.h>
+
+#include "maliput/api/lane.h"
+#include "maliput/common/assertion_error.h"
+#include "maliput/geometry_base/road_geometry.h"
+#include "straight_lanes_road_geometry.h"
+
+namespace maliput {
+namespace geometry_base {
+namespace test {
+namespace {
+
+class RoadPositionTrackerTest : public ::testing::Test {
+ protected:
+  static constexpr int kNumSegments{4};
+  static constexpr int kNumLanes{3};
+  static constexpr double kLength{20.};
+  static constexpr double kLaneWidth{4.};
+  static constexpr double kTolerance{1e-9};
+
+  void SetUp() override {
+    road_geometry_ = MakeLanesGridRoadGeometry(kNumSegments, kNumLanes, kLength, kLaneWidth);
+  }
+
+  // Asserts that @p dut and `road_geometry_->ToRoadPosition()` agree for @p inertial_position.
+  void ExpectMatchesRoadGeometry(const api::InertialPosition& inertial_position, RoadPositionTracker* dut) {
+    const api::RoadPositionResult expected = road_geometry_->ToRoadPosition(inertial_position);
+    const api::RoadPositionResult result = dut->Update(inertial_position);
+    EXPECT_EQ(expected.road_position.lane->id(), result.road_position.lane->id());
+    EXPECT_NEAR(expected.road_position.pos.s(), result.road_position.pos.s(), kTolerance);
+    EXPECT_NEAR(expected.road_position.pos.r(), result.road_position.pos.r(), kTolerance);
+    EXPECT_NEAR(expected.road_position.pos.h(), result.road_position.pos.h(), kTolerance);
+    EXPECT_NEAR(expected.distance, result.distance, kTolerance);
+    ASSERT_TRUE(dut->road_position().has_value());
+    EXPECT_EQ(result.road_position.lane, dut->road_position()->lane);
+  }
+
+  std::unique_ptr<RoadGeometry> road_geometry_;
+};
+
+TEST_F(RoadPositionTrackerTest, Throws) {
+  EXPECT_THROW(RoadPositionTracker(nullptr), common::assertion_error);
+  EXPECT_THROW(RoadPositionTracker(road_geometry_.get(), api::RoadPosition{}), common::assertion_error);
+}
+
+TEST_F(RoadPositionTrackerTest, FirstUpdateFallsBack) {
+  RoadPositionTracker dut(road_geometry_.get());
+  EXPECT_FALSE(dut.road_position().has_value());
+
+  ExpectMatchesRoadGeometry(api::InertialPosition(1., 0., 0.), &dut);
+  EXPECT_EQ(1u, dut.num_fallbacks());
+  EXPECT_EQ(0u, dut.num_local_hits());
+
+  dut.Reset();
+  EXPECT_FALSE(dut.road_position().has_value());
+  ExpectMatchesRoadGeometry(api::InertialPosition(2., 0., 0.), &dut);
+  EXPECT_EQ(2u, dut.num_fallbacks());
+}
+
+// Drives along the road changing lanes and crossing every BranchPoint; every
+// tick must be resolved by the neighbourhood of the previous one.
+TEST_F(RoadPositionTrackerTest, TracksContinuousMotion) {
+  const api::Lane* start_lane = road_geometry_->ById().GetLane(api::LaneId("l_0_0"));
+  ASSERT_NE(nullptr, start_lane);
+  RoadPositionTracker dut(road_geometry_.get(), api::RoadPosition(start_lane, api::LanePosition(0., 0., 0.)));
+
+  const double kStep{0.5};
+  const double kRoadLength{kNumSegments * kLength};
+  const double kLateralRange{(kNumLanes - 1) * kLaneWidth};
+  int num_updates{0};
+  for (double x = 0.25; x < kRoadLength; x += kStep) {
+    // Sweeps laterally back and forth across all the lanes, once per segment.
+    const double phase = 2. * (x / kLength - static_cast<int>(x / kLength));
+    const double y = kLateralRange * (phase < 1. ? phase : 2. - phase);
+    ExpectMatchesRoadGeometry(api::InertialPosition(x, y, 1.), &dut);
+    ++num_updates;
+  }
+  EXPECT_EQ(0u, dut.num_fallbacks());
+  EXPECT_EQ(static_cast<std::size_t>(num_updates), dut.num_local_hits());
+}
+
+TEST_F(RoadPositionTrackerTest, FallsBackOnTeleport) {
+  const api::Lane* start_lane = road_geometry_->ById().GetLane(api::LaneId("l_0_0"));
+  RoadPositionTracker dut(road_geometry_.get(), api::RoadPosition(start_lane, api::LanePosition(1., 0., 0.)));
+
+  ExpectMatchesRoadGeometry(api::InertialPosition(3. * kLength + 5., kLaneWidth, 0.), &dut);
+  EXPECT_EQ(1u, dut.num_fallbacks());
+  EXPECT_EQ(0u, dut.num_local_hits());
+  EXPECT_EQ(api::LaneId("l_3_1"), dut.road_position()->lane->id());
+
+  // The next tick is local again.
+  ExpectMatchesRoadGeometry(api::InertialPosition(3. * kLength + 6., kLaneWidth, 0.), &dut);
+  EXPECT_EQ(1u, dut.num_fallbacks());
+  EXPECT_EQ(1u, dut.num_local_hits());
+}
+
+TEST_F(RoadPositionTrackerTest, FallsBackOffRoad) {
+  const api::Lane* start_lane = road_geometry_->ById().GetLane(api::LaneId("l_0_0"));
+  RoadPositionTracker dut(road_geometry_.get(), api::RoadPosition(start_lane, api::LanePosition(1., 0., 0.)));
+
+  ExpectMatchesRoadGeometry(api::InertialPosition(1., -50., 0.), &dut);
+  EXPECT_EQ(1u, dut.num_fallbacks());
+  EXPECT_EQ(0u, dut.num_local_hits());
+}
+
+}  // namespace
+}  // namespace test
+}  // namespace geometry_base
+}  // namespace maliput
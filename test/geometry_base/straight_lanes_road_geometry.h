@@ -0,0 +1,281 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2023, Woven by Toyota. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <cmath>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "maliput/api/lane_data.h"
+#include "maliput/geometry_base/branch_point.h"
+#include "maliput/geometry_base/junction.h"
+#include "maliput/geometry_base/lane.h"
+#include "maliput/geometry_base/road_geometry.h"
+#include "maliput/geometry_base/segment.h"
+#include "maliput/math/saturate.h"
+#include "maliput/math/vector.h"
+
+namespace maliput {
+namespace geometry_base {
+namespace test {
+
+/// A concrete geometry_base::Lane whose reference line is a straight segment
+/// on a horizontal plane. Useful to exercise the lookup strategies with real
+/// geometric queries.
+class StraightLane final : public geometry_base::Lane {
+ public:
+  /// Constructs a StraightLane.
+  /// @param id The lane id.
+  /// @param origin Inertial Frame position of the `(s = 0, r = 0, h = 0)` point.
+  /// @param heading Yaw angle of the reference line, in radians.
+  /// @param length The lane length.
+  /// @param lane_bounds The lateral bounds of the lane.
+  /// @param segment_bounds The lateral bounds of the segment the lane belongs to.
+  StraightLane(const api::LaneId& id, const math::Vector3& origin, double heading, double length,
+               const api::RBounds& lane_bounds, const api::RBounds& segment_bounds)
+      : geometry_base::Lane(id),
+        origin_(origin),
+        heading_(heading),
+        length_(length),
+        lane_bounds_(lane_bounds),
+        segment_bounds_(segment_bounds),
+        s_hat_(std::cos(heading), std::sin(heading), 0.),
+        r_hat_(-std::sin(heading), std::cos(heading), 0.) {}
+
+ private:
+  double do_length() const override { return length_; }
+  api::RBounds do_lane_bounds(double) const override { return lane_bounds_; }
+  api::RBounds do_segment_bounds(double) const override { return segment_bounds_; }
+  api::HBounds do_elevation_bounds(double, double) const override { return {0., kMaxHeight}; }
+
+  api::InertialPosition DoToInertialPosition(const api::LanePosition& lane_pos) const override {
+    return api::InertialPosition::FromXyz(origin_ + lane_pos.s() * s_hat_ + lane_pos.r() * r_hat_ +
+                                          lane_pos.h() * math::Vector3::UnitZ());
+  }
+
+  api::Rotation DoGetOrientation(const api::LanePosition&) const override {
+    return api::Rotation::FromRpy(0., 0., heading_);
+  }
+
+  api::LanePosition DoEvalMotionDerivatives(const api::LanePosition&,
+                                            const api::IsoLaneVelocity& velocity) const override {
+    return {velocity.sigma_v, velocity.rho_v, velocity.eta_v};
+  }
+
+  api::LanePositionResult DoToLanePosition(const api::InertialPosition& inertial_pos) const override {
+    return Project(inertial_pos, lane_bounds_);
+  }
+
+  api::LanePositionResult DoToSegmentPosition(const api::InertialPosition& inertial_pos) const override {
+    return Project(inertial_pos, segment_bounds_);
+  }
+
+  // Projects @p inertial_pos onto the volume of the lane limited laterally by @p bounds.
+  api::LanePositionResult Project(const api::InertialPosition& inertial_pos, const api::RBounds& bounds) const {
+    const math::Vector3 delta = inertial_pos.xyz() - origin_;
+    const api::LanePosition lane_position{math::saturate(delta.dot(s_hat_), 0., length_),
+                                          math::saturate(delta.dot(r_hat_), bounds.min(), bounds.max()),
+                                          math::saturate(delta.z(), 0., kMaxHeight)};
+    const api::InertialPosition nearest_position = DoToInertialPosition(lane_position);
+    return {lane_position, nearest_position, (inertial_pos.xyz() - nearest_position.xyz()).norm()};
+  }
+
+  static constexpr double kMaxHeight{5.};
+
+  const math::Vector3 origin_;
+  const double heading_{};
+  const double length_{};
+  const api::RBounds lane_bounds_;
+  const api::RBounds segment_bounds_;
+  const math::Vector3 s_hat_;
+  const math::Vector3 r_hat_;
+};
+
+/// A concrete geometry_base::Lane whose reference line is a counter-clockwise arc on a horizontal plane, centered
+/// at the origin and starting on the positive x-axis. Useful to exercise the lookup strategies on curved lanes.
+class ArcLane final : public geometry_base::Lane {
+ public:
+  /// Constructs an ArcLane.
+  /// @param id The lane id.
+  /// @param radius Radius of the reference line. It must be greater than `lane_bounds.max()`.
+  /// @param length The lane length. It must be at most `2 * pi * radius`.
+  /// @param lane_bounds The lateral bounds of the lane, which are also the segment bounds.
+  ArcLane(const api::LaneId& id, double radius, double length, const api::RBounds& lane_bounds)
+      : geometry_base::Lane(id), radius_(radius), length_(length), lane_bounds_(lane_bounds) {}
+
+ private:
+  double do_length() const override { return length_; }
+  api::RBounds do_lane_bounds(double) const override { return lane_bounds_; }
+  api::RBounds do_segment_bounds(double) const override { return lane_bounds_; }
+  api::HBounds do_elevation_bounds(double, double) const override { return {0., kMaxHeight}; }
+
+  api::InertialPosition DoToInertialPosition(const api::LanePosition& lane_pos) const override {
+    const double theta = lane_pos.s() / radius_;
+    const double distance_to_center = radius_ - lane_pos.r();
+    return api::InertialPosition(distance_to_center * std::cos(theta), distance_to_center * std::sin(theta),
+                                 lane_pos.h());
+  }
+
+  api::Rotation DoGetOrientation(const api::LanePosition& lane_pos) const override {
+    return api::Rotation::FromRpy(0., 0., lane_pos.s() / radius_ + M_PI / 2.);
+  }
+
+  api::LanePosition DoEvalMotionDerivatives(const api::LanePosition& lane_pos,
+                                            const api::IsoLaneVelocity& velocity) const override {
+    return {velocity.sigma_v * radius_ / (radius_ - lane_pos.r()), velocity.rho_v, velocity.eta_v};
+  }
+
+  api::LanePositionResult DoToLanePosition(const api::InertialPosition& inertial_pos) const override {
+    const math::Vector3& xyz = inertial_pos.xyz();
+    // Angles beyond the arc are assigned to its closest end.
+    double theta = std::atan2(xyz.y(), xyz.x());
+    if (theta < 0.) {
+      theta += 2. * M_PI;
+    }
+    const double end_theta = length_ / radius_;
+    if (theta > end_theta) {
+      theta = theta - end_theta < 2. * M_PI - theta ? end_theta : 0.;
+    }
+    const double distance_to_center = std::sqrt(xyz.x() * xyz.x() + xyz.y() * xyz.y());
+    const api::LanePosition lane_position{
+        theta * radius_, math::saturate(radius_ - distance_to_center, lane_bounds_.min(), lane_bounds_.max()),
+        math::saturate(xyz.z(), 0., kMaxHeight)};
+    const api::InertialPosition nearest_position = DoToInertialPosition(lane_position);
+    return {lane_position, nearest_position, (xyz - nearest_position.xyz()).norm()};
+  }
+
+  api::LanePositionResult DoToSegmentPosition(const api::InertialPosition& inertial_pos) const override {
+    return DoToLanePosition(inertial_pos);
+  }
+
+  static constexpr double kMaxHeight{5.};
+
+  const double radius_{};
+  const double length_{};
+  const api::RBounds lane_bounds_;
+};
+
+/// Builds a geometry_base::RoadGeometry with a single Junction and Segment holding one ArcLane named `"l_0"`.
+/// @param radius Radius of the reference line of the lane.
+/// @param length Length of the lane.
+/// @param lane_bounds Lateral bounds of the lane.
+/// @returns The RoadGeometry. Its lookup strategy is left as the default one.
+inline std::unique_ptr<geometry_base::RoadGeometry> MakeArcLaneRoadGeometry(double radius, double length,
+                                                                            const api::RBounds& lane_bounds) {
+  const double kLinearTolerance{1e-3};
+  const double kAngularTolerance{1e-3};
+  const double kScaleLength{1.};
+  auto road_geometry =
+      std::make_unique<geometry_base::RoadGeometry>(api::RoadGeometryId("arc_lane"), kLinearTolerance,
+                                                    kAngularTolerance, kScaleLength, math::Vector3{0., 0., 0.});
+  auto segment = std::make_unique<geometry_base::Segment>(api::SegmentId("s_0"));
+  segment->AddLane(std::make_unique<ArcLane>(api::LaneId("l_0"), radius, length, lane_bounds));
+  auto junction = std::make_unique<geometry_base::Junction>(api::JunctionId("j_0"));
+  junction->AddSegment(std::move(segment));
+  road_geometry->AddJunction(std::move(junction));
+  return road_geometry;
+}
+
+/// Builds a geometry_base::RoadGeometry with a single Junction and Segment
+/// holding @p num_lanes parallel StraightLanes that run along the x-axis.
+/// Lane `i` is centered at `y = i * lane_width` and it is named `"l_<i>"`.
+/// @param num_lanes Number of lanes.
+/// @param length Length of the lanes.
+/// @param lane_width Width of the lanes.
+/// @returns The RoadGeometry. Its lookup strategy is left as the default one.
+inline std::unique_ptr<geometry_base::RoadGeometry> MakeParallelLanesRoadGeometry(int num_lanes, double length,
+                                                                                  double lane_width) {
+  const double kLinearTolerance{1e-3};
+  const double kAngularTolerance{1e-3};
+  const double kScaleLength{1.};
+  auto road_geometry =
+      std::make_unique<geometry_base::RoadGeometry>(api::RoadGeometryId("parallel_lanes"), kLinearTolerance,
+                                                    kAngularTolerance, kScaleLength, math::Vector3{0., 0., 0.});
+  auto segment = std::make_unique<geometry_base::Segment>(api::SegmentId("s_0"));
+  const double half_width = lane_width / 2.;
+  for (int i = 0; i < num_lanes; ++i) {
+    const api::RBounds segment_bounds{-half_width - i * lane_width, half_width + (num_lanes - 1 - i) * lane_width};
+    segment->AddLane(std::make_unique<StraightLane>(api::LaneId("l_" + std::to_string(i)),
+                                                    math::Vector3{0., i * lane_width, 0.}, 0. /* heading */, length,
+                                                    api::RBounds{-half_width, half_width}, segment_bounds));
+  }
+  auto junction = std::make_unique<geometry_base::Junction>(api::JunctionId("j_0"));
+  junction->AddSegment(std::move(segment));
+  road_geometry->AddJunction(std::move(junction));
+  return road_geometry;
+}
+
+/// Builds a geometry_base::RoadGeometry with @p num_segments consecutive segments along the x-axis, each in its own
+/// Junction, holding @p num_lanes parallel StraightLanes.
+/// Segment `k` starts at `x = k * length` and it is named `"s_<k>"`, its Junction is named `"j_<k>"`. Lane `i` of
+/// segment `k` is centered at `y = i * lane_width` and it is named `"l_<k>_<i>"`. Lane `i` of consecutive segments are
+/// connected through BranchPoint `"bp_<k>_<i>"`, located at `x = k * length`. Every lane end belongs to a BranchPoint.
+/// @param num_segments Number of segments.
+/// @param num_lanes Number of lanes per segment.
+/// @param length Length of the lanes.
+/// @param lane_width Width of the lanes.
+/// @returns The RoadGeometry. Its lookup strategy is left as the default one.
+inline std::unique_ptr<geometry_base::RoadGeometry> MakeLanesGridRoadGeometry(int num_segments, int num_lanes,
+                                                                              double length, double lane_width) {
+  const double kLinearTolerance{1e-3};
+  const double kAngularTolerance{1e-3};
+  const double kScaleLength{1.};
+  auto road_geometry =
+      std::make_unique<geometry_base::RoadGeometry>(api::RoadGeometryId("lanes_grid"), kLinearTolerance,
+                                                    kAngularTolerance, kScaleLength, math::Vector3{0., 0., 0.});
+  const double half_width = lane_width / 2.;
+  std::vector<std::vector<StraightLane*>> lanes(num_segments);
+  for (int k = 0; k < num_segments; ++k) {
+    auto segment = std::make_unique<geometry_base::Segment>(api::SegmentId("s_" + std::to_string(k)));
+    for (int i = 0; i < num_lanes; ++i) {
+      const api::RBounds segment_bounds{-half_width - i * lane_width, half_width + (num_lanes - 1 - i) * lane_width};
+      const api::LaneId lane_id("l_" + std::to_string(k) + "_" + std::to_string(i));
+      lanes[k].push_back(segment->AddLane(std::make_unique<StraightLane>(
+          lane_id, math::Vector3{k * length, i * lane_width, 0.}, 0. /* heading */, length,
+          api::RBounds{-half_width, half_width}, segment_bounds)));
+    }
+    auto junction = std::make_unique<geometry_base::Junction>(api::JunctionId("j_" + std::to_string(k)));
+    junction->AddSegment(std::move(segment));
+    road_geometry->AddJunction(std::move(junction));
+  }
+  for (int k = 0; k <= num_segments; ++k) {
+    for (int i = 0; i < num_lanes; ++i) {
+      auto branch_point = road_geometry->AddBranchPoint(std::make_unique<geometry_base::BranchPoint>(
+          api::BranchPointId("bp_" + std::to_string(k) + "_" + std::to_string(i))));
+      if (k > 0) branch_point->AddABranch(lanes[k - 1][i], api::LaneEnd::kFinish);
+      if (k < num_segments) branch_point->AddBBranch(lanes[k][i], api::LaneEnd::kStart);
+    }
+  }
+  return road_geometry;
+}
+
+}  // namespace test
+}  // namespace geometry_base
+}  // namespace maliput
@@ -0,0 +1,605 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2023, Woven by Toyota. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+extern "C" {
+#include <sys/stat.h>
+}
+
+#include <gtest/gtest.h>
+
+#include "assert_compare.h"
+#include "maliput/api/compare.h"
+#include "maliput/api/lane.h"
+#include "maliput/common/assertion_error.h"
+#include "maliput/common/filesystem.h"
+#include "maliput/geometry_base/brute_force_strategy.h"
+#include "maliput/geometry_base/bvh_strategy.h"
+#include "maliput/geometry_base/junction.h"
+#include "maliput/geometry_base/kd_tree_strategy.h"
+#include "maliput/geometry_base/lane.h"
+#include "maliput/geometry_base/road_geometry.h"
+#include "maliput/geometry_base/segment.h"
+#include "maliput/geometry_base/spatial_hash_strategy.h"
+#include "straight_lanes_road_geometry.h"
+
+namespace maliput {
+namespace geometry_base {
+namespace test {
+namespace {
+
+using maliput::test::AssertCompare;
+
+// Parameterizes the tests on the strategy being initialized in the RoadGeometry.
+enum class StrategyType { kBruteForce, kKDTree, kBVH, kSpatialHash };
+
+class StrategyTest : public ::testing::TestWithParam<StrategyType> {
+ protected:
+  void SetUp() override {
+    road_geometry_ = MakeParallelLanesRoadGeometry(kNumLanes, kLength, kLaneWidth);
+    switch (GetParam()) {
+      case StrategyType::kBruteForce:
+        road_geometry_->InitializeStrategy<BruteForceStrategy>();
+        break;
+      case StrategyType::kKDTree:
+        road_geometry_->InitializeStrategy<KDTreeStrategy>(kSamplingStep);
+        break;
+      case StrategyType::kBVH:
+        road_geometry_->InitializeStrategy<BVHStrategy>(kChunkLength);
+        break;
+      case StrategyType::kSpatialHash:
+        road_geometry_->InitializeStrategy<SpatialHashStrategy>(kCellSize);
+        break;
+    }
+    for (int i = 0; i < kNumQueries; ++i) {
+      // Spreads the queries across and slightly outside the road surface.
+      inertial_positions_.emplace_back(-5. + i * (kLength + 10.) / kNumQueries,
+                                       -kLaneWidth + (i % 13) * (kNumLanes + 1) * kLaneWidth / 13., (i % 3) * 0.5);
+    }
+  }
+
+  static constexpr int kNumLanes{4};
+  static constexpr int kNumQueries{97};
+  static constexpr double kLength{50.};
+  static constexpr double kLaneWidth{3.};
+  static constexpr double kSamplingStep{0.5};
+  static constexpr double kChunkLength{7.};
+  static constexpr double kCellSize{2.};
+  static constexpr double kTolerance{1e-12};
+  std::unique_ptr<RoadGeometry> road_geometry_;
+  std::vector<api::InertialPosition> inertial_positions_;
+};
+
+// BruteForceStrategy is used as the reference for the rest of the strategies.
+TEST_P(StrategyTest, ToRoadPositionMatchesBruteForce) {
+  const BruteForceStrategy brute_force(road_geometry_.get());
+  for (const api::InertialPosition& inertial_position : inertial_positions_) {
+    const api::RoadPositionResult expected = brute_force.ToRoadPosition(inertial_position, std::nullopt);
+    const api::RoadPositionResult dut = road_geometry_->ToRoadPosition(inertial_position);
+    EXPECT_EQ(dut.road_position.lane, expected.road_position.lane);
+    EXPECT_NEAR(dut.distance, expected.distance, kTolerance);
+  }
+}
+
+TEST_P(StrategyTest, FindRoadPositionsMatchesBruteForce) {
+  const BruteForceStrategy brute_force(road_geometry_.get());
+  for (const api::InertialPosition& inertial_position : inertial_positions_) {
+    for (const double radius : {0., 1., 4.5, 20.}) {
+      const std::vector<api::RoadPositionResult> expected_results =
+          brute_force.FindRoadPositions(inertial_position, radius);
+      const std::vector<api::RoadPositionResult> results = road_geometry_->FindRoadPositions(inertial_position, radius);
+      ASSERT_EQ(results.size(), expected_results.size());
+      for (const api::RoadPositionResult& expected_result : expected_results) {
+        const auto it = std::find_if(results.begin(), results.end(), [&expected_result](const auto& result) {
+          return result.road_position.lane == expected_result.road_position.lane;
+        });
+        ASSERT_NE(it, results.end());
+        EXPECT_NEAR(it->distance, expected_result.distance, kTolerance);
+      }
+    }
+  }
+}
+
+TEST_P(StrategyTest, ToRoadPositionsMatchesToRoadPosition) {
+  // The thread pool of the strategy is reused by the batches that don't need more threads.
+  for (const std::size_t num_threads : {1u, 2u, 4u, 2u, 200u, 3u}) {
+    const std::vector<api::RoadPositionResult> dut =
+        road_geometry_->ToRoadPositions(inertial_positions_, {}, num_threads);
+    ASSERT_EQ(dut.size(), inertial_positions_.size());
+    for (std::size_t i = 0; i < inertial_positions_.size(); ++i) {
+      const api::RoadPositionResult expected = road_geometry_->ToRoadPosition(inertial_positions_[i]);
+      EXPECT_EQ(dut[i].road_position.lane, expected.road_position.lane);
+      EXPECT_TRUE(AssertCompare(IsLanePositionClose(dut[i].road_position.pos, expected.road_position.pos, kTolerance)));
+      EXPECT_TRUE(
+          AssertCompare(IsInertialPositionClose(dut[i].nearest_position, expected.nearest_position, kTolerance)));
+      EXPECT_NEAR(dut[i].distance, expected.distance, kTolerance);
+    }
+  }
+}
+
+TEST_P(StrategyTest, ToRoadPositionsWithHints) {
+  const api::Lane* hint_lane = road_geometry_->ById().GetLane(api::LaneId("l_0"));
+  ASSERT_NE(hint_lane, nullptr);
+  const std::vector<std::optional<api::RoadPosition>> hints(inertial_positions_.size(),
+                                                            api::RoadPosition{hint_lane, api::LanePosition{}});
+  const std::vector<api::RoadPositionResult> dut = road_geometry_->ToRoadPositions(inertial_positions_, hints, 3);
+  ASSERT_EQ(dut.size(), inertial_positions_.size());
+  for (std::size_t i = 0; i < inertial_positions_.size(); ++i) {
+    EXPECT_EQ(dut[i].road_position.lane, hint_lane);
+    const api::LanePositionResult expected = hint_lane->ToLanePosition(inertial_positions_[i]);
+    EXPECT_TRUE(AssertCompare(IsLanePositionClose(dut[i].road_position.pos, expected.lane_position, kTolerance)));
+  }
+}
+
+TEST_P(StrategyTest, ToRoadPositionsEmptyBatch) {
+  EXPECT_TRUE(road_geometry_->ToRoadPositions({}, {}, 4).empty());
+}
+
+TEST_P(StrategyTest, ToRoadPositionsThrows) {
+  const std::vector<std::optional<api::RoadPosition>> kWrongSizeHints(inertial_positions_.size() - 1, std::nullopt);
+  EXPECT_THROW(road_geometry_->ToRoadPositions(inertial_positions_, kWrongSizeHints), common::assertion_error);
+  EXPECT_THROW(road_geometry_->ToRoadPositions(inertial_positions_, {}, 0), common::assertion_error);
+  // Exceptions raised while resolving a query are propagated to the caller.
+  const std::vector<std::optional<api::RoadPosition>> kNullLaneHints(inertial_positions_.size(), api::RoadPosition{});
+  EXPECT_THROW(road_geometry_->ToRoadPositions(inertial_positions_, kNullLaneHints, 2), common::assertion_error);
+}
+
+TEST_P(StrategyTest, StatisticsAreDisabledByDefault) {
+  for (const api::InertialPosition& inertial_position : inertial_positions_) {
+    road_geometry_->ToRoadPosition(inertial_position);
+  }
+  const StrategyBase& dut = road_geometry_->strategy();
+  EXPECT_FALSE(dut.statistics_enabled());
+  EXPECT_EQ(dut.GetStatistics().num_queries, 0);
+  EXPECT_EQ(dut.GetStatistics().num_to_lane_position_calls, 0);
+}
+
+TEST_P(StrategyTest, Statistics) {
+  const StrategyBase& dut = road_geometry_->strategy();
+  dut.EnableStatistics(true);
+  for (const api::InertialPosition& inertial_position : inertial_positions_) {
+    road_geometry_->ToRoadPosition(inertial_position);
+    road_geometry_->FindRoadPositions(inertial_position, 1.);
+  }
+  road_geometry_->ToRoadPositions(inertial_positions_, {}, 4);
+  const int64_t kNumQueries{3 * static_cast<int64_t>(inertial_positions_.size())};
+  StrategyStatistics statistics = dut.GetStatistics();
+  EXPECT_EQ(statistics.num_queries, kNumQueries);
+  EXPECT_EQ(statistics.num_hint_hits, 0);
+  EXPECT_EQ(statistics.num_hint_misses, 0);
+  switch (GetParam()) {
+    case StrategyType::kBruteForce:
+      EXPECT_EQ(statistics.num_candidate_lanes, kNumQueries * kNumLanes);
+      EXPECT_EQ(statistics.num_to_lane_position_calls, kNumQueries * kNumLanes);
+      EXPECT_EQ(statistics.max_candidate_lanes, kNumLanes);
+      EXPECT_EQ(statistics.num_visited_nodes, 0);
+      break;
+    case StrategyType::kKDTree:
+      EXPECT_GT(statistics.num_candidate_lanes, 0);
+      EXPECT_GE(statistics.num_to_lane_position_calls, statistics.num_candidate_lanes);
+      EXPECT_GT(statistics.max_candidate_lanes, 0);
+      EXPECT_LE(statistics.max_candidate_lanes, kNumLanes);
+      EXPECT_GE(statistics.num_visited_nodes, statistics.num_returned_points);
+      EXPECT_GT(statistics.num_returned_points, 0);
+      EXPECT_GT(statistics.max_visited_nodes, 0);
+      EXPECT_LE(statistics.max_visited_nodes, statistics.num_visited_nodes);
+      break;
+    default:
+      // Other strategies only count the queries.
+      break;
+  }
+
+  // Hinted queries on the right lane are hits, the rest are misses.
+  dut.ResetStatistics();
+  const api::Lane* lane = road_geometry_->ById().GetLane(api::LaneId("l_0"));
+  const api::InertialPosition on_lane = lane->ToInertialPosition({kLength / 2., 0., 0.});
+  // Beyond the segment bounds, so it is off the lane.
+  const api::InertialPosition off_lane =
+      api::InertialPosition::FromXyz(on_lane.xyz() + math::Vector3{0., -2. * kLaneWidth, 0.});
+  road_geometry_->ToRoadPosition(on_lane, api::RoadPosition{lane, api::LanePosition{}});
+  road_geometry_->ToRoadPosition(off_lane, api::RoadPosition{lane, api::LanePosition{}});
+  statistics = dut.GetStatistics();
+  EXPECT_EQ(statistics.num_queries, 2);
+  if (GetParam() == StrategyType::kBruteForce || GetParam() == StrategyType::kKDTree) {
+    EXPECT_EQ(statistics.num_hint_hits, 1);
+    EXPECT_EQ(statistics.num_hint_misses, 1);
+    EXPECT_EQ(statistics.num_to_lane_position_calls, 2);
+  }
+
+  // Disabling keeps the collected statistics.
+  dut.EnableStatistics(false);
+  road_geometry_->ToRoadPosition(on_lane);
+  EXPECT_EQ(dut.GetStatistics().num_queries, 2);
+  dut.ResetStatistics();
+  EXPECT_EQ(dut.GetStatistics().num_queries, 0);
+  EXPECT_EQ(dut.GetStatistics().max_candidate_lanes, 0);
+}
+
+INSTANTIATE_TEST_CASE_P(StrategyTestGroup, StrategyTest,
+                        ::testing::Values(StrategyType::kBruteForce, StrategyType::kKDTree, StrategyType::kBVH,
+                                          StrategyType::kSpatialHash));
+
+// The index built with several threads must be identical to the one built serially, so must be the query results.
+GTEST_TEST(KDTreeStrategyTest, ParallelConstructionMatchesSerial) {
+  constexpr int kNumLanes{7};
+  constexpr double kLength{30.};
+  constexpr double kLaneWidth{3.5};
+  constexpr double kSamplingStep{0.25};
+  const std::unique_ptr<RoadGeometry> road_geometry = MakeParallelLanesRoadGeometry(kNumLanes, kLength, kLaneWidth);
+  const KDTreeStrategy serial(road_geometry.get(), kSamplingStep);
+  EXPECT_THROW(KDTreeStrategy(road_geometry.get(), kSamplingStep, 0), common::assertion_error);
+  for (const std::size_t num_threads : {2u, 3u, 16u}) {
+    const KDTreeStrategy dut(road_geometry.get(), kSamplingStep, num_threads);
+    for (double x = -2.; x <= kLength + 2.; x += 1.3) {
+      for (double y = -kLaneWidth; y <= (kNumLanes + 1) * kLaneWidth; y += 0.7) {
+        const api::InertialPosition inertial_position{x, y, 0.3};
+        const api::RoadPositionResult expected = serial.ToRoadPosition(inertial_position, std::nullopt);
+        const api::RoadPositionResult result = dut.ToRoadPosition(inertial_position, std::nullopt);
+        EXPECT_EQ(result.road_position.lane, expected.road_position.lane);
+        EXPECT_EQ(result.road_position.pos.srh(), expected.road_position.pos.srh());
+        EXPECT_EQ(result.distance, expected.distance);
+        EXPECT_EQ(dut.FindRoadPositions(inertial_position, 2.).size(),
+                  serial.FindRoadPositions(inertial_position, 2.).size());
+      }
+    }
+  }
+}
+
+// A lane that delegates to another one and queries the road geometry of the latter from ToLanePosition(), as lanes
+// built on top of other road geometries may do.
+class NestedQueryLane final : public geometry_base::Lane {
+ public:
+  NestedQueryLane(const api::LaneId& id, const api::Lane* lane, const api::RoadGeometry* road_geometry)
+      : geometry_base::Lane(id), lane_(lane), road_geometry_(road_geometry) {}
+
+ private:
+  double do_length() const override { return lane_->length(); }
+  api::RBounds do_lane_bounds(double s) const override { return lane_->lane_bounds(s); }
+  api::RBounds do_segment_bounds(double s) const override { return lane_->segment_bounds(s); }
+  api::HBounds do_elevation_bounds(double s, double r) const override { return lane_->elevation_bounds(s, r); }
+  api::InertialPosition DoToInertialPosition(const api::LanePosition& lane_pos) const override {
+    return lane_->ToInertialPosition(lane_pos);
+  }
+  api::Rotation DoGetOrientation(const api::LanePosition& lane_pos) const override {
+    return lane_->GetOrientation(lane_pos);
+  }
+  api::LanePosition DoEvalMotionDerivatives(const api::LanePosition& lane_pos,
+                                            const api::IsoLaneVelocity& velocity) const override {
+    return lane_->EvalMotionDerivatives(lane_pos, velocity);
+  }
+  api::LanePositionResult DoToLanePosition(const api::InertialPosition& inertial_pos) const override {
+    road_geometry_->ToRoadPosition(inertial_pos);
+    road_geometry_->FindRoadPositions(inertial_pos, 2.);
+    return lane_->ToLanePosition(inertial_pos);
+  }
+  api::LanePositionResult DoToSegmentPosition(const api::InertialPosition& inertial_pos) const override {
+    return lane_->ToSegmentPosition(inertial_pos);
+  }
+
+  const api::Lane* lane_{};
+  const api::RoadGeometry* road_geometry_{};
+};
+
+// Queries issued from the lanes while a query is in progress don't interfere with it.
+GTEST_TEST(KDTreeStrategyTest, NestedQueries) {
+  constexpr int kNumLanes{4};
+  constexpr double kLength{30.};
+  constexpr double kLaneWidth{3.};
+  constexpr double kSamplingStep{0.5};
+  const std::unique_ptr<RoadGeometry> inner_road_geometry =
+      MakeParallelLanesRoadGeometry(kNumLanes, kLength, kLaneWidth);
+  inner_road_geometry->InitializeStrategy<KDTreeStrategy>(kSamplingStep);
+  auto road_geometry = std::make_unique<RoadGeometry>(
+      api::RoadGeometryId("nested"), inner_road_geometry->linear_tolerance(), inner_road_geometry->angular_tolerance(),
+      inner_road_geometry->scale_length(), math::Vector3{0., 0., 0.});
+  auto segment = std::make_unique<Segment>(api::SegmentId("s_0"));
+  for (int i = 0; i < kNumLanes; ++i) {
+    segment->AddLane(std::make_unique<NestedQueryLane>(api::LaneId("nested_" + std::to_string(i)),
+                                                       inner_road_geometry->junction(0)->segment(0)->lane(i),
+                                                       inner_road_geometry.get()));
+  }
+  auto junction = std::make_unique<Junction>(api::JunctionId("j_0"));
+  junction->AddSegment(std::move(segment));
+  road_geometry->AddJunction(std::move(junction));
+  const BruteForceStrategy expected(road_geometry.get());
+  const KDTreeStrategy dut(road_geometry.get(), kSamplingStep);
+  for (double x = -2.; x <= kLength + 2.; x += 1.3) {
+    for (double y = -kLaneWidth; y <= (kNumLanes + 1) * kLaneWidth; y += 0.7) {
+      const api::InertialPosition inertial_position{x, y, 0.3};
+      const api::RoadPositionResult expected_result = expected.ToRoadPosition(inertial_position, std::nullopt);
+      const api::RoadPositionResult result = dut.ToRoadPosition(inertial_position, std::nullopt);
+      EXPECT_EQ(result.road_position.lane, expected_result.road_position.lane);
+      EXPECT_EQ(result.distance, expected_result.distance);
+      EXPECT_EQ(dut.FindRoadPositions(inertial_position, 2.).size(),
+                expected.FindRoadPositions(inertial_position, 2.).size());
+    }
+  }
+}
+
+// A lane that delegates to another one, except that it is narrower around `narrow_s`.
+class NarrowedLane final : public geometry_base::Lane {
+ public:
+  NarrowedLane(const api::LaneId& id, const api::Lane* lane, double narrow_s)
+      : geometry_base::Lane(id), lane_(lane), narrow_s_(narrow_s) {}
+
+ private:
+  double do_length() const override { return lane_->length(); }
+  api::RBounds do_lane_bounds(double s) const override {
+    const api::RBounds lane_bounds = lane_->lane_bounds(s);
+    return std::abs(s - narrow_s_) < 0.1 ? api::RBounds{lane_bounds.min() / 2., lane_bounds.max() / 2.} : lane_bounds;
+  }
+  api::RBounds do_segment_bounds(double s) const override { return lane_->segment_bounds(s); }
+  api::HBounds do_elevation_bounds(double s, double r) const override { return lane_->elevation_bounds(s, r); }
+  api::InertialPosition DoToInertialPosition(const api::LanePosition& lane_pos) const override {
+    return lane_->ToInertialPosition(lane_pos);
+  }
+  api::Rotation DoGetOrientation(const api::LanePosition& lane_pos) const override {
+    return lane_->GetOrientation(lane_pos);
+  }
+  api::LanePosition DoEvalMotionDerivatives(const api::LanePosition& lane_pos,
+                                            const api::IsoLaneVelocity& velocity) const override {
+    return lane_->EvalMotionDerivatives(lane_pos, velocity);
+  }
+  api::LanePositionResult DoToLanePosition(const api::InertialPosition& inertial_pos) const override {
+    return lane_->ToLanePosition(inertial_pos);
+  }
+  api::LanePositionResult DoToSegmentPosition(const api::InertialPosition& inertial_pos) const override {
+    return lane_->ToSegmentPosition(inertial_pos);
+  }
+
+  const api::Lane* lane_{};
+  const double narrow_s_{};
+};
+
+class KDTreeStrategyCacheTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    directory_.set_as_temp();
+    directory_.append("KDTreeStrategyCacheTest");
+    ASSERT_TRUE(common::Filesystem::create_directory(directory_));
+    cache_path_ = directory_.get_path() + "/index.bin";
+    road_geometry_ = MakeParallelLanesRoadGeometry(kNumLanes, kLength, kLaneWidth);
+  }
+
+  void TearDown() override {
+    common::Filesystem::remove_file(common::Path(cache_path_));
+    ASSERT_TRUE(common::Filesystem::remove_directory(directory_));
+  }
+
+  // @returns The inode of the cache file. It changes every time the cache is written, as it is replaced.
+  ino_t CacheInode() const {
+    struct stat file_stat {};
+    EXPECT_EQ(0, ::stat(cache_path_.c_str(), &file_stat));
+    return file_stat.st_ino;
+  }
+
+  // Expects @p dut to resolve queries as @p expected does.
+  void ExpectSameResults(const KDTreeStrategy& expected, const KDTreeStrategy& dut) const {
+    for (double x = -2.; x <= kLength + 2.; x += 3.1) {
+      for (double y = -kLaneWidth; y <= (kNumLanes + 1) * kLaneWidth; y += 1.3) {
+        const api::InertialPosition inertial_position{x, y, 0.2};
+        const api::RoadPositionResult expected_result = expected.ToRoadPosition(inertial_position, std::nullopt);
+        const api::RoadPositionResult result = dut.ToRoadPosition(inertial_position, std::nullopt);
+        EXPECT_EQ(result.road_position.lane, expected_result.road_position.lane);
+        EXPECT_EQ(result.road_position.pos.srh(), expected_result.road_position.pos.srh());
+        EXPECT_EQ(result.distance, expected_result.distance);
+      }
+    }
+  }
+
+  static constexpr int kNumLanes{3};
+  static constexpr double kLength{20.};
+  static constexpr double kLaneWidth{3.};
+  static constexpr double kSamplingStep{0.5};
+  common::Path directory_;
+  std::string cache_path_;
+  std::unique_ptr<RoadGeometry> road_geometry_;
+};
+
+TEST_F(KDTreeStrategyCacheTest, BuildsSavesAndLoads) {
+  const KDTreeStrategy expected(road_geometry_.get(), kSamplingStep);
+  // There is no cache yet, so the index is built and saved.
+  const KDTreeStrategy built(road_geometry_.get(), kSamplingStep, 2, cache_path_);
+  ASSERT_TRUE(common::Path(cache_path_).is_file());
+  const ino_t inode = CacheInode();
+  ExpectSameResults(expected, built);
+  // The cache matches, so it is loaded and left untouched.
+  const KDTreeStrategy loaded(road_geometry_.get(), kSamplingStep, 1, cache_path_);
+  EXPECT_EQ(inode, CacheInode());
+  ExpectSameResults(expected, loaded);
+}
+
+TEST_F(KDTreeStrategyCacheTest, RebuildsOnMismatch) {
+  KDTreeStrategy(road_geometry_.get(), kSamplingStep).SaveIndex(cache_path_);
+  ino_t inode = CacheInode();
+
+  // Different sampling step.
+  const KDTreeStrategy other_step(road_geometry_.get(), 2. * kSamplingStep, 1, cache_path_);
+  EXPECT_NE(inode, CacheInode());
+  ExpectSameResults(KDTreeStrategy(road_geometry_.get(), 2. * kSamplingStep), other_step);
+  inode = CacheInode();
+
+  // Different road geometry content.
+  const std::unique_ptr<RoadGeometry> longer_road_geometry =
+      MakeParallelLanesRoadGeometry(kNumLanes, 2. * kLength, kLaneWidth);
+  const KDTreeStrategy other_content(longer_road_geometry.get(), 2. * kSamplingStep, 1, cache_path_);
+  EXPECT_NE(inode, CacheInode());
+
+  // Same ids and lengths, but the first lane is narrower at a sampled station away from its ends and its middle.
+  KDTreeStrategy(road_geometry_.get(), kSamplingStep).SaveIndex(cache_path_);
+  inode = CacheInode();
+  auto narrowed_road_geometry =
+      std::make_unique<RoadGeometry>(road_geometry_->id(), road_geometry_->linear_tolerance(),
+                                     road_geometry_->angular_tolerance(), road_geometry_->scale_length(),
+                                     math::Vector3{0., 0., 0.});
+  auto segment = std::make_unique<Segment>(api::SegmentId("s_0"));
+  for (int i = 0; i < kNumLanes; ++i) {
+    const api::Lane* lane = road_geometry_->junction(0)->segment(0)->lane(i);
+    segment->AddLane(std::make_unique<NarrowedLane>(lane->id(), lane, i == 0 ? kLength / 4. : -1.));
+  }
+  auto junction = std::make_unique<Junction>(api::JunctionId("j_0"));
+  junction->AddSegment(std::move(segment));
+  narrowed_road_geometry->AddJunction(std::move(junction));
+  const KDTreeStrategy narrowed(narrowed_road_geometry.get(), kSamplingStep, 1, cache_path_);
+  EXPECT_NE(inode, CacheInode());
+
+  // Corrupted file.
+  { std::ofstream(cache_path_, std::ios::binary | std::ios::trunc) << "not a cache"; }
+  const KDTreeStrategy corrupted(road_geometry_.get(), kSamplingStep, 1, cache_path_);
+  ExpectSameResults(KDTreeStrategy(road_geometry_.get(), kSamplingStep), corrupted);
+  inode = CacheInode();
+  const KDTreeStrategy loaded(road_geometry_.get(), kSamplingStep, 1, cache_path_);
+  EXPECT_EQ(inode, CacheInode());
+}
+
+TEST_F(KDTreeStrategyCacheTest, RebuildsOnOverflowingHeader) {
+  KDTreeStrategy(road_geometry_.get(), kSamplingStep).SaveIndex(cache_path_);
+  // The number of points is the last field of the 72 bytes header. Adding 2^62 to it leaves the size computed from
+  // the header unchanged modulo 2^64.
+  constexpr std::streamoff kNumPointsOffset{64};
+  std::uint64_t num_points{};
+  {
+    std::fstream file(cache_path_, std::ios::binary | std::ios::in | std::ios::out);
+    file.seekg(kNumPointsOffset);
+    file.read(reinterpret_cast<char*>(&num_points), sizeof(num_points));
+    num_points += std::uint64_t{1} << 62;
+    file.seekp(kNumPointsOffset);
+    file.write(reinterpret_cast<const char*>(&num_points), sizeof(num_points));
+    ASSERT_TRUE(file.good());
+  }
+  const ino_t inode = CacheInode();
+  std::unique_ptr<KDTreeStrategy> dut;
+  ASSERT_NO_THROW(dut = std::make_unique<KDTreeStrategy>(road_geometry_.get(), kSamplingStep, 1, cache_path_));
+  EXPECT_NE(inode, CacheInode());
+  ExpectSameResults(KDTreeStrategy(road_geometry_.get(), kSamplingStep), *dut);
+}
+
+TEST_F(KDTreeStrategyCacheTest, Throws) {
+  const KDTreeStrategy dut(road_geometry_.get(), kSamplingStep);
+  EXPECT_THROW(dut.SaveIndex(directory_.get_path() + "/non_existent_directory/index.bin"), common::assertion_error);
+  EXPECT_THROW(KDTreeStrategy(road_geometry_.get(), kSamplingStep, 0, cache_path_), common::assertion_error);
+  // A cache that can't be written is not an error.
+  EXPECT_NO_THROW(
+      KDTreeStrategy(road_geometry_.get(), kSamplingStep, 1, directory_.get_path() + "/non_existent_directory/index"));
+}
+
+// The outer edge of a tight arc bulges out of the chords between the samples well beyond the sampling step.
+GTEST_TEST(BVHStrategyTest, CoversTightArcLanes) {
+  const double kRadius{0.5};
+  const api::RBounds kLaneBounds{-6., 0.25};
+  const double kChunkLength{2.};
+  const double kRadiusTolerance{1e-2};
+  auto road_geometry = MakeArcLaneRoadGeometry(kRadius, 1.5 * M_PI * kRadius, kLaneBounds);
+  road_geometry->InitializeStrategy<BVHStrategy>(kChunkLength);
+  const api::Lane* lane = road_geometry->junction(0)->segment(0)->lane(0);
+  for (double s = 0.; s <= lane->length(); s += 0.01) {
+    for (const double r : {kLaneBounds.min(), kLaneBounds.max()}) {
+      const api::InertialPosition inertial_position = lane->ToInertialPosition({s, r, 0.});
+      const std::vector<api::RoadPositionResult> results =
+          road_geometry->FindRoadPositions(inertial_position, kRadiusTolerance);
+      ASSERT_EQ(1u, results.size()) << "s: " << s << ", r: " << r;
+      EXPECT_EQ(lane, results.front().road_position.lane);
+    }
+  }
+}
+
+// Exercises the queries far from the grid, where most rings are empty, and over multi segment roads.
+GTEST_TEST(SpatialHashStrategyTest, MatchesBruteForce) {
+  constexpr int kNumSegments{3};
+  constexpr int kNumLanes{4};
+  constexpr double kLength{25.};
+  constexpr double kLaneWidth{3.5};
+  constexpr double kCellSize{3.};
+  constexpr double kTolerance{1e-12};
+  const std::unique_ptr<RoadGeometry> road_geometry =
+      MakeLanesGridRoadGeometry(kNumSegments, kNumLanes, kLength, kLaneWidth);
+  EXPECT_THROW(SpatialHashStrategy(nullptr, kCellSize), common::assertion_error);
+  EXPECT_THROW(SpatialHashStrategy(road_geometry.get(), 0.), common::assertion_error);
+
+  const SpatialHashStrategy dut(road_geometry.get(), kCellSize);
+  EXPECT_GT(dut.num_cells(), 0u);
+  EXPECT_GE(dut.num_entries(), dut.num_cells());
+  const BruteForceStrategy brute_force(road_geometry.get());
+  for (const api::InertialPosition& inertial_position :
+       {api::InertialPosition{1., 1., 0.}, api::InertialPosition{kLength + 0.3, 0.4 * kLaneWidth, 2.},
+        api::InertialPosition{-300., 40., 0.}, api::InertialPosition{1000., -1000., 100.},
+        api::InertialPosition{2. * kLength + 3., -20., -10.}}) {
+    const api::RoadPositionResult expected = brute_force.ToRoadPosition(inertial_position, std::nullopt);
+    const api::RoadPositionResult result = dut.ToRoadPosition(inertial_position, std::nullopt);
+    EXPECT_EQ(result.road_position.lane, expected.road_position.lane);
+    EXPECT_NEAR(result.distance, expected.distance, kTolerance);
+    for (const double radius : {0.5, 10., 2000.}) {
+      EXPECT_EQ(dut.FindRoadPositions(inertial_position, radius).size(),
+                brute_force.FindRoadPositions(inertial_position, radius).size());
+    }
+  }
+}
+
+// Cells whose grid indices differ by 2^32 are told apart.
+GTEST_TEST(SpatialHashStrategyTest, DistantCells) {
+  constexpr double kCellSize{1.};
+  constexpr double kLength{10.};
+  constexpr double kOffset{4294967296. * kCellSize};
+  const api::RBounds kLaneBounds{-1., 1.};
+  const auto make_road_geometry = [&](const std::vector<double>& offsets) {
+    auto road_geometry = std::make_unique<RoadGeometry>(api::RoadGeometryId("distant_lanes"), 1e-3, 1e-3, 1.,
+                                                        math::Vector3{0., 0., 0.});
+    auto segment = std::make_unique<Segment>(api::SegmentId("s_0"));
+    for (std::size_t i = 0; i < offsets.size(); ++i) {
+      segment->AddLane(std::make_unique<StraightLane>(api::LaneId("l_" + std::to_string(i)),
+                                                      math::Vector3{offsets[i], 0., 0.}, 0. /* heading */, kLength,
+                                                      kLaneBounds, kLaneBounds));
+    }
+    auto junction = std::make_unique<Junction>(api::JunctionId("j_0"));
+    junction->AddSegment(std::move(segment));
+    road_geometry->AddJunction(std::move(junction));
+    return road_geometry;
+  };
+  const std::unique_ptr<RoadGeometry> single_lane = make_road_geometry({0.});
+  const std::unique_ptr<RoadGeometry> distant_lanes = make_road_geometry({0., kOffset});
+  const SpatialHashStrategy single_lane_dut(single_lane.get(), kCellSize);
+  const SpatialHashStrategy dut(distant_lanes.get(), kCellSize);
+  EXPECT_EQ(2 * single_lane_dut.num_cells(), dut.num_cells());
+  EXPECT_EQ(2 * single_lane_dut.num_entries(), dut.num_entries());
+  const std::vector<api::RoadPositionResult> results = dut.FindRoadPositions(api::InertialPosition{1., 0., 0.}, 1.);
+  ASSERT_EQ(1u, results.size());
+  EXPECT_EQ(api::LaneId("l_0"), results.front().road_position.lane->id());
+}
+
+}  // namespace
+}  // namespace test
+}  // namespace geometry_base
+}  // namespace maliput
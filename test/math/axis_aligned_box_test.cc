@@ -281,6 +281,35 @@ TEST_P(AxisAlignedBoxTest, GetIntersection) {
   }
 }
 
+TEST(AxisAlignedBox, GetUnion) {
+  const AxisAlignedBox dut{{-1., -1., -1.} /* min_corner */, {1., 1., 1.} /* max_corner */, kTolerance};
+  // Disjointed box.
+  AxisAlignedBox union_box = dut.GetUnion(AxisAlignedBox{{2., 3., 4.}, {5., 6., 7.}});
+  EXPECT_EQ(Vector3(-1., -1., -1.), union_box.min_corner());
+  EXPECT_EQ(Vector3(5., 6., 7.), union_box.max_corner());
+  // Contained box.
+  union_box = dut.GetUnion(AxisAlignedBox{{-0.5, -0.5, -0.5}, {0.5, 0.5, 0.5}});
+  EXPECT_EQ(dut.min_corner(), union_box.min_corner());
+  EXPECT_EQ(dut.max_corner(), union_box.max_corner());
+  // Intersected box.
+  union_box = dut.GetUnion(AxisAlignedBox{{0., -2., 0.}, {3., 0., 0.5}});
+  EXPECT_EQ(Vector3(-1., -2., -1.), union_box.min_corner());
+  EXPECT_EQ(Vector3(3., 1., 1.), union_box.max_corner());
+}
+
+TEST(AxisAlignedBox, Distance) {
+  const AxisAlignedBox dut{{-1., -2., -3.} /* min_corner */, {1., 2., 3.} /* max_corner */, kTolerance};
+  // Contained positions.
+  EXPECT_DOUBLE_EQ(0., dut.Distance({0., 0., 0.}));
+  EXPECT_DOUBLE_EQ(0., dut.Distance({1., 2., 3.}));
+  // Off on a single coordinate.
+  EXPECT_DOUBLE_EQ(2., dut.Distance({3., 0., 0.}));
+  EXPECT_DOUBLE_EQ(3., dut.Distance({0., -5., 0.}));
+  EXPECT_DOUBLE_EQ(4., dut.Distance({0., 0., 7.}));
+  // Off on every coordinate.
+  EXPECT_DOUBLE_EQ(std::sqrt(1. + 4. + 9.), dut.Distance({2., -4., 6.}));
+}
+
 INSTANTIATE_TEST_CASE_P(AxisAlignedBoxTestGroup, AxisAlignedBoxTest, ::testing::ValuesIn(GetTestParameters()));
 
 class AxisAlignedBoxOverlappingTest : public ::testing::Test {
@@ -28,7 +28,11 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "maliput/math/kd_tree.h"
 
+#include <algorithm>
+#include <array>
 #include <random>
+#include <utility>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -310,6 +314,121 @@ TEST_F(KDTreeTest, RangeSearchReturnsAllPointsWithEnclosingRegion) {
   }
 }
 
+// Tests ImplicitKDTree3D class.
+class ImplicitKDTreeTest : public KDTreeTest {
+ public:
+  // Verifies that [begin, end) of @p tree_points describes a kd-tree whose root splits along @p index.
+  static void ExpectImplicitKdTree(std::size_t begin, std::size_t end, std::size_t index,
+                                   const std::vector<Vector3>& tree_points) {
+    if (end <= begin + 1) return;
+    const std::size_t node_index = begin + (end - begin) / 2;
+    for (std::size_t i = begin; i < node_index; ++i) {
+      EXPECT_LE(tree_points[i][index], tree_points[node_index][index]);
+    }
+    for (std::size_t i = node_index + 1; i < end; ++i) {
+      EXPECT_GE(tree_points[i][index], tree_points[node_index][index]);
+    }
+    ExpectImplicitKdTree(begin, node_index, (index + 1) % 3, tree_points);
+    ExpectImplicitKdTree(node_index + 1, end, (index + 1) % 3, tree_points);
+  }
+
+  ImplicitKDTree3D<Vector3> implicit_dut{points.begin(), points.end()};
+};
+
+TEST_F(ImplicitKDTreeTest, MakeImplicitKdTree) {
+  std::vector<Vector3> tree_points{points};
+  details::MakeImplicitKdTree<3>(0, tree_points.size(), 0, tree_points);
+  ASSERT_EQ(points.size(), tree_points.size());
+  ExpectImplicitKdTree(0, tree_points.size(), 0, tree_points);
+}
+
+TEST_F(ImplicitKDTreeTest, Constructor) {
+  const std::vector<Vector3> empty_points{};
+  ASSERT_THROW((ImplicitKDTree<Vector3, 3>(empty_points.begin(), empty_points.end())),
+               maliput::common::assertion_error);
+  ASSERT_THROW((ImplicitKDTree<Vector3, 3>(empty_points)), maliput::common::assertion_error);
+  ASSERT_NO_THROW((ImplicitKDTree<Vector3, 3>((std::deque<Vector3>{{3, 6, 2}}))));
+  EXPECT_EQ(points.size(), implicit_dut.size());
+}
+
+// Restores a tree from its laid out points, both copying their coordinates and reading them from external arrays.
+TEST_F(ImplicitKDTreeTest, LaidOutConstructors) {
+  const std::vector<Vector3>& laid_out_points = implicit_dut.points();
+  std::array<std::vector<double>, 3> coordinates;
+  for (std::size_t i = 0; i < 3; ++i) {
+    for (const Vector3& point : laid_out_points) {
+      coordinates[i].push_back(point[i]);
+    }
+  }
+  const ImplicitKDTree3D<Vector3> copying_dut(std::vector<Vector3>{laid_out_points},
+                                              ImplicitKDTree3D<Vector3>::LaidOut{});
+  const ImplicitKDTree3D<Vector3> viewing_dut(std::vector<Vector3>{laid_out_points},
+                                              {coordinates[0].data(), coordinates[1].data(), coordinates[2].data()},
+                                              ImplicitKDTree3D<Vector3>::LaidOut{});
+  EXPECT_EQ(laid_out_points, copying_dut.points());
+  EXPECT_EQ(laid_out_points, viewing_dut.points());
+  const AxisAlignedBox region{{1., 1., 1.}, {7., 5., 4.}};
+  EXPECT_EQ(implicit_dut.RangeSearch(region).size(), viewing_dut.RangeSearch(region).size());
+  for (const auto& p : points) {
+    EXPECT_EQ(p, copying_dut.nearest_point(p));
+    EXPECT_EQ(p, viewing_dut.nearest_point(p));
+  }
+  EXPECT_THROW(ImplicitKDTree3D<Vector3>(std::vector<Vector3>{laid_out_points}, {nullptr, nullptr, nullptr},
+                                         ImplicitKDTree3D<Vector3>::LaidOut{}),
+               maliput::common::assertion_error);
+}
+
+TEST_F(ImplicitKDTreeTest, NNSearch) {
+  const double kTolerance{1e-12};
+  const Vector3 point{3., 3., 3.};
+  const Vector3 expected_point{2., 1., 4.};
+  EXPECT_EQ(expected_point, implicit_dut.nearest_point(point));
+  EXPECT_EQ(expected_point, implicit_dut.nearest_point(point, kTolerance));
+  EXPECT_THROW(implicit_dut.nearest_point(point, -kTolerance), maliput::common::assertion_error);
+  // Every point of the tree is its own nearest point.
+  for (const auto& p : points) {
+    EXPECT_EQ(p, implicit_dut.nearest_point(p));
+  }
+}
+
+TEST_F(ImplicitKDTreeTest, RangeSearch) {
+  const AxisAlignedBox enclosing_region{{1., 1., 1.}, {9., 9., 9.}};
+  EXPECT_EQ(points.size(), implicit_dut.RangeSearch(enclosing_region).size());
+
+  const AxisAlignedBox disjointed_region{{10., 10., 10.}, {11., 11., 11.}};
+  EXPECT_TRUE(implicit_dut.RangeSearch(disjointed_region).empty());
+
+  const AxisAlignedBox region{{1., 1., 1.}, {7., 5., 4.}};
+  const std::vector<Vector3> expected_points{{6, 5, 2}, {7, 1, 1}, {2, 1, 4}, {1, 4, 1}};
+  const auto contained_points = implicit_dut.RangeSearch(region);
+  ASSERT_EQ(expected_points.size(), contained_points.size());
+  for (const auto& expected_point : expected_points) {
+    EXPECT_NE(contained_points.end(),
+              std::find_if(contained_points.begin(), contained_points.end(),
+                           [&expected_point](const Vector3* p) { return *p == expected_point; }));
+  }
+}
+
+TEST_F(ImplicitKDTreeTest, VisitedNodes) {
+  const auto noop_visitor = [](const Vector3&) {};
+  // Every node of a subtree contained in the region is visited.
+  std::size_t num_visited_nodes{0};
+  implicit_dut.RangeSearch(AxisAlignedBox{{1., 1., 1.}, {9., 9., 9.}}, noop_visitor, &num_visited_nodes);
+  EXPECT_EQ(points.size(), num_visited_nodes);
+  // Counts are accumulated.
+  implicit_dut.RangeSearch(AxisAlignedBox{{10., 10., 10.}, {11., 11., 11.}}, noop_visitor, &num_visited_nodes);
+  EXPECT_LT(points.size(), num_visited_nodes);
+
+  num_visited_nodes = 0;
+  implicit_dut.nearest_point(Vector3{3., 3., 3.}, 1e-12, &num_visited_nodes);
+  EXPECT_GT(num_visited_nodes, 0u);
+  EXPECT_LE(num_visited_nodes, points.size());
+
+  num_visited_nodes = 0;
+  implicit_dut.RadiusSearch(Vector3{3., 3., 3.}, 100., [](const Vector3&, double) {}, &num_visited_nodes);
+  EXPECT_EQ(points.size(), num_visited_nodes);
+}
+
 // Custom Coordinate class for testing the KDTree class.
 // Inherits from Vector3 and adds a id field for uniquely identifying each point.
 class UniquePoint : public Vector3 {
@@ -405,6 +524,147 @@ TEST_F(KDTreeExtendedTest, RandomData) {
   }
 }
 
+// Tests ImplicitKDTree3D with a custom Coordinate class and for a large number of points.
+TEST_F(KDTreeExtendedTest, ImplicitRandomData) {
+  const auto points = GetRandomPoints(100000, -1000, 1000);
+  ImplicitKDTree3D<UniquePoint> dut{points};
+
+  for (const UniquePoint& evaluation_point :
+       {UniquePoint{50., 50., 50.}, UniquePoint{-999., 3., 700.}, UniquePoint{1500., -1500., 0.}}) {
+    const UniquePoint expected_point = BruteForceNNSearch<>(evaluation_point, points);
+    EXPECT_EQ(expected_point, dut.nearest_point(evaluation_point));
+  }
+
+  const AxisAlignedBox evaluation_range{{-250., -300., -100.}, {250., 100., 400.}};
+  std::vector<unsigned int> expected_ids;
+  for (const auto& point : BruteForceRangeSearch(evaluation_range, points)) {
+    expected_ids.push_back(point.id());
+  }
+  std::vector<unsigned int> ids;
+  for (const UniquePoint* point : dut.RangeSearch(evaluation_range)) {
+    ids.push_back(point->id());
+  }
+  std::sort(expected_ids.begin(), expected_ids.end());
+  std::sort(ids.begin(), ids.end());
+  EXPECT_EQ(expected_ids, ids);
+}
+
+// Evaluates KNearest() and RadiusSearch() methods of @p dut against brute force on @p points.
+template <typename Tree>
+void ExpectKNearestAndRadiusSearch(const Tree& dut, const std::deque<UniquePoint>& points) {
+  const std::vector<UniquePoint> evaluation_points{{50., 50., 50.}, {-999., 3., 700.}, {1500., -1500., 0.}};
+  for (const UniquePoint& evaluation_point : evaluation_points) {
+    std::vector<std::pair<double, unsigned int>> distances;
+    for (const auto& point : points) {
+      distances.emplace_back((evaluation_point - point).norm(), point.id());
+    }
+    std::sort(distances.begin(), distances.end());
+
+    for (const std::size_t k : {1u, 7u, 100u}) {
+      const std::vector<const UniquePoint*> k_nearest = dut.KNearest(evaluation_point, k);
+      ASSERT_EQ(k, k_nearest.size());
+      for (std::size_t i = 0; i < k; ++i) {
+        EXPECT_EQ(distances[i].second, k_nearest[i]->id());
+      }
+    }
+    // The buffer is reused across calls.
+    std::vector<Neighbour<UniquePoint>> neighbours;
+    dut.KNearest(evaluation_point, 10, &neighbours);
+    const auto* capacity_data = neighbours.data();
+    dut.KNearest(evaluation_point, 5, &neighbours);
+    ASSERT_EQ(5u, neighbours.size());
+    EXPECT_EQ(capacity_data, neighbours.data());
+    for (std::size_t i = 0; i < neighbours.size(); ++i) {
+      EXPECT_EQ(distances[i].second, neighbours[i].coordinate->id());
+      EXPECT_NEAR(distances[i].first * distances[i].first, neighbours[i].distance, 1e-6);
+    }
+    EXPECT_TRUE(dut.KNearest(evaluation_point, 0).empty());
+
+    for (const double radius : {0., 30., 150.}) {
+      std::vector<unsigned int> expected_ids;
+      for (const auto& distance : distances) {
+        if (distance.first > radius) break;
+        expected_ids.push_back(distance.second);
+      }
+      std::vector<unsigned int> ids;
+      for (const UniquePoint* point : dut.RadiusSearch(evaluation_point, radius)) {
+        ids.push_back(point->id());
+      }
+      std::sort(expected_ids.begin(), expected_ids.end());
+      std::sort(ids.begin(), ids.end());
+      EXPECT_EQ(expected_ids, ids);
+
+      std::size_t visited{0};
+      dut.RadiusSearch(evaluation_point, radius, [&](const UniquePoint& point, double distance) {
+        ++visited;
+        EXPECT_NEAR((evaluation_point - point).norm() * (evaluation_point - point).norm(), distance, 1e-6);
+      });
+      EXPECT_EQ(expected_ids.size(), visited);
+    }
+    EXPECT_THROW(dut.RadiusSearch(evaluation_point, -1.), maliput::common::assertion_error);
+  }
+}
+
+TEST_F(KDTreeExtendedTest, KNearestAndRadiusSearch) {
+  const auto points = GetRandomPoints(20000, -1000, 1000);
+  ExpectKNearestAndRadiusSearch(KDTree3D<UniquePoint>{points.begin(), points.end()}, points);
+  ExpectKNearestAndRadiusSearch(ImplicitKDTree3D<UniquePoint>{points.begin(), points.end()}, points);
+  // Asking for more points than available returns all of them.
+  const ImplicitKDTree3D<UniquePoint> few_points_dut{points.begin(), points.begin() + 3};
+  EXPECT_EQ(3u, few_points_dut.KNearest(UniquePoint{}, 10).size());
+  const KDTree3D<UniquePoint> few_points_kd_tree{points.begin(), points.begin() + 3};
+  EXPECT_EQ(3u, few_points_kd_tree.KNearest(UniquePoint{}, 10).size());
+}
+
+// Evaluates the visitor form of RangeSearch() of @p dut against brute force on @p points.
+template <typename Tree>
+void ExpectRangeSearchVisitor(const Tree& dut, const std::deque<UniquePoint>& points) {
+  const std::vector<AxisAlignedBox> regions{{{-250., -300., -100.}, {250., 100., 400.}},
+                                            {{-1000., -1000., -1000.}, {1000., 1000., 1000.}},
+                                            {{3., 3., 3.}, {3., 3., 3.}},
+                                            {{2000., 2000., 2000.}, {3000., 3000., 3000.}}};
+  for (const AxisAlignedBox& region : regions) {
+    std::vector<unsigned int> expected_ids;
+    for (const auto& point : KDTreeExtendedTest::BruteForceRangeSearch(region, points)) {
+      expected_ids.push_back(point.id());
+    }
+    std::vector<unsigned int> ids;
+    dut.RangeSearch(region, [&ids](const UniquePoint& point) { ids.push_back(point.id()); });
+    // The allocating form reports the same points in the same order.
+    const auto range_search = dut.RangeSearch(region);
+    ASSERT_EQ(ids.size(), range_search.size());
+    for (std::size_t i = 0; i < ids.size(); ++i) {
+      EXPECT_EQ(ids[i], range_search[i]->id());
+    }
+    std::sort(expected_ids.begin(), expected_ids.end());
+    std::sort(ids.begin(), ids.end());
+    EXPECT_EQ(expected_ids, ids);
+  }
+}
+
+TEST_F(KDTreeExtendedTest, RangeSearchVisitor) {
+  const auto points = GetRandomPoints(20000, -1000, 1000);
+  ExpectRangeSearchVisitor(KDTree3D<UniquePoint>{points.begin(), points.end()}, points);
+  ExpectRangeSearchVisitor(ImplicitKDTree3D<UniquePoint>{points.begin(), points.end()}, points);
+}
+
+// Tests that building ImplicitKDTree3D with several threads lays out the points as the serial build does.
+TEST_F(KDTreeExtendedTest, ImplicitParallelConstruction) {
+  const auto points = GetRandomPoints(50000, -1000, 1000);
+  const ImplicitKDTree3D<UniquePoint> serial{points.begin(), points.end()};
+  EXPECT_THROW((ImplicitKDTree3D<UniquePoint>{points, 0}), maliput::common::assertion_error);
+  const AxisAlignedBox enclosing_range{{-1000., -1000., -1000.}, {1000., 1000., 1000.}};
+  const auto expected_points = serial.RangeSearch(enclosing_range);
+  for (const std::size_t num_threads : {2u, 3u, 8u}) {
+    const ImplicitKDTree3D<UniquePoint> dut{points, num_threads};
+    const auto dut_points = dut.RangeSearch(enclosing_range);
+    ASSERT_EQ(expected_points.size(), dut_points.size());
+    for (std::size_t i = 0; i < dut_points.size(); ++i) {
+      EXPECT_EQ(expected_points[i]->id(), dut_points[i]->id());
+    }
+  }
+}
+
 }  // namespace
 }  // namespace math
 }  // namespace maliput
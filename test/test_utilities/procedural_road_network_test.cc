@@ -0,0 +1,233 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2023, Woven by Toyota. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "maliput/test_utilities/procedural_road_network.h"
+
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include "maliput/api/lane.h"
+#include "maliput/api/road_network_validator.h"
+#include "maliput/base/rule_registry.h"
+#include "maliput/common/assertion_error.h"
+
+namespace maliput {
+namespace api {
+namespace test {
+namespace {
+
+constexpr double kTolerance{1e-9};
+
+// The direction usage coverage check queries the deprecated DirectionUsageRules, while the generator provides
+// direction usage DiscreteValueRules.
+RoadNetworkValidatorOptions ValidatorOptions() {
+  RoadNetworkValidatorOptions options;
+  options.check_direction_usage_rule_coverage = false;
+  return options;
+}
+
+// Counts the lanes of @p rg.
+int CountLanes(const RoadGeometry& rg) {
+  int num_lanes{0};
+  for (int j = 0; j < rg.num_junctions(); ++j) {
+    for (int s = 0; s < rg.junction(j)->num_segments(); ++s) {
+      num_lanes += rg.junction(j)->segment(s)->num_lanes();
+    }
+  }
+  return num_lanes;
+}
+
+// Asserts that every lane of @p rg maps a few lane positions to inertial positions and back.
+void ExpectLanePositionRoundTrip(const RoadGeometry& rg) {
+  for (const auto& [id, lane] : rg.ById().GetLanes()) {
+    for (const double s_fraction : {0., 0.3, 1.}) {
+      const LanePosition lane_position{s_fraction * lane->length(), 0.2 * lane->lane_bounds(0.).max(), 1.};
+      const LanePositionResult result = lane->ToLanePosition(lane->ToInertialPosition(lane_position));
+      EXPECT_NEAR(result.distance, 0., kTolerance) << id.string();
+      EXPECT_NEAR(result.lane_position.s(), lane_position.s(), kTolerance) << id.string();
+      EXPECT_NEAR(result.lane_position.r(), lane_position.r(), kTolerance) << id.string();
+      EXPECT_NEAR(result.lane_position.h(), lane_position.h(), kTolerance) << id.string();
+    }
+  }
+}
+
+GTEST_TEST(ProceduralRoadNetworkTest, InvalidConfigThrows) {
+  ProceduralRoadNetworkConfig config;
+  config.lanes_per_direction = 0;
+  EXPECT_THROW(CreateProceduralRoadGeometry(config), common::assertion_error);
+
+  config = ProceduralRoadNetworkConfig{};
+  config.num_rows = 1;
+  config.num_columns = 1;
+  EXPECT_THROW(CreateProceduralRoadGeometry(config), common::assertion_error);
+
+  config = ProceduralRoadNetworkConfig{};
+  config.block_length = 20.;
+  EXPECT_THROW(CreateProceduralRoadGeometry(config), common::assertion_error);
+
+  config = ProceduralRoadNetworkConfig{};
+  config.layout = ProceduralRoadNetworkConfig::Layout::kHighway;
+  config.curvature = 1.;
+  EXPECT_THROW(CreateProceduralRoadGeometry(config), common::assertion_error);
+}
+
+GTEST_TEST(ProceduralRoadNetworkTest, GridCityGeometry) {
+  ProceduralRoadNetworkConfig config;
+  config.num_rows = 3;
+  config.num_columns = 4;
+  config.lanes_per_direction = 3;
+  const std::unique_ptr<geometry_base::RoadGeometry> dut = CreateProceduralRoadGeometry(config);
+
+  // 9 east roads, 8 north roads and 12 intersections.
+  EXPECT_EQ(dut->num_junctions(), 9 + 8 + 12);
+  // Inner intersections have the full set of connections.
+  const Junction* center = dut->ById().GetJunction(JunctionId("intersection_1_1"));
+  ASSERT_NE(center, nullptr);
+  // Four approaches, each with a straight segment and two turns.
+  EXPECT_EQ(center->num_segments(), 4 * 3);
+  EXPECT_EQ(dut->ById().GetLane(LaneId("road_0_0_east_forward_2"))->segment()->num_lanes(), 3);
+  EXPECT_TRUE(dut->CheckInvariants().empty());
+  EXPECT_TRUE(dut->FindInvariantViolations(4).empty());
+  ExpectLanePositionRoundTrip(*dut);
+
+  // Driving east through the center intersection, the rightmost lane continues straight or turns right.
+  const Lane* approach = dut->ById().GetLane(LaneId("road_0_1_east_forward_0"));
+  ASSERT_NE(approach, nullptr);
+  EXPECT_EQ(approach->GetOngoingBranches(LaneEnd::kFinish)->size(), 2);
+  const Lane* leftmost_approach = dut->ById().GetLane(LaneId("road_0_1_east_forward_2"));
+  EXPECT_EQ(leftmost_approach->GetOngoingBranches(LaneEnd::kFinish)->size(), 2);
+  const Lane* middle_approach = dut->ById().GetLane(LaneId("road_0_1_east_forward_1"));
+  EXPECT_EQ(middle_approach->GetOngoingBranches(LaneEnd::kFinish)->size(), 1);
+}
+
+GTEST_TEST(ProceduralRoadNetworkTest, HighwayGeometry) {
+  ProceduralRoadNetworkConfig config;
+  config.layout = ProceduralRoadNetworkConfig::Layout::kHighway;
+  config.num_segments = 9;
+  config.interchange_spacing = 4;
+  config.curvature = 1e-3;
+  config.grade = 0.02;
+  const std::unique_ptr<geometry_base::RoadGeometry> dut = CreateProceduralRoadGeometry(config);
+
+  // 9 highway Junctions and interchanges at the boundaries 4 and 8.
+  EXPECT_EQ(dut->num_junctions(), 9 + 2);
+  EXPECT_EQ(CountLanes(*dut), 9 * 2 * config.lanes_per_direction + 2 * 2);
+  EXPECT_TRUE(dut->CheckInvariants().empty());
+  ExpectLanePositionRoundTrip(*dut);
+
+  // The rightmost lane before an interchange continues along the highway or takes the exit ramp.
+  const Lane* before_interchange = dut->ById().GetLane(LaneId("highway_3_forward_0"));
+  ASSERT_NE(before_interchange, nullptr);
+  EXPECT_EQ(before_interchange->GetOngoingBranches(LaneEnd::kFinish)->size(), 2);
+  const Lane* entrance = dut->ById().GetLane(LaneId("interchange_4_entrance_0"));
+  ASSERT_NE(entrance, nullptr);
+  EXPECT_EQ(entrance->GetOngoingBranches(LaneEnd::kFinish)->size(), 2);
+  // The highway climbs with the grade.
+  const Lane* last = dut->ById().GetLane(LaneId("highway_8_forward_1"));
+  EXPECT_GT(last->ToInertialPosition({last->length(), 0., 0.}).z(), 0.02 * 8 * config.segment_length);
+}
+
+// Points below a graded lane are projected along the normal of its surface, not vertically.
+GTEST_TEST(ProceduralRoadNetworkTest, GradedLaneProjection) {
+  constexpr double kGrade{0.3};
+  constexpr double kDepth{1.};
+  constexpr double kProjectionTolerance{1e-6};
+  ProceduralRoadNetworkConfig config;
+  config.layout = ProceduralRoadNetworkConfig::Layout::kHighway;
+  config.num_segments = 1;
+  config.interchange_spacing = 0;
+  config.grade = kGrade;
+  config.angular_tolerance = 0.1;
+  for (const double curvature : {0., 1e-2}) {
+    config.curvature = curvature;
+    const std::unique_ptr<geometry_base::RoadGeometry> dut = CreateProceduralRoadGeometry(config);
+    const Lane* lane = dut->ById().GetLane(LaneId("highway_0_forward_0"));
+    ASSERT_NE(lane, nullptr);
+    for (const double s_fraction : {0.25, 0.5, 0.75}) {
+      const LanePosition lane_position{s_fraction * lane->length(), 0., 0.};
+      const Rotation rotation = lane->GetOrientation(lane_position);
+      const math::Vector3 normal = rotation.Apply(InertialPosition{0., 0., 1.}).xyz();
+      const InertialPosition below =
+          InertialPosition::FromXyz(lane->ToInertialPosition(lane_position).xyz() - kDepth * normal);
+      const LanePositionResult result = lane->ToLanePosition(below);
+      EXPECT_NEAR(result.distance, kDepth, kProjectionTolerance) << curvature;
+      EXPECT_NEAR(result.lane_position.s(), lane_position.s(), kProjectionTolerance) << curvature;
+      EXPECT_NEAR(result.lane_position.r(), lane_position.r(), kProjectionTolerance) << curvature;
+      EXPECT_NEAR(result.lane_position.h(), 0., kProjectionTolerance) << curvature;
+    }
+  }
+}
+
+GTEST_TEST(ProceduralRoadNetworkTest, GridCityRoadNetwork) {
+  ProceduralRoadNetworkConfig config;
+  config.num_rows = 3;
+  config.num_columns = 3;
+  config.speed_limit_zones_per_lane = 2;
+  const std::unique_ptr<RoadNetwork> dut = CreateProceduralRoadNetwork(config);
+
+  EXPECT_NO_THROW(ValidateRoadNetwork(*dut, ValidatorOptions()));
+  EXPECT_EQ(dut->intersection_book()->GetIntersections().size(), 9u);
+  const int num_lanes = CountLanes(*dut->road_geometry());
+  const rules::RoadRulebook::QueryResults rules = dut->rulebook()->Rules();
+  EXPECT_EQ(static_cast<int>(rules.range_value_rules.size()), 2 * num_lanes);
+  int num_right_of_way_rules{0};
+  for (const auto& [id, rule] : rules.discrete_value_rules) {
+    num_right_of_way_rules += rule.type_id() == RightOfWayRuleTypeId() ? 1 : 0;
+  }
+  EXPECT_EQ(static_cast<int>(rules.discrete_value_rules.size()), num_lanes + num_right_of_way_rules);
+  EXPECT_GT(num_right_of_way_rules, 0);
+
+  // The right of way follows the phase of the intersection.
+  const Intersection* intersection = dut->intersection_book()->GetIntersection(Intersection::Id("intersection_1_1"));
+  ASSERT_NE(intersection, nullptr);
+  ASSERT_TRUE(intersection->Phase().has_value());
+  EXPECT_EQ(intersection->Phase()->state, rules::Phase::Id("north_south_go"));
+  const rules::Rule::Id north_bound_rule(RightOfWayRuleTypeId().string() +
+                                         "/intersection_1_1_from_south_straight_0");
+  const std::optional<rules::DiscreteValueRuleStateProvider::StateResult> state =
+      dut->discrete_value_rule_state_provider()->GetState(north_bound_rule);
+  ASSERT_TRUE(state.has_value());
+  EXPECT_EQ(state->state.value, "Go");
+}
+
+GTEST_TEST(ProceduralRoadNetworkTest, HighwayRoadNetwork) {
+  ProceduralRoadNetworkConfig config;
+  config.layout = ProceduralRoadNetworkConfig::Layout::kHighway;
+  config.curvature = 2e-3;
+  const std::unique_ptr<RoadNetwork> dut = CreateProceduralRoadNetwork(config);
+
+  EXPECT_NO_THROW(ValidateRoadNetwork(*dut, ValidatorOptions()));
+  EXPECT_TRUE(dut->intersection_book()->GetIntersections().empty());
+  EXPECT_TRUE(dut->traffic_light_book()->TrafficLights().empty());
+}
+
+}  // namespace
+}  // namespace test
+}  // namespace api
+}  // namespace maliput
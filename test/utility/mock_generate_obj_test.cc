@@ -35,6 +35,7 @@
 #include "maliput/api/road_geometry.h"
 #include "maliput/api/road_network.h"
 #include "maliput/common/filesystem.h"
+#include "maliput/geometry_base/cached_road_geometry.h"
 #include "maliput/test_utilities/mock.h"
 #include "maliput/utility/generate_obj.h"
 
@@ -108,6 +109,30 @@ TEST_F(MockGenerateObjTest, TwoLanesRoadGeometry) {
   EXPECT_EQ(expected_mtl_contents, actual_mtl_contents);
 }
 
+// The mesh of a geometry_base::CachedRoadGeometry is built from its CachedLanes, so the lane queries hit the caches.
+TEST_F(MockGenerateObjTest, CachedTwoLanesRoadGeometry) {
+  const std::unique_ptr<const api::RoadGeometry> road_geometry = api::test::CreateTwoLanesRoadGeometry();
+  const geometry_base::CachedRoadGeometry dut(road_geometry.get(), 1e-9 /* quantum */, 1024 /* capacity */);
+
+  const std::string basename{"CachedTwoLanesRoadGeometry"};
+  ObjFeatures features;
+  features.min_grid_resolution = 5.0;
+  GenerateObjFile(&dut, directory_.get_path(), basename, features);
+
+  common::Path actual_obj_path(directory_);
+  actual_obj_path.append(basename + ".obj");
+  EXPECT_TRUE(actual_obj_path.is_file());
+  paths_to_cleanup_.push_back(actual_obj_path);
+  common::Path actual_mtl_path(directory_);
+  actual_mtl_path.append(basename + ".mtl");
+  EXPECT_TRUE(actual_mtl_path.is_file());
+  paths_to_cleanup_.push_back(actual_mtl_path);
+
+  const geometry_base::CachedLane::Statistics statistics = dut.statistics();
+  EXPECT_GT(statistics.lane_bounds.hits, 0);
+  EXPECT_GT(statistics.to_inertial_position.hits, 0);
+}
+
 // OBJ and MTL files generated from the GeneratedObjFile method are compared with the following files
 // located in the test path of maliput::utility' tests:
 //  - TwoLanesRoadGeometry.mtl